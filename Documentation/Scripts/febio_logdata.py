@@ -0,0 +1,101 @@
+"""Reader for binary FEBio logfile data records (file_type="binary").
+
+The file format is described in FECore/DataRecord.h. A file consists of one or
+more segments. Each segment starts with a header that lists the item IDs and the
+data columns, followed by one fixed-size block per time step. A new segment is
+started when the item list changes and after a restart.
+
+Usage as a script:
+
+    python febio_logdata.py file.bin
+
+prints a summary of the file. From python:
+
+    from febio_logdata import read_logdata
+    for seg in read_logdata("file.bin"):
+        print(seg.columns, seg.ids, seg.steps, seg.times)
+        ux = seg.column("ux")       # array of shape (steps, items)
+
+Requires numpy. The data is memory-mapped, so only the accessed columns are read.
+"""
+
+import struct
+import sys
+
+import numpy as np
+
+MAGIC = b"FEBLOGB\0"
+
+
+class Segment:
+    """A header and the step blocks that follow it."""
+
+    def __init__(self, data, offset):
+        version, rtype, nitems, ncols = struct.unpack_from("<4I", data, offset + 8)
+        header_size, block_size = struct.unpack_from("<2Q", data, offset + 24)
+        if version != 1:
+            raise ValueError("unsupported version %d" % version)
+
+        pos = offset + 40
+        self.record_type = rtype
+        self.ids = np.frombuffer(data, dtype=np.int32, count=nitems, offset=pos).copy()
+        pos += 4 * nitems
+
+        self.columns = []
+        for _ in range(ncols):
+            dtype, length = struct.unpack_from("<2I", data, pos)
+            pos += 8
+            if dtype != 0:
+                raise ValueError("unsupported column type %d" % dtype)
+            self.columns.append(bytes(data[pos:pos + length]).decode())
+            pos += length
+
+        # the segment ends at the end of the file or at the next header
+        start = offset + header_size
+        nsteps = 0
+        while start + (nsteps + 1) * block_size <= len(data):
+            p = start + nsteps * block_size
+            if bytes(data[p:p + 8]) == MAGIC:
+                break
+            nsteps += 1
+
+        blocks = np.ndarray(
+            shape=(nsteps,),
+            dtype=np.dtype([("step", "<i4"), ("items", "<i4"), ("time", "<f8"),
+                            ("values", "<f8", (ncols, nitems))]),
+            buffer=data, offset=start)
+
+        self.steps = blocks["step"]
+        self.times = blocks["time"]
+        self.values = blocks["values"]  # shape (steps, columns, items)
+        self.end = start + nsteps * block_size
+
+    def column(self, name):
+        """Returns the values of a column as an array of shape (steps, items)."""
+        return self.values[:, self.columns.index(name), :]
+
+
+def read_logdata(filename):
+    """Returns the list of segments in a binary logfile data file."""
+    data = np.memmap(filename, dtype=np.uint8, mode="r")
+    segments = []
+    offset = 0
+    while offset < len(data):
+        if bytes(data[offset:offset + 8]) != MAGIC:
+            raise ValueError("invalid header at offset %d" % offset)
+        seg = Segment(data, offset)
+        segments.append(seg)
+        offset = seg.end
+    return segments
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 2:
+        print("usage: python febio_logdata.py file")
+        sys.exit(1)
+
+    for n, seg in enumerate(read_logdata(sys.argv[1])):
+        print("segment %d: %d items, %d steps, columns: %s"
+              % (n, len(seg.ids), len(seg.steps), ", ".join(seg.columns)))
+        if len(seg.steps) > 0:
+            print("  time %g to %g" % (seg.times[0], seg.times[-1]))
@@ -51,6 +51,11 @@ bool FEDomainShapeInterpolator::Init()
 
 	int nodes = m_trgPoints.size();
 	m_data.resize(nodes);
+
+	// The octree search does not modify the octree, so the target points
+	// can be located in parallel.
+	bool bok = true;
+#pragma omp parallel for schedule(dynamic, 64) shared(bok)
 	for (int i = 0; i < nodes; ++i)
 	{
 		Data& di = m_data[i];
@@ -62,12 +67,12 @@ bool FEDomainShapeInterpolator::Init()
 		if (di.el == nullptr)
 		{
 			assert(false);
-			return false;
+			bok = false;
 		}
-		assert(di.el->GetMeshPartition() == m_dom);
+		else assert(di.el->GetMeshPartition() == m_dom);
 	}
 
-	return true;
+	return bok;
 }
 
 void FEDomainShapeInterpolator::SetTargetPoints(const vector<vec3d>& trgPoints)
@@ -100,6 +105,37 @@ bool FEDomainShapeInterpolator::Map(std::vector<double>& tval, function<double(i
 	return true;
 }
 
+bool FEDomainShapeInterpolator::MapFields(std::vector< std::vector<double> >& tval, const std::vector< std::vector<double> >& sval)
+{
+	if (tval.size() != sval.size()) return false;
+
+	int NF = (int)sval.size();
+	int nodes = m_trgPoints.size();
+	for (int l = 0; l < NF; ++l) tval[l].resize(nodes);
+
+	// evaluate all fields for each target point, so the element's shape
+	// functions only need to be evaluated once per point
+#pragma omp parallel for
+	for (int i = 0; i < nodes; ++i)
+	{
+		Data& di = m_data[i];
+		int neln = di.el->Nodes();
+
+		double H[FEElement::MAX_NODES];
+		di.el->shape_fnc(H, di.r[0], di.r[1], di.r[2]);
+
+		for (int l = 0; l < NF; ++l)
+		{
+			const std::vector<double>& sl = sval[l];
+			double vl = 0.0;
+			for (int j = 0; j < neln; ++j) vl += H[j] * sl[di.el->m_lnode[j]];
+			tval[l][i] = vl;
+		}
+	}
+
+	return true;
+}
+
 double FEDomainShapeInterpolator::Map(int inode, function<double(int sourceNode)> f)
 {
 	Data& di = m_data[inode];
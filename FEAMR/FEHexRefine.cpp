@@ -407,6 +407,10 @@ void FEHexRefine::UpdateNewNodes(FEModel& fem)
 		node.SetDOFS(MAX_DOFS);
 	}
 
+	// the old nodes keep their index
+	m_nodeOrigin.assign(m_NN, -1);
+	for (int i = 0; i < m_N0; ++i) m_nodeOrigin[i] = i;
+
 	// update the position of these new nodes
 	n = 0;
 	for (int i = 0; i < topo.Edges(); ++i)
@@ -719,6 +723,11 @@ void FEHexRefine::BuildNewDomains(FEModel& fem)
 			if (m_elemList[nelems + j] != -1) newElems++;
 		}
 
+		// keep track of which elements are copied without modification
+		std::vector<int>& elemOrigin = m_elemOrigin[i];
+		elemOrigin.resize(NE0);
+		for (int j = 0; j < NE0; ++j) elemOrigin[j] = j;
+
 		// make sure we have something to do
 		if (newElems > 0)
 		{
@@ -737,6 +746,8 @@ void FEHexRefine::BuildNewDomains(FEModel& fem)
 			// reallocate the old domain
 			oldDom.Create(8 * newElems + (NE0 - newElems), FEElementLibrary::GetElementSpecFromType(FE_HEX8G8));
 
+			elemOrigin.assign(8 * newElems + (NE0 - newElems), -1);
+
 			// set new element nodes
 			int nel = 0;
 			for (int j = 0; j < NE0; ++j, nelems++)
@@ -800,6 +811,7 @@ void FEHexRefine::BuildNewDomains(FEModel& fem)
 				{
 					// if the element is not split, we just copy the nodes from
 					// the old domain
+					elemOrigin[nel] = j;
 					FEElement& el1 = oldDom.ElementRef(nel++);
 					el1.SetMatID(el0.GetMatID());
 					el1.setStatus(el0.status());
@@ -404,6 +404,10 @@ void FEHexRefine2D::UpdateNewNodes(FEModel& fem)
 		node.SetDOFS(MAX_DOFS);
 	}
 
+	// the old nodes keep their index
+	m_nodeOrigin.assign(m_NN, -1);
+	for (int i = 0; i < m_N0; ++i) m_nodeOrigin[i] = i;
+
 	// update the position of these new nodes
 	n = 0;
 	for (int i = 0; i < topo.Edges(); ++i)
@@ -580,6 +584,11 @@ void FEHexRefine2D::BuildNewDomains(FEModel& fem)
 			if (m_elemList[nelems + j] != -1) newElems++;
 		}
 
+		// keep track of which elements are copied without modification
+		std::vector<int>& elemOrigin = m_elemOrigin[i];
+		elemOrigin.resize(NE0);
+		for (int j = 0; j < NE0; ++j) elemOrigin[j] = j;
+
 		// make sure we have something to do
 		if (newElems > 0)
 		{
@@ -597,6 +606,8 @@ void FEHexRefine2D::BuildNewDomains(FEModel& fem)
 			// reallocate the old domain
 			oldDom.Create(4 * newElems + (NE0 - newElems), FEElementLibrary::GetElementSpecFromType(FE_HEX8G8));
 
+			elemOrigin.assign(4 * newElems + (NE0 - newElems), -1);
+
 			// set new element nodes
 			int nel = 0;
 			for (int j = 0; j < NE0; ++j, nelems++)
@@ -649,6 +660,7 @@ void FEHexRefine2D::BuildNewDomains(FEModel& fem)
 				{
 					// if the element is not split, we just copy the nodes from
 					// the old domain
+					elemOrigin[nel] = j;
 					FEElement& el1 = oldDom.ElementRef(nel++);
 					for (int k = 0; k < el0.Nodes(); ++k) el1.m_node[k] = el0.m_node[k];
 					el1.m_val = el0.m_val;
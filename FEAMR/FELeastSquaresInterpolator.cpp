@@ -28,66 +28,104 @@ SOFTWARE.*/
 #include <algorithm>
 using namespace std;
 
+//-----------------------------------------------------------------------------
+// Balanced k-d tree over a fixed point set. The tree is stored implicitly as a
+// permutation of the point indices: the median of each range [lo, hi) is the
+// splitting point of that node and the two halves are its children.
 class KDTree
 {
 public:
-	KDTree()
+	KDTree() : m_pts(nullptr) {}
+
+	void build(const vector<vec3d>& pts)
 	{
-		m_parent = nullptr;
-		m_left = nullptr;
-		m_right = nullptr;
+		m_pts = &pts;
+		int n = (int)pts.size();
+		m_idx.resize(n);
+		for (int i = 0; i < n; ++i) m_idx[i] = i;
+		build(0, n, 0);
 	}
 
-	void build(vector<vec3d> pts, int depth = 0)
+	// find the k nearest points to x. The indices are returned sorted
+	// by increasing distance.
+	int findNearest(const vec3d& x, int k, vector<int>& closest) const
 	{
-		size_t n = pts.size();
-		if (n == 1)
-		{
-			m_r = pts[0];
-			return;
-		}
+		int n = (int)m_idx.size();
+		if (k > n) k = n;
+
+		vector< pair<double, int> > heap;
+		heap.reserve(k);
+		if (k > 0) search(0, n, 0, x, k, heap);
+
+		std::sort_heap(heap.begin(), heap.end());
+		closest.resize(heap.size());
+		for (size_t i = 0; i < heap.size(); ++i) closest[i] = heap[i].second;
+		return (int)heap.size();
+	}
+
+private:
+	static double coord(const vec3d& r, int axis)
+	{
+		return (axis == 0 ? r.x : (axis == 1 ? r.y : r.z));
+	}
+
+	void build(int lo, int hi, int depth)
+	{
+		if (hi - lo < 2) return;
 
 		int axis = depth % 3;
-		std::sort(pts.begin(), pts.end(), [=](const vec3d& a, const vec3d& b) {
-			if (axis == 0) return (a.x < b.x);
-			if (axis == 1) return (a.y < b.y);
-			if (axis == 2) return (a.z < b.z);
-			return false;
+		int mid = (lo + hi) / 2;
+		const vector<vec3d>& pts = *m_pts;
+		std::nth_element(m_idx.begin() + lo, m_idx.begin() + mid, m_idx.begin() + hi, [&](int a, int b) {
+			return coord(pts[a], axis) < coord(pts[b], axis);
 		});
 
-		int med = n / 2;
+		build(lo, mid, depth + 1);
+		build(mid + 1, hi, depth + 1);
+	}
 
-		m_r = pts[med];
+	void search(int lo, int hi, int depth, const vec3d& x, int k, vector< pair<double, int> >& heap) const
+	{
+		if (hi <= lo) return;
+
+		int mid = (lo + hi) / 2;
+		int i = m_idx[mid];
+		const vec3d& p = (*m_pts)[i];
+		vec3d dr = p - x;
+		double d2 = dr*dr;
 
-		// build left list
-		if (med > 0)
+		// the heap keeps the k closest points found so far, farthest on top
+		if ((int)heap.size() < k)
+		{
+			heap.push_back(pair<double, int>(d2, i));
+			std::push_heap(heap.begin(), heap.end());
+		}
+		else if (d2 < heap.front().first)
 		{
-			vector<vec3d> l(pts.begin(), pts.begin() + med);
-			m_left = new KDTree(this);
-			m_left->build(l, depth + 1);
+			std::pop_heap(heap.begin(), heap.end());
+			heap.back() = pair<double, int>(d2, i);
+			std::push_heap(heap.begin(), heap.end());
 		}
 
-		// build right list
-		if (med < n - 1)
+		// visit the side containing x first, and the other side only if
+		// it can still contain a closer point
+		int axis = depth % 3;
+		double dx = coord(x, axis) - coord(p, axis);
+		if (dx < 0)
+		{
+			search(lo, mid, depth + 1, x, k, heap);
+			if (((int)heap.size() < k) || (dx*dx < heap.front().first)) search(mid + 1, hi, depth + 1, x, k, heap);
+		}
+		else
 		{
-			vector<vec3d> r(pts.begin() + med + 1, pts.end());
-			m_right = new KDTree(this);
-			m_right->build(r, depth + 1);
+			search(mid + 1, hi, depth + 1, x, k, heap);
+			if (((int)heap.size() < k) || (dx*dx < heap.front().first)) search(lo, mid, depth + 1, x, k, heap);
 		}
 	}
 
-public:
-	vec3d	m_r;
-	KDTree*	m_parent;
-	KDTree*	m_left;
-	KDTree*	m_right;
-
-public:
-	KDTree(KDTree* parent) : m_parent(parent)
-	{
-		m_left = nullptr;
-		m_right = nullptr;
-	}
+private:
+	const vector<vec3d>*	m_pts;
+	vector<int>				m_idx;
 };
 
 class NearestNeighborSearch
@@ -95,21 +133,21 @@ class NearestNeighborSearch
 public:
 	NearestNeighborSearch() {}
 
-	void Init(const std::vector<vec3d>& points, int k)
+	void Init(const std::vector<vec3d>& points)
 	{
-		m_k = k;
 		m_points = points;
 
-//		m_kdtree.build(m_points);
+		m_kdtree.build(m_points);
 	}
 
-	int findNearestNeighbors(const vec3d& x, std::vector<int>& closestNodes)
+	// This function does not modify the search structure, so it can be called
+	// from multiple threads concurrently.
+	int findNearestNeighbors(const vec3d& x, int k, std::vector<int>& closestNodes) const
 	{
-		return findNeirestNeighbors(m_points, x, m_k, closestNodes);
+		return m_kdtree.findNearest(x, k, closestNodes);
 	}
 
 protected:
-	int				m_k;
 	vector<vec3d>	m_points;
 
 	KDTree	m_kdtree;
@@ -138,6 +176,12 @@ FELeastSquaresInterpolator::FELeastSquaresInterpolator()
 	m_dim = 3;
 	m_nnc = 8;
 	m_checkForMatch = false;
+	m_nns = nullptr;
+}
+
+FELeastSquaresInterpolator::~FELeastSquaresInterpolator()
+{
+	delete m_nns;
 }
 
 //! Set dimension (2 or 3)
@@ -154,6 +198,10 @@ void FELeastSquaresInterpolator::SetCheckForMatch(bool b) { m_checkForMatch = b;
 void FELeastSquaresInterpolator::SetSourcePoints(const vector<vec3d>& srcPoints)
 {
 	m_src = srcPoints;
+
+	// the search structure needs to be rebuilt
+	delete m_nns;
+	m_nns = nullptr;
 }
 
 void FELeastSquaresInterpolator::SetTargetPoints(const vector<vec3d>& trgPoints)
@@ -174,31 +222,31 @@ bool FELeastSquaresInterpolator::Init()
 	if (m_src.empty()) return false;
 	if (m_trg.empty()) return false;
 
-	int N0 = m_src.size();
 	int N1 = m_trg.size();
 
 	m_data.resize(N1);
 
 	// initialize nearest neighbor search
-	NearestNeighborSearch NNS;
-	NNS.Init(m_src, m_nnc);
-
-	// do nearest-neighbor search
-	for (int i = 0; i < N1; ++i)
+	// (This is only done once, since Init is called for each target point when
+	// the target points are set one at a time.)
+	if (m_nns == nullptr)
 	{
-		vec3d ri = m_trg[i];
-		int M = NNS.findNearestNeighbors(ri, m_data[i].cpl);
-		assert(M > 4);
-		m_data[i].cpl.resize(M);
+		m_nns = new NearestNeighborSearch;
+		m_nns->Init(m_src);
 	}
+	const NearestNeighborSearch& NNS = *m_nns;
 
+	// do the nearest-neighbor search and set up the MLS system of each target point.
+	// The target points are independent, so this is done in parallel.
+#pragma omp parallel for schedule(dynamic, 64)
 	for (int i = 0; i < N1; ++i)
 	{
 		Data& d = m_data[i];
 		vec3d x = m_trg[i];
 
 		vector<int>& closestNodes = m_data[i].cpl;
-		int M = closestNodes.size();
+		int M = NNS.findNearestNeighbors(x, m_nnc, closestNodes);
+		assert(M > 4);
 
 		// the last node is the farthest and determines the radius
 		vec3d& r = m_src[closestNodes[M - 1]];
@@ -287,6 +335,54 @@ bool FELeastSquaresInterpolator::Map(std::vector<double>& tval, function<double(
 	return true;
 }
 
+bool FELeastSquaresInterpolator::MapFields(std::vector< std::vector<double> >& tval, const std::vector< std::vector<double> >& sval)
+{
+	if (m_data.size() != m_trg.size()) return false;
+	if (tval.size() != sval.size()) return false;
+
+	int NF = (int)sval.size();
+	int N1 = (int)m_trg.size();
+	for (int l = 0; l < NF; ++l) tval[l].resize(N1);
+
+	// All fields share the weights and the factored MLS matrix of a target point,
+	// so they are evaluated together while the target's data is in cache.
+#pragma omp parallel for schedule(dynamic, 64)
+	for (int i = 0; i < N1; ++i)
+	{
+		Data& d = m_data[i];
+
+		vector<int>& closestNodes = d.cpl;
+		int M = closestNodes.size();
+
+		vector<double> b(m_dim + 1);
+		for (int l = 0; l < NF; ++l)
+		{
+			const vector<double>& sl = sval[l];
+
+			b.assign(m_dim + 1, 0.0);
+			for (int m = 0; m < M; ++m)
+			{
+				vec3d ri = d.X[m];
+				double P[4] = { 1.0, ri.x, ri.y, ri.z };
+
+				double vm = sl[closestNodes[m]];
+
+				for (int a = 0; a <= m_dim; ++a)
+				{
+					b[a] += d.W[m] * P[a] * vm;
+				}
+			}
+
+			// solve the linear system of equations
+			d.A.lusolve(b, d.index);
+
+			tval[l][i] = b[0];
+		}
+	}
+
+	return true;
+}
+
 double FELeastSquaresInterpolator::Map(int inode, function<double(int sourceNode)> f)
 {
 	Data& d = m_data[inode];
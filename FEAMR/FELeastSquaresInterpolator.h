@@ -26,6 +26,8 @@ SOFTWARE.*/
 #pragma once
 #include "FEMeshDataInterpolator.h"
 
+class NearestNeighborSearch;
+
 //! Helper class for mapping data between two point sets using moving least squares.
 class FELeastSquaresInterpolator : public FEMeshDataInterpolator
 {
@@ -47,6 +49,7 @@ class FELeastSquaresInterpolator : public FEMeshDataInterpolator
 public:
 	//! constructor
 	FELeastSquaresInterpolator();
+	~FELeastSquaresInterpolator();
 
 	//! Set dimension (2 or 3)
 	void SetDimension(int d);
@@ -73,6 +76,9 @@ public:
 	//! output: tval - values at the target points
 	bool Map(std::vector<double>& tval, std::function<double(int sourceNode)> src) override;
 
+	//! map several source fields at once
+	bool MapFields(std::vector< std::vector<double> >& tval, const std::vector< std::vector<double> >& sval) override;
+
 	// evaluate map
 	double Map(int inode, std::function<double(int sourceNode)> src) override;
 	vec3d MapVec3d(int inode, std::function<vec3d(int sourceNode)> src) override;
@@ -85,4 +91,6 @@ private:
 	std::vector<vec3d>	m_trg;	// target points
 
 	std::vector< Data >			m_data;
+
+	NearestNeighborSearch*	m_nns;	// search structure for the source points
 };
@@ -135,6 +135,10 @@ bool FEMMGRemesh::RefineMesh()
 	// build the new mesh
 	bool bret = mmg->build_new_mesh(mmgMesh, mmgSol, *GetFEModel());
 
+	// the mesh is regenerated, so none of the elements are copied from the old mesh
+	m_elemOrigin.resize(mesh.Domains());
+	for (int i = 0; i < mesh.Domains(); ++i) m_elemOrigin[i].assign(mesh.Domain(i).Elements(), -1);
+
 	// Clean up
 	MMG3D_Free_all(MMG5_ARG_start,
 		MMG5_ARG_ppMesh, &mmgMesh, MMG5_ARG_ppMet, &mmgSol,
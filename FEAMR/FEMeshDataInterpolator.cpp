@@ -37,3 +37,14 @@ bool FEMeshDataInterpolator::Init()
 { 
 	return true; 
 }
+
+bool FEMeshDataInterpolator::MapFields(std::vector< std::vector<double> >& tval, const std::vector< std::vector<double> >& sval)
+{
+	if (tval.size() != sval.size()) return false;
+	for (size_t l = 0; l < sval.size(); ++l)
+	{
+		const std::vector<double>& sl = sval[l];
+		if (Map(tval[l], [&sl](int sourceNode) { return sl[sourceNode]; }) == false) return false;
+	}
+	return true;
+}
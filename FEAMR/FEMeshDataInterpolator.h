@@ -50,6 +50,12 @@ public:
 	virtual double Map(int inode, std::function<double(int sourceNode)> src) = 0;
 	virtual vec3d MapVec3d(int inode, std::function<vec3d(int sourceNode)> src) = 0;
 
+	//! map several source fields onto the target points in one pass
+	//! input: sval[l] - values of field l at the source points
+	//! output: tval[l] - values of field l at the target points
+	//! The default implementation maps each field separately.
+	virtual bool MapFields(std::vector< std::vector<double> >& tval, const std::vector< std::vector<double> >& sval);
+
 	double Map(std::function<double(int sourceNode)> f);
 	vec3d MapVec3d(std::function<vec3d(int sourceNode)> f);
 };
@@ -50,6 +50,11 @@ bool FEMeshShapeInterpolator::Init()
 
 	int nodes = m_trgPoints.size();
 	m_data.resize(nodes);
+
+	// The octree search does not modify the octree, so the target points
+	// can be located in parallel.
+	bool bok = true;
+#pragma omp parallel for schedule(dynamic, 64) shared(bok)
 	for (int i = 0; i < nodes; ++i)
 	{
 		Data& di = m_data[i];
@@ -61,11 +66,11 @@ bool FEMeshShapeInterpolator::Init()
 		if (di.el == nullptr)
 		{
 			assert(false);
-			return false;
+			bok = false;
 		}
 	}
 
-	return true;
+	return bok;
 }
 
 void FEMeshShapeInterpolator::SetTargetPoints(const vector<vec3d>& trgPoints)
@@ -98,6 +103,37 @@ bool FEMeshShapeInterpolator::Map(std::vector<double>& tval, function<double(int
 	return true;
 }
 
+bool FEMeshShapeInterpolator::MapFields(std::vector< std::vector<double> >& tval, const std::vector< std::vector<double> >& sval)
+{
+	if (tval.size() != sval.size()) return false;
+
+	int NF = (int)sval.size();
+	int nodes = m_trgPoints.size();
+	for (int l = 0; l < NF; ++l) tval[l].resize(nodes);
+
+	// evaluate all fields for each target point, so the element's shape
+	// functions only need to be evaluated once per point
+#pragma omp parallel for
+	for (int i = 0; i < nodes; ++i)
+	{
+		Data& di = m_data[i];
+		int neln = di.el->Nodes();
+
+		double H[FEElement::MAX_NODES];
+		di.el->shape_fnc(H, di.r[0], di.r[1], di.r[2]);
+
+		for (int l = 0; l < NF; ++l)
+		{
+			const std::vector<double>& sl = sval[l];
+			double vl = 0.0;
+			for (int j = 0; j < neln; ++j) vl += H[j] * sl[di.el->m_node[j]];
+			tval[l][i] = vl;
+		}
+	}
+
+	return true;
+}
+
 double FEMeshShapeInterpolator::Map(int inode, function<double(int sourceNode)> f)
 {
 	Data& di = m_data[inode];
@@ -51,6 +51,9 @@ public:
 
 	bool Map(std::vector<double>& tval, std::function<double(int sourceNode)> src) override;
 
+	//! map several source fields at once
+	bool MapFields(std::vector< std::vector<double> >& tval, const std::vector< std::vector<double> >& sval) override;
+
 	double Map(int inode, std::function<double(int sourceNode)> src) override;
 	vec3d MapVec3d(int inode, std::function<vec3d(int sourceNode)> src) override;
 
@@ -26,6 +26,8 @@ SOFTWARE.*/
 #include "stdafx.h"
 #include "FERefineMesh.h"
 #include <FECore/FEModel.h>
+#include <FECore/FEAnalysis.h>
+#include <FECore/FESolver.h>
 #include <FECore/FESolidDomain.h>
 #include <FECore/FEEdgeList.h>
 #include <FECore/FEElementList.h>
@@ -123,6 +125,10 @@ bool FERefineMesh::Apply(int iteration)
 	// update the model
 	UpdateModel();
 
+	// let the solver know which parts of the mesh changed
+	FESolver* solver = fem.GetCurrentStep()->GetFESolver();
+	if (solver && m_meshCopy) solver->SetMeshUpdate(*m_meshCopy, m_nodeOrigin, m_elemOrigin);
+
 	// print some mesh statistics
 	int NN = mesh.Nodes();
 	int NE = mesh.Elements();
@@ -148,6 +154,13 @@ void FERefineMesh::ClearMapData()
 	// clear user maps
 	for (int i = 0; i < m_userDataList.size(); ++i) delete m_userDataList[i];
 	m_userDataList.clear();
+
+	// clear point data
+	m_elemOrigin.clear();
+	m_nodeOrigin.clear();
+	m_pointState.clear();
+	m_pointOffset.clear();
+	m_bytesPerPoint.clear();
 }
 
 bool FERefineMesh::BuildMeshTopo()
@@ -167,7 +180,9 @@ void FERefineMesh::CopyMesh()
 	m_meshCopy->CopyFrom(mesh);
 }
 
-FEDomainMap* createElemDataMap(FEModel& fem, FEDomain& dom, vector<vec3d>& nodePos, FEDomainMap* map, FEMeshDataInterpolator* dataMapper)
+// Map the nodal data to the integration points of the domain. Elements with a non-negative
+// entry in elemOrigin are skipped (the data mapper should not contain their points).
+FEDomainMap* createElemDataMap(FEModel& fem, FEDomain& dom, vector<vec3d>& nodePos, FEDomainMap* map, FEMeshDataInterpolator* dataMapper, const vector<int>& elemOrigin)
 {
 	assert(map->StorageFormat() == Storage_Fmt::FMT_NODE);
 
@@ -188,8 +203,11 @@ FEDomainMap* createElemDataMap(FEModel& fem, FEDomain& dom, vector<vec3d>& nodeP
 	int NMP = 0;
 	for (int i = 0; i < dom.Elements(); ++i)
 	{
-		FEElement& el = dom.ElementRef(i);
-		NMP += el.GaussPoints();
+		if (elemOrigin.empty() || (elemOrigin[i] < 0))
+		{
+			FEElement& el = dom.ElementRef(i);
+			NMP += el.GaussPoints();
+		}
 	}
 
 	int N0 = nodePos.size();
@@ -200,12 +218,12 @@ FEDomainMap* createElemDataMap(FEModel& fem, FEDomain& dom, vector<vec3d>& nodeP
 	eset->Create(&dom);
 	elemData->Create(eset);
 
-	vector<double> srcData(N0);
-	vector<double> trgData(NMP);
+	vector< vector<double> > srcData(dataSize, vector<double>(N0));
+	vector< vector<double> > trgData(dataSize, vector<double>(NMP));
 
 	vector< vector<double> > mappedData(NMP, vector<double>(9, 0.0));
 
-	// loop over all the new nodes
+	// collect the source values of all components
 	for (int l = 0; l < dataSize; ++l)
 	{
 		for (int i = 0; i < N0; ++i)
@@ -239,16 +257,18 @@ FEDomainMap* createElemDataMap(FEModel& fem, FEDomain& dom, vector<vec3d>& nodeP
 			default:
 				assert(false);
 			}
-			srcData[i] = vm;
+			srcData[l][i] = vm;
 		}
+	}
 
-		dataMapper->Map(trgData, [&srcData](int sourcePoint) {
-			return srcData[sourcePoint];
-		});
+	// map all components in one pass
+	dataMapper->MapFields(trgData, srcData);
 
+	for (int l = 0; l < dataSize; ++l)
+	{
 		for (int i = 0; i < NMP; ++i)
 		{
-			mappedData[i][l] = trgData[i];
+			mappedData[i][l] = trgData[l][i];
 		}
 	}
 
@@ -256,6 +276,8 @@ FEDomainMap* createElemDataMap(FEModel& fem, FEDomain& dom, vector<vec3d>& nodeP
 	int n = 0;
 	for (int i = 0; i < dom.Elements(); ++i)
 	{
+		if ((elemOrigin.empty() == false) && (elemOrigin[i] >= 0)) continue;
+
 		FEElement& el = dom.ElementRef(i);
 		int nint = el.GaussPoints();
 		for (int j = 0; j < nint; ++j)
@@ -494,12 +516,12 @@ void NodeToElemData(FEModel& fem, FEDomain& dom, FEDomainMap* nodeMap, FEDomainM
 		NP += el.Nodes();
 	}
 
-	vector<double> srcData(NN);
-	vector<double> trgData(NP);
+	vector< vector<double> > srcData(dataSize, vector<double>(NN));
+	vector< vector<double> > trgData(dataSize, vector<double>(NP));
 
 	vector< vector<double> > mappedData(NP, vector<double>(9, 0.0));
 
-	// loop over all the new nodes
+	// collect the source values of all components
 	for (int l = 0; l < dataSize; ++l)
 	{
 		for (int i = 0; i < NN; ++i)
@@ -533,16 +555,18 @@ void NodeToElemData(FEModel& fem, FEDomain& dom, FEDomainMap* nodeMap, FEDomainM
 			default:
 				assert(false);
 			}
-			srcData[i] = vm;
+			srcData[l][i] = vm;
 		}
+	}
 
-		dataMapper->Map(trgData, [&srcData](int sourcePoint) {
-			return srcData[sourcePoint];
-		});
+	// map all components in one pass
+	dataMapper->MapFields(trgData, srcData);
 
+	for (int l = 0; l < dataSize; ++l)
+	{
 		for (int i = 0; i < NP; ++i)
 		{
-			mappedData[i][l] = trgData[i];
+			mappedData[i][l] = trgData[l][i];
 		}
 	}
 
@@ -614,6 +638,10 @@ bool FERefineMesh::BuildMapData()
 	ClearMapData();
 	m_domainMapList.clear();
 	m_domainMapList.resize(mesh.Domains());
+	m_elemOrigin.resize(mesh.Domains());
+	m_pointState.resize(mesh.Domains());
+	m_pointOffset.resize(mesh.Domains());
+	m_bytesPerPoint.assign(mesh.Domains(), 0);
 
 	// only map domain data if requested
 	if (m_bmap_data)
@@ -661,10 +689,13 @@ bool FERefineMesh::BuildDomainMapData(FEDomain& dom, int domIndex)
 
 	// loop over all integration points
 	int totalPoints = 0;
+	std::vector<int>& pointOffset = m_pointOffset[domIndex];
+	pointOffset.resize(dom.Elements());
 	for (int j = 0; j < dom.Elements(); ++j)
 	{
 		FEElement& el = dom.ElementRef(j);
 		int nint = el.GaussPoints();
+		pointOffset[j] = totalPoints;
 		for (int k = 0; k < nint; ++k)
 		{
 			FEMaterialPoint* mp = el.GetMaterialPoint(k);
@@ -679,6 +710,12 @@ bool FERefineMesh::BuildDomainMapData(FEDomain& dom, int domIndex)
 	size_t bytesPerPoint = bytes / totalPoints;
 	assert((bytes%totalPoints) == 0);
 
+	// keep a copy of the raw data, so we can copy it to unmodified elements
+	ar.Open(false, true);
+	m_bytesPerPoint[domIndex] = bytesPerPoint;
+	m_pointState[domIndex].resize(bytes);
+	if (bytes > 0) ar.read(&m_pointState[domIndex][0], 1, bytes);
+
 	// re-open for reading
 	ar.Open(false, true);
 
@@ -853,6 +890,26 @@ void FERefineMesh::TransferDomainMapData()
 				FEElementSet* elemSet = new FEElementSet(&fem);
 				elemSet->Create(&dom);
 
+				// see which elements were not modified. Their data will be copied directly.
+				vector<int> elemOrigin = m_elemOrigin[i];
+				if ((int)elemOrigin.size() != dom.Elements()) elemOrigin.clear();
+
+				// elements can only be copied if the number of integration points didn't change
+				FEDomain& oldDom = m_meshCopy->Domain(i);
+				for (int j = 0; j < (int)elemOrigin.size(); ++j)
+				{
+					int oldElem = elemOrigin[j];
+					if ((oldElem >= 0) && (oldDom.ElementRef(oldElem).GaussPoints() != dom.ElementRef(j).GaussPoints()))
+						elemOrigin[j] = -1;
+				}
+
+				int newElems = 0;
+				for (int j = 0; j < dom.Elements(); ++j)
+				{
+					if (elemOrigin.empty() || (elemOrigin[j] < 0)) newElems++;
+				}
+				feLog("\t%d of %d elements copied directly.\n", dom.Elements() - newElems, dom.Elements());
+
 				// build source point list
 				FEDomain& oldDomain = m_meshCopy->Domain(i);
 				vector<vec3d> srcPoints; srcPoints.reserve(oldDomain.Nodes());
@@ -862,10 +919,12 @@ void FERefineMesh::TransferDomainMapData()
 					srcPoints.push_back(r);
 				}
 
-				// build target node list
+				// build target node list (only for new elements)
 				vector<vec3d> trgPoints; trgPoints.reserve(dom.Elements());
 				for (int i = 0; i < dom.Elements(); ++i)
 				{
+					if ((elemOrigin.empty() == false) && (elemOrigin[i] >= 0)) continue;
+
 					FEElement& el = dom.ElementRef(i);
 					int nint = el.GaussPoints();
 					for (int j = 0; j < nint; ++j)
@@ -876,61 +935,79 @@ void FERefineMesh::TransferDomainMapData()
 					}
 				}
 
-				// set up mapper
+				// set up mapper (we don't need one if all elements are copied)
 				FEMeshDataInterpolator* mapper = nullptr;
-				switch (m_transferMethod)
-				{
-				case TRANSFER_SHAPE:
+				if (newElems > 0)
 				{
-					FEDomain* oldDomain = &m_meshCopy->Domain(i);
-					FEDomainShapeInterpolator* dsm = new FEDomainShapeInterpolator(oldDomain);
-					dsm->SetTargetPoints(trgPoints);
-					mapper = dsm;
-				}
-				break;
-				case TRANSFER_MLQ:
-				{
-					FELeastSquaresInterpolator* MLQ = new FELeastSquaresInterpolator;
-					MLQ->SetNearestNeighborCount(m_nnc);
-					MLQ->SetDimension(m_nsdim);
-					MLQ->SetSourcePoints(srcPoints);
-					MLQ->SetTargetPoints(trgPoints);
-					mapper = MLQ;
-				}
-				break;
-				default:
-					assert(false);
-					return;
-				}
-				if (mapper->Init() == false)
-				{
-					assert(false);
-					throw std::runtime_error("Failed to initialize LLQ");
+					switch (m_transferMethod)
+					{
+					case TRANSFER_SHAPE:
+					{
+						FEDomain* oldDomain = &m_meshCopy->Domain(i);
+						FEDomainShapeInterpolator* dsm = new FEDomainShapeInterpolator(oldDomain);
+						dsm->SetTargetPoints(trgPoints);
+						mapper = dsm;
+					}
+					break;
+					case TRANSFER_MLQ:
+					{
+						FELeastSquaresInterpolator* MLQ = new FELeastSquaresInterpolator;
+						MLQ->SetNearestNeighborCount(m_nnc);
+						MLQ->SetDimension(m_nsdim);
+						MLQ->SetSourcePoints(srcPoints);
+						MLQ->SetTargetPoints(trgPoints);
+						mapper = MLQ;
+					}
+					break;
+					default:
+						assert(false);
+						return;
+					}
+					if (mapper->Init() == false)
+					{
+						assert(false);
+						throw std::runtime_error("Failed to initialize LLQ");
+					}
 				}
 
 				// loop over all the domain maps
-				vector<FEDomainMap*> elemMapList(mapCount);
-				for (int j = 0; j < mapCount; ++j)
+				vector<FEDomainMap*> elemMapList(mapCount, nullptr);
+				for (int j = 0; (j < mapCount) && mapper; ++j)
 				{
 					feLog("\tMapping map %d ...", j);
 					FEDomainMap* nodeMap = nodeMap_i[j];
 
 					// map node data to integration points
-					FEDomainMap* elemMap = createElemDataMap(fem, dom, srcPoints, nodeMap, mapper);
+					FEDomainMap* elemMap = createElemDataMap(fem, dom, srcPoints, nodeMap, mapper, elemOrigin);
 
 					elemMapList[j] = elemMap;
 					feLog("done.\n");
 				}
 
 				// now we need to reconstruct the data stream
+				// (Type info is written, since it is also present in the copied data.)
 				DumpMemStream ar(fem);
+				ar.WriteTypeInfo(true);
 				ar.Open(true, true);
 
+				const vector<char>& pointState = m_pointState[i];
+				const vector<int>& pointOffset = m_pointOffset[i];
+				size_t bytesPerPoint = m_bytesPerPoint[i];
+
 				for (int j = 0; j < dom.Elements(); ++j)
 				{
 					FEElement& el = dom.ElementRef(j);
 					int nint = el.GaussPoints();
 
+					// unmodified elements get a copy of their old data
+					int oldElem = (elemOrigin.empty() ? -1 : elemOrigin[j]);
+					if (oldElem >= 0)
+					{
+						size_t offset = (size_t)pointOffset[oldElem] * bytesPerPoint;
+						ar.write(&pointState[offset], bytesPerPoint, nint);
+						continue;
+					}
+
 					for (int k = 0; k < nint; ++k)
 					{
 						for (int l = 0; l < mapCount; ++l)
@@ -91,5 +91,21 @@ protected:
 	std::vector< std::vector<FEDomainMap*> >	m_domainMapList;	// list of nodal data for each domain
 	std::vector< FEDomainMap* >	m_userDataList;						// list of nodal data for user-defined mesh data
 
+	// For each domain, the index of the old element that a new element was copied from
+	// without modification, or -1 if the element is new. Derived classes must set this 
+	// in RefineMesh. The material point data of unmodified elements is copied directly
+	// instead of being interpolated. If left empty, all data is interpolated.
+	std::vector< std::vector<int> >	m_elemOrigin;
+
+	// For each node, the index of the old node that it was copied from, or -1 if the node 
+	// is new. Derived classes that keep the old nodes should set this in RefineMesh. The
+	// solver then updates its equation numbers and matrix profile instead of rebuilding them.
+	std::vector<int>	m_nodeOrigin;
+
+	// raw material point data of the old mesh, used for copying unmodified elements
+	std::vector< std::vector<char> >	m_pointState;		// serialized data of all points, per domain
+	std::vector< std::vector<int> >		m_pointOffset;		// index of first point of each old element
+	std::vector< size_t >				m_bytesPerPoint;	// size of serialized data per point
+
 	DECLARE_FECORE_CLASS();
 };
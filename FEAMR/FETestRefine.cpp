@@ -57,6 +57,10 @@ bool FETestRefine::RefineMesh()
 	int NEL = dom.Elements();
 	int N0 = mesh.Nodes();
 
+	// no nodes are added, so all nodes keep their index
+	m_nodeOrigin.resize(N0);
+	for (int i = 0; i < N0; ++i) m_nodeOrigin[i] = i;
+
 	// now we recreate the domains
 	const int NDOM = mesh.Domains();
 	for (int i = 0; i < NDOM; ++i)
@@ -78,11 +82,17 @@ bool FETestRefine::RefineMesh()
 		// reallocate the old domain
 		oldDom.Create(NE0, FEElementLibrary::GetElementSpecFromType(FE_TET4G4));
 
+		// keep track of which elements are copied without modification
+		m_elemOrigin.resize(NDOM);
+		std::vector<int>& elemOrigin = m_elemOrigin[i];
+		elemOrigin.resize(NE0);
+
 		// set new element nodes
 		int nel = 0;
 		for (int j = 0; j < NE0; ++j)
 		{
 			FEElement& el0 = newDom->ElementRef(j);
+			elemOrigin[nel] = j;
 			FEElement& el1 = oldDom.ElementRef(nel++);
 
 			el1.m_node[0] = el0.m_node[0];
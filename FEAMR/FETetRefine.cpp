@@ -62,6 +62,10 @@ bool FETetRefine::RefineMesh()
 	mesh.AddNodes(newNodes);
 	int N1 = N0 + newNodes;
 
+	// the old nodes keep their index
+	m_nodeOrigin.assign(N1, -1);
+	for (int i = 0; i < N0; ++i) m_nodeOrigin[i] = i;
+
 	// update the position of these new nodes
 	int n = N0;
 	for (int i = 0; i < topo.Edges(); ++i)
@@ -138,6 +142,10 @@ bool FETetRefine::RefineMesh()
 		// reallocate the old domain
 		oldDom.Create(8 * NE0, FEElementLibrary::GetElementSpecFromType(FE_TET4G4));
 
+		// all elements are split, so none are copied from the old mesh
+		m_elemOrigin.resize(NDOM);
+		m_elemOrigin[i].assign(8 * NE0, -1);
+
 		// set new element nodes
 		int nel = 0;
 		for (int j = 0; j < NE0; ++j)
@@ -31,6 +31,7 @@ SOFTWARE.*/
 #include "console.h"
 #include "CommandManager.h"
 #include <FECore/log.h>
+#include <FECore/FEProfiler.h>
 #include "console.h"
 #include "breakpoint.h"
 #include <FEBioLib/febio.h>
@@ -163,6 +164,8 @@ int FEBioApp::RunModel()
 	fem.SetDebugLevel(m_ops.ndebug);
 	fem.SetDumpLevel(m_ops.dumpLevel);
 	fem.SetDumpStride(m_ops.dumpStride);
+	fem.SetDumpCompression(m_ops.dumpCompress);
+	fem.SetDumpKeep(m_ops.dumpKeep);
 
 	// set the output filenames
 	fem.SetLogFilename(m_ops.szlog);
@@ -185,9 +188,26 @@ int FEBioApp::RunModel()
 	// solve the model with the task and control file
 	if (nret == 0)
 	{
+		if (m_ops.bprofile)
+		{
+			FEProfiler::Reset();
+			FEProfiler::Enable(true);
+		}
+
 		bool bret = febio::SolveModel(fem, m_ops.sztask, m_ops.szctrl);
 
 		nret = (bret ? 0 : 1);
+
+		// report the profiling results
+		if (m_ops.bprofile)
+		{
+			FEProfiler::Enable(false);
+			FEProfiler::PrintSummary(&fem);
+			if (m_ops.szprof[0] && (FEProfiler::WriteTrace(m_ops.szprof) == false))
+			{
+				fprintf(stderr, "Failed writing profiler trace to %s\n", m_ops.szprof);
+			}
+		}
 	}
 
 	// reset the current model pointer
@@ -253,6 +273,8 @@ bool FEBioApp::ParseCmdLine(int nargs, char* argv[])
 	ops.sztask[0] = 0;
 	ops.szctrl[0] = 0;
 	ops.szimp[0] = 0;
+	ops.szprof[0] = 0;
+	ops.bprofile = false;
 
 	// set initial configuration file name
 	if (ops.szcnf[0] == 0)
@@ -304,6 +326,33 @@ bool FEBioApp::ParseCmdLine(int nargs, char* argv[])
 				return false;
 			}
 		}
+		else if (strncmp(sz, "-dump_compress", 14) == 0)
+		{
+			ops.dumpCompress = 1;
+			if (sz[14] == '=') ops.dumpCompress = atoi(sz + 15);
+			if ((ops.dumpCompress < 0) || (ops.dumpCompress > 9))
+			{
+				fprintf(stderr, "FATAL ERROR: invalid dump compression level.\n");
+				return false;
+			}
+		}
+		else if (strncmp(sz, "-dump_keep", 10) == 0)
+		{
+			if (sz[10] == '=')
+			{
+				ops.dumpKeep = atoi(sz + 11);
+				if (ops.dumpKeep < 1)
+				{
+					fprintf(stderr, "FATAL ERROR: invalid number of dump files to keep.\n");
+					return false;
+				}
+			}
+			else
+			{
+				fprintf(stderr, "FATAL ERROR: missing '=' after -dump_keep.\n");
+				return false;
+			}
+		}
 		else if (strncmp(sz, "-dump", 5) == 0)
 		{
 			ops.dumpLevel = FE_DUMP_MAJOR_ITRS;
@@ -424,6 +473,13 @@ bool FEBioApp::ParseCmdLine(int nargs, char* argv[])
 			brun = false;
 		}
 
+		else if (strncmp(sz, "-profile", 8) == 0)
+		{
+			// collect profiling data and optionally write a trace file
+			ops.bprofile = true;
+			if (sz[8] == '=') strcpy(ops.szprof, sz + 9);
+			else if (sz[8] != 0) { fprintf(stderr, "command line error when parsing profile\n"); return false; }
+		}
 		else if (strcmp(sz, "-import") == 0)
 		{
 			if ((i < nargs - 1) && (argv[i+1][0] != '-'))
@@ -81,7 +81,7 @@ void FEBackFlowFSIStabilization::StiffnessMatrix(FELinearSystem& LS)
 {
     const FETimeInfo& tp = GetTimeInfo();
 
-    m_psurf->LoadStiffness(LS, m_dof, m_dof, [=](FESurfaceMaterialPoint& mp, const FESurfaceDofShape& dof_a, const FESurfaceDofShape& dof_b, matrix& Kab) {
+    m_psurf->LoadStiffnessT(LS, m_dof, m_dof, [=](FESurfaceMaterialPoint& mp, const FESurfaceDofShape& dof_a, const FESurfaceDofShape& dof_b, matrix& Kab) {
 
         FESurfaceElement& el = *mp.SurfaceElement();
 
@@ -80,7 +80,7 @@ void FEBackFlowStabilization::StiffnessMatrix(FELinearSystem& LS)
 {
 	const FETimeInfo& tp = GetTimeInfo();
 
-	m_psurf->LoadStiffness(LS, m_dofW, m_dofW, [=](FESurfaceMaterialPoint& mp, const FESurfaceDofShape& dof_a, const FESurfaceDofShape& dof_b, matrix& Kab) {
+	m_psurf->LoadStiffnessT(LS, m_dofW, m_dofW, [=](FESurfaceMaterialPoint& mp, const FESurfaceDofShape& dof_a, const FESurfaceDofShape& dof_b, matrix& Kab) {
 
 		FESurfaceElement& el = *mp.SurfaceElement();
 
@@ -209,8 +209,9 @@ void FEBiphasicFSIDomain3D::InternalForces(FEGlobalVector& R)
 {
     int NE = (int)m_Elem.size();
 #pragma omp parallel for shared (NE)
-    for (int i=0; i<NE; ++i)
+    for (int n=0; n<NE; ++n)
     {
+        int i = ElementOrder(n);
         // element force vector
         vector<double> fe;
         vector<int> lm;
@@ -663,8 +664,9 @@ void FEBiphasicFSIDomain3D::StiffnessMatrix(FELinearSystem& LS)
     int NE = (int)m_Elem.size();
     
 #pragma omp parallel for shared (NE)
-    for (int iel=0; iel<NE; ++iel)
+    for (int n=0; n<NE; ++n)
     {
+        int iel = ElementOrder(n);
         FESolidElement& el = m_Elem[iel];
         
         if (el.isActive()) {
@@ -697,8 +699,9 @@ void FEBiphasicFSIDomain3D::MassMatrix(FELinearSystem& LS)
     int NE = (int)m_Elem.size();
     
 #pragma omp parallel for shared (NE)
-    for (int iel=0; iel<NE; ++iel)
+    for (int n=0; n<NE; ++n)
     {
+        int iel = ElementOrder(n);
         FESolidElement& el = m_Elem[iel];
         
         if (el.isActive()) {
@@ -896,8 +899,9 @@ void FEBiphasicFSIDomain3D::Update(const FETimeInfo& tp)
     bool berr = false;
     int NE = (int) m_Elem.size();
 #pragma omp parallel for shared(NE, berr)
-    for (int i=0; i<NE; ++i)
+    for (int n=0; n<NE; ++n)
     {
+        int i = ElementOrder(n);
         try
         {
             FESolidElement& el = Element(i);
@@ -1033,8 +1037,9 @@ void FEBiphasicFSIDomain3D::InertialForces(FEGlobalVector& R)
 {
     int NE = (int)m_Elem.size();
 #pragma omp parallel for shared (NE)
-    for (int i=0; i<NE; ++i)
+    for (int n=0; n<NE; ++n)
     {
+        int i = ElementOrder(n);
         // get the element
         FESolidElement& el = m_Elem[i];
         
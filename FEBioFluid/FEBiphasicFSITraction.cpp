@@ -202,7 +202,7 @@ void FEBiphasicFSITraction::StiffnessMatrix(FELinearSystem& LS)
     dofs.AddDof(m_dofEF);
     
     // evaluate stiffness
-    m_psurf->LoadStiffness(LS, dofs, dofs, [&](FESurfaceMaterialPoint& mp, const FESurfaceDofShape& dof_a, const FESurfaceDofShape& dof_b, matrix& Kab) {
+    m_psurf->LoadStiffnessT(LS, dofs, dofs, [&](FESurfaceMaterialPoint& mp, const FESurfaceDofShape& dof_a, const FESurfaceDofShape& dof_b, matrix& Kab) {
         
         FESurfaceElement& el = *mp.SurfaceElement();
         int iel = el.m_lid;
@@ -33,3 +33,10 @@ SOFTWARE.*/
 FEFluidDomain::FEFluidDomain(FEModel* pfem)
 {
 }
+
+//-----------------------------------------------------------------------------
+void FEFluidDomain::InternalForcesAndStiffness(FEGlobalVector& R, FELinearSystem& LS)
+{
+    InternalForces(R);
+    StiffnessMatrix(LS);
+}
@@ -73,6 +73,17 @@ public:
     //! calculate the mass matrix (for dynamic problems)
     virtual void MassMatrix(FELinearSystem& LS) = 0;
     
+    // --- C O M B I N E D ---
+    
+    //! calculate the internal forces and their stiffness contribution in one pass
+    //! (the default implementation calls InternalForces and StiffnessMatrix)
+    virtual void InternalForcesAndStiffness(FEGlobalVector& R, FELinearSystem& LS);
+    
+    //! Keep the material tangents while evaluating the internal forces, so that the next
+    //! stiffness matrix at the same state does not need to evaluate them again.
+    //! (the default implementation ignores this)
+    virtual void KeepTangents(bool b) {}
+    
     //! transient analysis
     void SetTransientAnalysis() { m_btrans = true; }
     void SetSteadyStateAnalysis() { m_btrans = false; }
@@ -45,6 +45,10 @@ FEFluidDomain3D::FEFluidDomain3D(FEModel* pfem) : FESolidDomain(pfem), FEFluidDo
 {
     m_pMat = 0;
     m_btrans = true;
+    
+    m_bkeepTangents = false;
+    m_btangents = false;
+    m_ntng = 0;
 
 	if (pfem)
 	{
@@ -105,6 +109,9 @@ void FEFluidDomain3D::SetMaterial(FEMaterial* pmat)
 //! Initialize element data
 void FEFluidDomain3D::PreSolveUpdate(const FETimeInfo& timeInfo)
 {
+    // the stored tangents are no longer valid
+    m_btangents = false;
+    
     const int NE = FEElement::MAX_NODES;
     vec3d x0[NE], r0, v;
     FEMesh& m = *GetMesh();
@@ -138,9 +145,20 @@ void FEFluidDomain3D::PreSolveUpdate(const FETimeInfo& timeInfo)
 void FEFluidDomain3D::InternalForces(FEGlobalVector& R)
 {
     int NE = (int)m_Elem.size();
+    
+    // allocate storage for the material tangents
+    m_btangents = false;
+    if (m_bkeepTangents)
+    {
+        m_ntng = 0;
+        for (int i=0; i<NE; ++i) m_ntng = std::max(m_ntng, m_Elem[i].GaussPoints());
+        m_tng.resize((size_t)NE*m_ntng);
+    }
+    
 #pragma omp parallel for shared (NE)
-    for (int i=0; i<NE; ++i)
+    for (int ie=0; ie<NE; ++ie)
     {
+        int i = ElementOrder(ie);
         // element force vector
         vector<double> fe;
         vector<int> lm;
@@ -153,7 +171,8 @@ void FEFluidDomain3D::InternalForces(FEGlobalVector& R)
         fe.assign(ndof, 0);
         
         // calculate internal force vector
-        ElementInternalForce(el, fe);
+        FluidTangents* tng = (m_bkeepTangents ? &m_tng[(size_t)i*m_ntng] : nullptr);
+        ElementInternalForce(el, fe, tng);
         
         // get the element's LM vector
         UnpackLM(el, lm);
@@ -161,12 +180,23 @@ void FEFluidDomain3D::InternalForces(FEGlobalVector& R)
         // assemble element 'fe'-vector into global R vector
         R.Assemble(el.m_node, lm, fe);
     }
+    
+    // the tangents can now be used by the stiffness matrix, until the state is updated
+    m_btangents = m_bkeepTangents;
+}
+
+//-----------------------------------------------------------------------------
+void FEFluidDomain3D::KeepTangents(bool b)
+{
+    m_bkeepTangents = b;
+    m_btangents = false;
+    if (b == false) m_tng.clear();
 }
 
 //-----------------------------------------------------------------------------
 //! calculates the internal equivalent nodal forces for solid elements
 
-void FEFluidDomain3D::ElementInternalForce(FESolidElement& el, vector<double>& fe)
+void FEFluidDomain3D::ElementInternalForce(FESolidElement& el, vector<double>& fe, FluidTangents* tng)
 {
     int i, n;
     
@@ -202,7 +232,18 @@ void FEFluidDomain3D::ElementInternalForce(FESolidElement& el, vector<double>& f
         // get the viscous stress tensor for this integration point
         sv = m_pMat->GetViscous()->Stress(mp);
         // get the gradient of the elastic pressure
-        gradp = pt.m_gradef*m_pMat->Tangent_Pressure_Strain(mp);
+        double dp = m_pMat->Tangent_Pressure_Strain(mp);
+        gradp = pt.m_gradef*dp;
+        
+        // store the tangents for the stiffness matrix
+        if (tng)
+        {
+            FluidTangents& t = tng[n];
+            t.svJ = m_pMat->GetViscous()->Tangent_Strain(mp);
+            t.cv = m_pMat->Tangent_RateOfDeformation(mp);
+            t.dp = dp;
+            t.d2p = m_pMat->Tangent_Pressure_Strain_Strain(mp);
+        }
         
         H = el.H(n);
         Gr = el.Gr(n);
@@ -363,7 +404,7 @@ void FEFluidDomain3D::ElementBodyForceStiffness(FEBodyForce& BF, FESolidElement
 //-----------------------------------------------------------------------------
 //! Calculates element material stiffness element matrix
 
-void FEFluidDomain3D::ElementStiffness(FESolidElement &el, matrix &ke)
+void FEFluidDomain3D::ElementStiffness(FESolidElement &el, matrix &ke, const FluidTangents* tng)
 {
     const FETimeInfo& tp = GetFEModel()->GetTime();
     int i, i4, j, j4, n;
@@ -408,10 +449,22 @@ void FEFluidDomain3D::ElementStiffness(FESolidElement &el, matrix &ke)
         double Jf = 1 + pt.m_ef;
         
         // get the tangents
-        mat3ds svJ = m_pMat->GetViscous()->Tangent_Strain(mp);
-        tens4ds cv = m_pMat->Tangent_RateOfDeformation(mp);
-        double dp = m_pMat->Tangent_Pressure_Strain(mp);
-        double d2p = m_pMat->Tangent_Pressure_Strain_Strain(mp);
+        // (unless they were already evaluated with the internal forces)
+        mat3ds svJ; tens4ds cv; double dp, d2p;
+        if (tng)
+        {
+            svJ = tng[n].svJ;
+            cv = tng[n].cv;
+            dp = tng[n].dp;
+            d2p = tng[n].d2p;
+        }
+        else
+        {
+            svJ = m_pMat->GetViscous()->Tangent_Strain(mp);
+            cv = m_pMat->Tangent_RateOfDeformation(mp);
+            dp = m_pMat->Tangent_Pressure_Strain(mp);
+            d2p = m_pMat->Tangent_Pressure_Strain_Strain(mp);
+        }
         // Jdot/J
         double dJoJ = pt.m_efdot/Jf;
         
@@ -460,8 +513,9 @@ void FEFluidDomain3D::StiffnessMatrix(FELinearSystem& LS)
     int NE = (int)m_Elem.size();
     
 #pragma omp parallel for shared (NE)
-    for (int iel=0; iel<NE; ++iel)
+    for (int ie=0; ie<NE; ++ie)
     {
+		int iel = ElementOrder(ie);
 		FESolidElement& el = m_Elem[iel];
 
         // element stiffness matrix
@@ -473,7 +527,9 @@ void FEFluidDomain3D::StiffnessMatrix(FELinearSystem& LS)
         ke.zero();
         
         // calculate material stiffness
-        ElementStiffness(el, ke);
+        // (using the tangents of the last residual evaluation, if available)
+        const FluidTangents* tng = (m_btangents ? &m_tng[(size_t)iel*m_ntng] : nullptr);
+        ElementStiffness(el, ke, tng);
         
         // get the element's LM vector
 		vector<int> lm;
@@ -485,6 +541,145 @@ void FEFluidDomain3D::StiffnessMatrix(FELinearSystem& LS)
     }
 }
 
+//-----------------------------------------------------------------------------
+void FEFluidDomain3D::InternalForcesAndStiffness(FEGlobalVector& R, FELinearSystem& LS)
+{
+    int NE = (int)m_Elem.size();
+#pragma omp parallel for shared (NE)
+    for (int ie=0; ie<NE; ++ie)
+    {
+        int iel = ElementOrder(ie);
+        FESolidElement& el = m_Elem[iel];
+        
+        // element force vector and stiffness matrix
+        vector<double> fe;
+        FEElementMatrix ke(el);
+        
+        int ndof = 4*el.Nodes();
+        fe.assign(ndof, 0);
+        ke.resize(ndof, ndof);
+        ke.zero();
+        
+        // calculate internal force vector and material stiffness
+        ElementInternalForceAndStiffness(el, fe, ke);
+        
+        // get the element's LM vector
+        vector<int> lm;
+        UnpackLM(el, lm);
+        ke.SetIndices(lm);
+        
+        // assemble into global vector and matrix
+        R.Assemble(el.m_node, lm, fe);
+        LS.Assemble(ke);
+    }
+}
+
+//-----------------------------------------------------------------------------
+//! This evaluates the same quantities as ElementInternalForce and ElementStiffness,
+//! but the kinematics and material response are only evaluated once per integration point.
+void FEFluidDomain3D::ElementInternalForceAndStiffness(FESolidElement& el, vector<double>& fe, matrix& ke)
+{
+    const FETimeInfo& tp = GetFEModel()->GetTime();
+    int i, i4, j, j4, n;
+    
+    const int nint = el.GaussPoints();
+    const int neln = el.Nodes();
+    
+    // gradient of shape functions
+    vector<vec3d> gradN(neln);
+    
+    double dt = tp.timeIncrement;
+    double ksi = tp.alpham/(tp.gamma*tp.alphaf);
+    
+    const double *H, *Gr, *Gs, *Gt;
+    
+    // jacobian
+    double Ji[3][3], detJ;
+    
+    // weights at gauss points
+    const double *gw = el.GaussWeights();
+    
+    for (n=0; n<nint; ++n)
+    {
+        FEMaterialPoint& mp = *el.GetMaterialPoint(n);
+        FEFluidMaterialPoint& pt = *(mp.ExtractData<FEFluidMaterialPoint>());
+        double Jf = 1 + pt.m_ef;
+        
+        // calculate the jacobian
+        detJ = invjac0(el, Ji, n)*gw[n];
+        double detJk = detJ*tp.alphaf;
+        
+        vec3d g1(Ji[0][0],Ji[0][1],Ji[0][2]);
+        vec3d g2(Ji[1][0],Ji[1][1],Ji[1][2]);
+        vec3d g3(Ji[2][0],Ji[2][1],Ji[2][2]);
+        
+        H = el.H(n);
+        Gr = el.Gr(n);
+        Gs = el.Gs(n);
+        Gt = el.Gt(n);
+        
+        // evaluate spatial gradient of shape functions
+        for (i=0; i<neln; ++i)
+            gradN[i] = g1*Gr[i] + g2*Gs[i] + g3*Gt[i];
+        
+        // material response
+        mat3ds sv = m_pMat->GetViscous()->Stress(mp);
+        mat3ds svJ = m_pMat->GetViscous()->Tangent_Strain(mp);
+        tens4ds cv = m_pMat->Tangent_RateOfDeformation(mp);
+        double dp = m_pMat->Tangent_Pressure_Strain(mp);
+        double d2p = m_pMat->Tangent_Pressure_Strain_Strain(mp);
+        
+        // gradient of the elastic pressure
+        vec3d gradp = pt.m_gradef*dp;
+        
+        // Jdot/J
+        double dJoJ = pt.m_efdot/Jf;
+        
+        for (i=0, i4=0; i<neln; ++i, i4 += 4)
+        {
+            // internal force
+            // the '-' sign is so that the internal forces get subtracted
+            // from the global residual vector
+            vec3d fs = sv*gradN[i] + gradp*H[i];
+            double fJ = dJoJ*H[i] + gradN[i]*pt.m_vft;
+            
+            fe[i4  ] -= fs.x*detJ;
+            fe[i4+1] -= fs.y*detJ;
+            fe[i4+2] -= fs.z*detJ;
+            fe[i4+3] -= fJ*detJ;
+            
+            // stiffness matrix
+            for (j=0, j4 = 0; j<neln; ++j, j4 += 4)
+            {
+                mat3d Kvv = vdotTdotv(gradN[i], cv, gradN[j]);
+                vec3d kJv = (pt.m_gradef*(H[i]/Jf) + gradN[i])*H[j];
+                vec3d kvJ = (svJ*gradN[i])*H[j] + (gradN[j]*dp+pt.m_gradef*(H[j]*d2p))*H[i];
+                double kJJ = (H[j]*(ksi/dt - dJoJ) + gradN[j]*pt.m_vft)*H[i]/Jf;
+                
+                ke[i4  ][j4  ] += Kvv(0,0)*detJk;
+                ke[i4  ][j4+1] += Kvv(0,1)*detJk;
+                ke[i4  ][j4+2] += Kvv(0,2)*detJk;
+                ke[i4  ][j4+3] += kvJ.x*detJk;
+                
+                ke[i4+1][j4  ] += Kvv(1,0)*detJk;
+                ke[i4+1][j4+1] += Kvv(1,1)*detJk;
+                ke[i4+1][j4+2] += Kvv(1,2)*detJk;
+                ke[i4+1][j4+3] += kvJ.y*detJk;
+                
+                ke[i4+2][j4  ] += Kvv(2,0)*detJk;
+                ke[i4+2][j4+1] += Kvv(2,1)*detJk;
+                ke[i4+2][j4+2] += Kvv(2,2)*detJk;
+                ke[i4+2][j4+3] += kvJ.z*detJk;
+                
+                ke[i4+3][j4  ] += kJv.x*detJk;
+                ke[i4+3][j4+1] += kJv.y*detJk;
+                ke[i4+3][j4+2] += kJv.z*detJk;
+                ke[i4+3][j4+3] += kJJ*detJk;
+            }
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 void FEFluidDomain3D::MassMatrix(FELinearSystem& LS)
 {
@@ -492,8 +687,9 @@ void FEFluidDomain3D::MassMatrix(FELinearSystem& LS)
     int NE = (int)m_Elem.size();
 
 #pragma omp parallel for shared(NE)
-    for (int iel=0; iel<NE; ++iel)
+    for (int ie=0; ie<NE; ++ie)
     {
+		int iel = ElementOrder(ie);
 		FESolidElement& el = m_Elem[iel];
 
         // element stiffness matrix
@@ -631,11 +827,15 @@ void FEFluidDomain3D::ElementMassMatrix(FESolidElement& el, matrix& ke)
 //-----------------------------------------------------------------------------
 void FEFluidDomain3D::Update(const FETimeInfo& tp)
 {
+    // the stored tangents are no longer valid
+    m_btangents = false;
+    
     bool berr = false;
     int NE = (int) m_Elem.size();
 #pragma omp parallel for shared(NE, berr)
-    for (int i=0; i<NE; ++i)
+    for (int n=0; n<NE; ++n)
     {
+        int i = ElementOrder(n);
         try
         {
             UpdateElementStress(i, tp);
@@ -719,8 +919,9 @@ void FEFluidDomain3D::InertialForces(FEGlobalVector& R)
 {
     int NE = (int)m_Elem.size();
 #pragma omp parallel for shared(NE)
-    for (int i=0; i<NE; ++i)
+    for (int ie=0; ie<NE; ++ie)
     {
+        int i = ElementOrder(ie);
         // element force vector
         vector<double> fe;
         vector<int> lm;
@@ -36,6 +36,16 @@ SOFTWARE.*/
 //!
 class FEBIOFLUID_API FEFluidDomain3D : public virtual FESolidDomain, public FEFluidDomain
 {
+public:
+    // material tangents at an integration point
+    struct FluidTangents
+    {
+        mat3ds  svJ;    // viscous stress tangent w.r.t. dilatation
+        tens4ds cv;     // tangent w.r.t. rate of deformation
+        double  dp;     // pressure tangent w.r.t. dilatation
+        double  d2p;    // second pressure tangent w.r.t. dilatation
+    };
+    
 public:
     //! constructor
     FEFluidDomain3D(FEModel* pfem);
@@ -87,11 +97,18 @@ public: // overrides from FEElasticDomain
     //! body force stiffness
     void BodyForceStiffness(FELinearSystem& LS, FEBodyForce& bf) override;
     
+    //! internal forces and stiffness matrix in one pass
+    void InternalForcesAndStiffness(FEGlobalVector& R, FELinearSystem& LS) override;
+    
+    //! keep the material tangents that are evaluated with the internal forces
+    void KeepTangents(bool b) override;
+    
 public:
     // --- S T I F F N E S S ---
     
     //! calculates the solid element stiffness matrix
-    void ElementStiffness(FESolidElement& el, matrix& ke);
+    //! (the material tangents are evaluated unless they are passed in)
+    void ElementStiffness(FESolidElement& el, matrix& ke, const FluidTangents* tng = nullptr);
     
     //! calculates the solid element mass matrix
     void ElementMassMatrix(FESolidElement& el, matrix& ke);
@@ -102,7 +119,8 @@ public:
     // --- R E S I D U A L ---
     
     //! Calculates the internal stress vector for solid elements
-    void ElementInternalForce(FESolidElement& el, vector<double>& fe);
+    //! (if tng is not null, the material tangents are stored as well)
+    void ElementInternalForce(FESolidElement& el, vector<double>& fe, FluidTangents* tng = nullptr);
     
     //! Calculates external body forces for solid elements
     void ElementBodyForce(FEBodyForce& BF, FESolidElement& elem, vector<double>& fe);
@@ -110,9 +128,21 @@ public:
     //! Calculates the inertial force vector for solid elements
     void ElementInertialForce(FESolidElement& el, vector<double>& fe);
     
+    // --- C O M B I N E D ---
+    
+    //! Calculates the internal stress vector and the material stiffness matrix in one pass
+    void ElementInternalForceAndStiffness(FESolidElement& el, vector<double>& fe, matrix& ke);
+    
 protected:
     FEFluid*	m_pMat;
     
+protected:
+    // material tangents at the integration points (see KeepTangents)
+    bool                    m_bkeepTangents;    //!< evaluate tangents with the internal forces
+    bool                    m_btangents;        //!< m_tng is valid for the current state
+    int                     m_ntng;             //!< nr of tangents per element
+    vector<FluidTangents>   m_tng;
+    
 protected:
 	FEDofList	m_dofW;
 	FEDofList	m_dofAW;
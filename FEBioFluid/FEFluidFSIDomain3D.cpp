@@ -195,8 +195,9 @@ void FEFluidFSIDomain3D::InternalForces(FEGlobalVector& R)
 {
     int NE = (int)m_Elem.size();
 #pragma omp parallel for shared (NE)
-    for (int i=0; i<NE; ++i)
+    for (int n=0; n<NE; ++n)
     {
+        int i = ElementOrder(n);
         // element force vector
         vector<double> fe;
         vector<int> lm;
@@ -573,8 +574,9 @@ void FEFluidFSIDomain3D::StiffnessMatrix(FELinearSystem& LS)
     int NE = (int)m_Elem.size();
     
 #pragma omp parallel for shared (NE)
-    for (int iel=0; iel<NE; ++iel)
+    for (int n=0; n<NE; ++n)
     {
+        int iel = ElementOrder(n);
         FESolidElement& el = m_Elem[iel];
         
         if (el.isActive()) {
@@ -607,8 +609,9 @@ void FEFluidFSIDomain3D::MassMatrix(FELinearSystem& LS)
     int NE = (int)m_Elem.size();
     
 #pragma omp parallel for shared (NE)
-    for (int iel=0; iel<NE; ++iel)
+    for (int n=0; n<NE; ++n)
     {
+        int iel = ElementOrder(n);
         FESolidElement& el = m_Elem[iel];
         
         if (el.isActive()) {
@@ -642,8 +645,9 @@ void FEFluidFSIDomain3D::BodyForceStiffness(FELinearSystem& LS, FEBodyForce& bf)
     // repeat over all solid elements
     int NE = (int)m_Elem.size();
 #pragma omp parallel for shared (NE)
-    for (int iel=0; iel<NE; ++iel)
+    for (int n=0; n<NE; ++n)
     {
+        int iel = ElementOrder(n);
         FESolidElement& el = m_Elem[iel];
         
         if (el.isActive()) {
@@ -762,8 +766,9 @@ void FEFluidFSIDomain3D::Update(const FETimeInfo& tp)
     bool berr = false;
     int NE = (int) m_Elem.size();
 #pragma omp parallel for shared(NE, berr)
-    for (int i=0; i<NE; ++i)
+    for (int n=0; n<NE; ++n)
     {
+        int i = ElementOrder(n);
         try
         {
             FESolidElement& el = Element(i);
@@ -886,8 +891,9 @@ void FEFluidFSIDomain3D::InertialForces(FEGlobalVector& R)
 {
     int NE = (int)m_Elem.size();
 #pragma omp parallel for shared (NE)
-    for (int i=0; i<NE; ++i)
+    for (int n=0; n<NE; ++n)
     {
+        int i = ElementOrder(n);
         // get the element
         FESolidElement& el = m_Elem[i];
         
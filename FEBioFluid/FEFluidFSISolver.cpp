@@ -1114,6 +1114,7 @@ bool FEFluidFSISolver::StiffnessMatrix()
     FEMesh& mesh = fem.GetMesh();
 
 	FESolidLinearSystem LS(this, &m_rigidSolver, *m_pK, m_Fd, m_ui, (m_msymm == REAL_SYMMETRIC), m_alphaf, m_nreq);
+	m_rigidSolver.BeginRigidAssembly(m_alphaf);
     
     // calculate the stiffness matrix for each domain
     for (int i=0; i<mesh.Domains(); ++i)
@@ -1205,6 +1206,9 @@ bool FEFluidFSISolver::StiffnessMatrix()
     // constraints enforced with augmented lagrangian
     NonLinearConstraintStiffness(LS, tp);    
    
+    // add the buffered rigid body coupling terms
+    m_rigidSolver.EndRigidAssembly(*m_pK, m_Fd);
+
     // add contributions from rigid bodies
     m_rigidSolver.StiffnessMatrix(*m_pK, tp);
     
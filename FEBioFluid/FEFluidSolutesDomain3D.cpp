@@ -294,8 +294,9 @@ void FEFluidSolutesDomain3D::InternalForces(FEGlobalVector& R)
     int ndpn = 4+nsol;
     
 #pragma omp parallel for shared (NE)
-    for (int i=0; i<NE; ++i)
+    for (int ie=0; ie<NE; ++ie)
     {
+        int i = ElementOrder(ie);
         // element force vector
         vector<double> fe;
         vector<int> lm;
@@ -884,8 +885,9 @@ void FEFluidSolutesDomain3D::StiffnessMatrix(FELinearSystem& LS)
     int NE = (int)m_Elem.size();
     
 #pragma omp parallel for shared (NE)
-    for (int iel=0; iel<NE; ++iel)
+    for (int ie=0; ie<NE; ++ie)
     {
+        int iel = ElementOrder(ie);
         FESolidElement& el = m_Elem[iel];
         
         // element stiffness matrix
@@ -918,8 +920,9 @@ void FEFluidSolutesDomain3D::MassMatrix(FELinearSystem& LS)
     int NE = (int)m_Elem.size();
     
 #pragma omp parallel for shared (NE)
-    for (int iel=0; iel<NE; ++iel)
+    for (int ie=0; ie<NE; ++ie)
     {
+        int iel = ElementOrder(ie);
         FESolidElement& el = m_Elem[iel];
         
         // element stiffness matrix
@@ -1066,8 +1069,9 @@ void FEFluidSolutesDomain3D::Update(const FETimeInfo& tp)
     bool berr = false;
     int NE = (int) m_Elem.size();
 #pragma omp parallel for shared(NE, berr)
-    for (int i=0; i<NE; ++i)
+    for (int n=0; n<NE; ++n)
     {
+        int i = ElementOrder(n);
         try
         {
             UpdateElementStress(i, tp);
@@ -1191,8 +1195,9 @@ void FEFluidSolutesDomain3D::InertialForces(FEGlobalVector& R)
 {
     int NE = (int)m_Elem.size();
 #pragma omp parallel for shared (NE)
-    for (int i=0; i<NE; ++i)
+    for (int ie=0; ie<NE; ++ie)
     {
+        int i = ElementOrder(ie);
         // element force vector
         vector<double> fe;
         vector<int> lm;
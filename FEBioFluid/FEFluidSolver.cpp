@@ -51,6 +51,8 @@ SOFTWARE.*/
 #include <FECore/FELinearConstraintManager.h>
 #include <FECore/FENLConstraint.h>
 #include <FECore/FELinearSystem.h>
+#include <FECore/FEProfiler.h>
+#include <FECore/FEModifiedNewtonStrategy.h>
 #include "FEBioFluid.h"
 #include "FEFluidAnalysis.h"
 
@@ -89,6 +91,9 @@ FEFluidSolver::FEFluidSolver(FEModel* pfem) : FENewtonSolver(pfem), m_dofW(pfem)
 
     m_rhoi = 0;
     m_pred = 0;
+
+    m_bfuse = false;
+    m_bRint = false;
     
 	// Preferred strategy is Broyden's method
 	SetDefaultStrategy(QN_BROYDEN);
@@ -476,6 +481,9 @@ void FEFluidSolver::Update2(const vector<double>& ui)
 
 	// update model state
 	GetFEModel()->Update();
+
+	// cached internal forces are no longer valid
+	m_bRint = false;
 }
 
 //-----------------------------------------------------------------------------
@@ -485,6 +493,9 @@ void FEFluidSolver::Update(vector<double>& ui)
     FEModel& fem = *GetFEModel();
     FETimeInfo& tp = fem.GetTime();
     tp.currentIteration = m_niter;
+
+    // cached internal forces are no longer valid
+    m_bRint = false;
     
     // update kinematics
     UpdateKinematics(ui);
@@ -538,6 +549,9 @@ void FEFluidSolver::PrepStep()
 	double dt = tp.timeIncrement;
     tp.currentIteration = m_niter;
 
+    // cached internal forces are no longer valid
+    m_bRint = false;
+
     // zero total DOFs
     zero(m_Ui);
     zero(m_Vi);
@@ -669,8 +683,24 @@ bool FEFluidSolver::Quasin()
 	const FETimeInfo& tp = fem.GetTime();
     PrepStep();
     
+	// When the stiffness matrix is reformed at every iteration (i.e. full Newton, or 
+	// quasi-Newton with max_ups = 0), this happens at the state of the last residual.
+	// In that case, the domains keep the material tangents that they evaluate with the
+	// internal forces, so they are not evaluated again for the stiffness matrix.
+	bool bkeep = m_bdoreforms && (m_qnstrategy->m_maxups == 0) && (dynamic_cast<FEModifiedNewtonStrategy*>(m_qnstrategy) == nullptr);
+	FEMesh& mesh = fem.GetMesh();
+	for (int i=0; i<mesh.Domains(); ++i)
+	{
+		FEFluidDomain& dom = dynamic_cast<FEFluidDomain&>(mesh.Domain(i));
+		dom.KeepTangents(bkeep);
+	}
+    
 	// Init QN method
-	if (QNInit() == false) return false;
+	// (the residual is evaluated right after the reformation, so we can use the internal forces)
+	m_bfuse = true;
+	bool binit = QNInit();
+	m_bfuse = false;
+	if (binit == false) return false;
     
     // loop until converged or when max nr of reformations reached
 	bool bconv = false; // convergence flag
@@ -830,10 +860,29 @@ bool FEFluidSolver::StiffnessMatrix(FELinearSystem& LS)
     FEMesh& mesh = fem.GetMesh();
     
     // calculate the stiffness matrix for each domain
-    for (int i=0; i<mesh.Domains(); ++i)
+    if (m_bfuse)
     {
-        FEFluidDomain& dom = dynamic_cast<FEFluidDomain&>(mesh.Domain(i));
-        dom.StiffnessMatrix(LS);
+        // evaluate the internal forces in the same pass, so they can be used
+        // by the next residual evaluation
+        m_Rint.assign(m_neq, 0.0);
+        m_Frint.assign(m_Fr.size(), 0.0);
+        FEFluidResidualVector RHS(fem, m_Rint, m_Frint);
+        for (int i=0; i<mesh.Domains(); ++i)
+        {
+            PROFILE_SCOPE(&mesh.Domain(i));
+            FEFluidDomain& dom = dynamic_cast<FEFluidDomain&>(mesh.Domain(i));
+            dom.InternalForcesAndStiffness(RHS, LS);
+        }
+        m_bRint = true;
+    }
+    else
+    {
+        for (int i=0; i<mesh.Domains(); ++i)
+        {
+            PROFILE_SCOPE(&mesh.Domain(i));
+            FEFluidDomain& dom = dynamic_cast<FEFluidDomain&>(mesh.Domain(i));
+            dom.StiffnessMatrix(LS);
+        }
     }
     
     // calculate the body force stiffness matrix for each domain
@@ -843,6 +892,7 @@ bool FEFluidSolver::StiffnessMatrix(FELinearSystem& LS)
 		FEBodyForce* pbf = dynamic_cast<FEBodyForce*>(fem.ModelLoad(j));
 		if (pbf && pbf->IsActive())
 		{
+			PROFILE_SCOPE(pbf);
 			for (int i = 0; i<pbf->Domains(); ++i)
 			{
 				FEFluidDomain& dom = dynamic_cast<FEFluidDomain&>(*pbf->Domain(i));
@@ -859,7 +909,7 @@ bool FEFluidSolver::StiffnessMatrix(FELinearSystem& LS)
     for (int i=0; i<nsl; ++i)
     {
         FEModelLoad* pml = fem.ModelLoad(i);
-        if (pml->IsActive()) pml->StiffnessMatrix(LS);
+        if (pml->IsActive()) { PROFILE_SCOPE(pml); pml->StiffnessMatrix(LS); }
 //        if (pml->IsActive() && HasActiveDofs(pml->GetDofList())) pml->StiffnessMatrix(LS);
     }
     
@@ -867,6 +917,7 @@ bool FEFluidSolver::StiffnessMatrix(FELinearSystem& LS)
     // loop over all domains
     for (int i=0; i<mesh.Domains(); ++i)
     {
+        PROFILE_SCOPE(&mesh.Domain(i));
         FEFluidDomain& dom = dynamic_cast<FEFluidDomain&>(mesh.Domain(i));
         dom.MassMatrix(LS);
     }
@@ -889,7 +940,7 @@ void FEFluidSolver::NonLinearConstraintStiffness(FELinearSystem& LS, const FETim
     for (int i=0; i<N; ++i)
     {
         FENLConstraint* plc = fem.NonlinearConstraint(i);
-        if (plc->IsActive()) plc->StiffnessMatrix(LS, tp);
+        if (plc->IsActive()) { PROFILE_SCOPE(plc); plc->StiffnessMatrix(LS, tp); }
     }
 }
 
@@ -904,7 +955,7 @@ void FEFluidSolver::ContactStiffness(FELinearSystem& LS)
     for (int i = 0; i<fem.SurfacePairConstraints(); ++i)
     {
         FEContactInterface* pci = dynamic_cast<FEContactInterface*>(fem.SurfacePairConstraint(i));
-        if (pci->IsActive()) pci->StiffnessMatrix(LS, tp);
+        if (pci->IsActive()) { PROFILE_SCOPE(pci); pci->StiffnessMatrix(LS, tp); }
     }
 }
 
@@ -918,7 +969,7 @@ void FEFluidSolver::ContactForces(FEGlobalVector& R)
     for (int i = 0; i<fem.SurfacePairConstraints(); ++i)
     {
         FEContactInterface* pci = dynamic_cast<FEContactInterface*>(fem.SurfacePairConstraint(i));
-        if (pci->IsActive()) pci->LoadVector(R, tp);
+        if (pci->IsActive()) { PROFILE_SCOPE(pci); pci->LoadVector(R, tp); }
     }
 }
 
@@ -948,10 +999,21 @@ bool FEFluidSolver::Residual(vector<double>& R)
     FEMesh& mesh = fem.GetMesh();
     
     // calculate the internal (stress) forces
-    for (int i=0; i<mesh.Domains(); ++i)
+    if (m_bRint)
     {
-        FEFluidDomain& dom = dynamic_cast<FEFluidDomain&>(mesh.Domain(i));
-        dom.InternalForces(RHS);
+        // these were already evaluated during the stiffness matrix assembly
+        R += m_Rint;
+        m_Fr += m_Frint;
+        m_bRint = false;
+    }
+    else
+    {
+        for (int i=0; i<mesh.Domains(); ++i)
+        {
+            PROFILE_SCOPE(&mesh.Domain(i));
+            FEFluidDomain& dom = dynamic_cast<FEFluidDomain&>(mesh.Domain(i));
+            dom.InternalForces(RHS);
+        }
     }
     
     // calculate the body forces
@@ -960,6 +1022,7 @@ bool FEFluidSolver::Residual(vector<double>& R)
 		FEBodyForce* pbf = dynamic_cast<FEBodyForce*>(fem.ModelLoad(j));
 		if (pbf && pbf->IsActive())
 		{
+			PROFILE_SCOPE(pbf);
 			for (int i = 0; i<pbf->Domains(); ++i)
 			{
 				FEFluidDomain& dom = dynamic_cast<FEFluidDomain&>(*pbf->Domain(i));
@@ -971,6 +1034,7 @@ bool FEFluidSolver::Residual(vector<double>& R)
     // calculate inertial forces
     for (int i=0; i<mesh.Domains(); ++i)
     {
+        PROFILE_SCOPE(&mesh.Domain(i));
         FEFluidDomain& dom = dynamic_cast<FEFluidDomain&>(mesh.Domain(i));
         dom.InertialForces(RHS);
     }
@@ -990,6 +1054,7 @@ bool FEFluidSolver::Residual(vector<double>& R)
         FEModelLoad& mli = *fem.ModelLoad(i);
         if (mli.IsActive())
         {
+            PROFILE_SCOPE(&mli);
             mli.LoadVector(RHS);
         }
     }
@@ -1025,7 +1090,7 @@ void FEFluidSolver::NonLinearConstraintForces(FEGlobalVector& R, const FETimeInf
     for (int i=0; i<N; ++i)
     {
         FENLConstraint* plc = fem.NonlinearConstraint(i);
-        if (plc->IsActive()) plc->LoadVector(R, tp);
+        if (plc->IsActive()) { PROFILE_SCOPE(plc); plc->LoadVector(R, tp); }
     }
 }
 
@@ -139,6 +139,13 @@ public:
     double  m_gammaf;       //!< gamma
     int     m_pred;         //!< predictor method
 
+protected:
+    // internal forces that are evaluated together with the stiffness matrix
+    bool            m_bfuse;    //!< evaluate internal forces during stiffness assembly
+    bool            m_bRint;    //!< m_Rint and m_Frint are valid for the current state
+    vector<double>  m_Rint;     //!< internal forces
+    vector<double>  m_Frint;    //!< internal forces on prescribed dofs
+
 protected:
     FEDofList	m_dofW;
 	FEDofList	m_dofAW;
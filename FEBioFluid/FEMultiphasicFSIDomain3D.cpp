@@ -383,8 +383,9 @@ void FEMultiphasicFSIDomain3D::InternalForces(FEGlobalVector& R)
     int ndpn = 7+nsol;
     
 #pragma omp parallel for shared (NE)
-    for (int i=0; i<NE; ++i)
+    for (int n=0; n<NE; ++n)
     {
+        int i = ElementOrder(n);
         // element force vector
         vector<double> fe;
         vector<int> lm;
@@ -1247,8 +1248,9 @@ void FEMultiphasicFSIDomain3D::StiffnessMatrix(FELinearSystem& LS)
     int ndpn = 7 + nsol;
     
 #pragma omp parallel for shared (NE)
-    for (int iel=0; iel<NE; ++iel)
+    for (int n=0; n<NE; ++n)
     {
+        int iel = ElementOrder(n);
         FESolidElement& el = m_Elem[iel];
         
         if (el.isActive()) {
@@ -1284,8 +1286,9 @@ void FEMultiphasicFSIDomain3D::MassMatrix(FELinearSystem& LS)
     const int ndpn = 7 + nsol;
     
 #pragma omp parallel for shared (NE)
-    for (int iel=0; iel<NE; ++iel)
+    for (int n=0; n<NE; ++n)
     {
+        int iel = ElementOrder(n);
         FESolidElement& el = m_Elem[iel];
         
         if (el.isActive()) {
@@ -1323,8 +1326,9 @@ void FEMultiphasicFSIDomain3D::BodyForceStiffness(FELinearSystem& LS, FEBodyForc
     const int ndpn = 7 + nsol;
     
 #pragma omp parallel for shared (NE)
-    for (int iel=0; iel<NE; ++iel)
+    for (int n=0; n<NE; ++n)
     {
+        int iel = ElementOrder(n);
         FESolidElement& el = m_Elem[iel];
         
         if (el.isActive()) {
@@ -1491,8 +1495,9 @@ void FEMultiphasicFSIDomain3D::Update(const FETimeInfo& tp)
     bool berr = false;
     int NE = (int) m_Elem.size();
 #pragma omp parallel for shared(NE, berr)
-    for (int i=0; i<NE; ++i)
+    for (int n=0; n<NE; ++n)
     {
+        int i = ElementOrder(n);
         try
         {
             FESolidElement& el = Element(i);
@@ -1674,8 +1679,9 @@ void FEMultiphasicFSIDomain3D::InertialForces(FEGlobalVector& R)
     const int nsol = m_pMat->Solutes();
     const int ndpn = 7+nsol;
 #pragma omp parallel for shared (NE)
-    for (int i=0; i<NE; ++i)
+    for (int n=0; n<NE; ++n)
     {
+        int i = ElementOrder(n);
         // get the element
         FESolidElement& el = m_Elem[i];
         
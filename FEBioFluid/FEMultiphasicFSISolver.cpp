@@ -1250,6 +1250,7 @@ bool FEMultiphasicFSISolver::StiffnessMatrix()
     FEMesh& mesh = fem.GetMesh();
     
     FESolidLinearSystem LS(this, &m_rigidSolver, *m_pK, m_Fd, m_ui, (m_msymm == REAL_SYMMETRIC), m_alphaf, m_nreq);
+    m_rigidSolver.BeginRigidAssembly(m_alphaf);
     
     // calculate the stiffness matrix for each domain
     for (int i=0; i<mesh.Domains(); ++i)
@@ -1347,6 +1348,9 @@ bool FEMultiphasicFSISolver::StiffnessMatrix()
     // calculate the stiffness contributions for the rigid forces
     for (int i = 0; i<fem.ModelLoads(); ++i) fem.ModelLoad(i)->StiffnessMatrix(LS);
     
+    // add the buffered rigid body coupling terms
+    m_rigidSolver.EndRigidAssembly(*m_pK, m_Fd);
+
     // add contributions from rigid bodies
     m_rigidSolver.StiffnessMatrix(*m_pK, tp);
     
@@ -145,8 +145,9 @@ void FEPolarFluidDomain3D::InternalForces(FEGlobalVector& R)
 {
     int NE = (int)m_Elem.size();
 #pragma omp parallel for shared (NE)
-    for (int i=0; i<NE; ++i)
+    for (int ie=0; ie<NE; ++ie)
     {
+        int i = ElementOrder(ie);
         // element force vector
         vector<double> fe;
         vector<int> lm;
@@ -632,8 +633,9 @@ void FEPolarFluidDomain3D::StiffnessMatrix(FELinearSystem& LS)
     int NE = (int)m_Elem.size();
     
 #pragma omp parallel for shared (NE)
-    for (int iel=0; iel<NE; ++iel)
+    for (int ie=0; ie<NE; ++ie)
     {
+        int iel = ElementOrder(ie);
         FESolidElement& el = m_Elem[iel];
         
         // element stiffness matrix
@@ -664,8 +666,9 @@ void FEPolarFluidDomain3D::MassMatrix(FELinearSystem& LS)
     int NE = (int)m_Elem.size();
     
 #pragma omp parallel for shared (NE)
-    for (int iel=0; iel<NE; ++iel)
+    for (int ie=0; ie<NE; ++ie)
     {
+        int iel = ElementOrder(ie);
         FESolidElement& el = m_Elem[iel];
         
         // element stiffness matrix
@@ -696,8 +699,9 @@ void FEPolarFluidDomain3D::BodyForceStiffness(FELinearSystem& LS, FEBodyForce& b
     int NE = (int)m_Elem.size();
     
 #pragma omp parallel for shared (NE)
-    for (int iel=0; iel<NE; ++iel)
+    for (int ie=0; ie<NE; ++ie)
     {
+        int iel = ElementOrder(ie);
         FESolidElement& el = m_Elem[iel];
         
         // element stiffness matrix
@@ -869,8 +873,9 @@ void FEPolarFluidDomain3D::Update(const FETimeInfo& tp)
     bool berr = false;
     int NE = (int) m_Elem.size();
 #pragma omp parallel for shared(NE, berr)
-    for (int i=0; i<NE; ++i)
+    for (int n=0; n<NE; ++n)
     {
+        int i = ElementOrder(n);
         try
         {
             UpdateElementStress(i, tp);
@@ -966,8 +971,9 @@ void FEPolarFluidDomain3D::InertialForces(FEGlobalVector& R)
 {
     int NE = (int)m_Elem.size();
 #pragma omp parallel for shared (NE)
-    for (int i=0; i<NE; ++i)
+    for (int ie=0; ie<NE; ++ie)
     {
+        int i = ElementOrder(ie);
         // element force vector
         vector<double> fe;
         vector<int> lm;
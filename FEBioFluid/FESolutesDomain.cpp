@@ -239,8 +239,9 @@ void FESolutesDomain::InternalForces(FEGlobalVector& R)
 {
 	int NE = (int)m_Elem.size();
 #pragma omp parallel for shared (NE)
-	for (int i = 0; i<NE; ++i)
+	for (int ie=0; ie<NE; ++ie)
 	{
+		int i = ElementOrder(ie);
 		// element force vector
 		vector<double> fe;
 		vector<int> lm;
@@ -449,8 +450,9 @@ void FESolutesDomain::StiffnessMatrix(FELinearSystem& LS)
 	int NE = (int)m_Elem.size();
 
 #pragma omp parallel for shared (NE)
-	for (int iel = 0; iel<NE; ++iel)
+	for (int n=0; n<NE; ++n)
 	{
+		int iel = ElementOrder(n);
 		FESolidElement& el = m_Elem[iel];
 
 		// element stiffness matrix
@@ -481,8 +483,9 @@ void FESolutesDomain::Update(const FETimeInfo& tp)
 	bool berr = false;
 	int NE = (int)m_Elem.size();
 #pragma omp parallel for shared(NE, berr)
-	for (int i = 0; i<NE; ++i)
+	for (int n=0; n<NE; ++n)
 	{
+		int i = ElementOrder(n);
 		try
 		{
 			UpdateElementStress(i, tp);
@@ -164,8 +164,9 @@ void FEThermoFluidDomain3D::InternalForces(FEGlobalVector& R)
     int ndpn = 5;
     
 #pragma omp parallel for shared (NE)
-    for (int i=0; i<NE; ++i)
+    for (int ie=0; ie<NE; ++ie)
     {
+        int i = ElementOrder(ie);
         // element force vector
         vector<double> fe;
         vector<int> lm;
@@ -651,8 +652,9 @@ void FEThermoFluidDomain3D::StiffnessMatrix(FELinearSystem& LS)
     int NE = (int)m_Elem.size();
     
 #pragma omp parallel for shared (NE)
-    for (int iel=0; iel<NE; ++iel)
+    for (int ie=0; ie<NE; ++ie)
     {
+        int iel = ElementOrder(ie);
         FESolidElement& el = m_Elem[iel];
 
         // element stiffness matrix
@@ -683,8 +685,9 @@ void FEThermoFluidDomain3D::MassMatrix(FELinearSystem& LS)
     int NE = (int)m_Elem.size();
     
 #pragma omp parallel for shared (NE)
-    for (int iel=0; iel<NE; ++iel)
+    for (int ie=0; ie<NE; ++ie)
     {
+        int iel = ElementOrder(ie);
         FESolidElement& el = m_Elem[iel];
 
         // element stiffness matrix
@@ -715,8 +718,9 @@ void FEThermoFluidDomain3D::BodyForceStiffness(FELinearSystem& LS, FEBodyForce&
     int NE = (int)m_Elem.size();
     
 #pragma omp parallel for shared (NE)
-    for (int iel=0; iel<NE; ++iel)
+    for (int ie=0; ie<NE; ++ie)
     {
+        int iel = ElementOrder(ie);
         FESolidElement& el = m_Elem[iel];
 
         // element stiffness matrix
@@ -857,8 +861,9 @@ void FEThermoFluidDomain3D::Update(const FETimeInfo& tp)
     bool berr = false;
     int NE = (int) m_Elem.size();
 #pragma omp parallel for shared(NE, berr)
-    for (int i=0; i<NE; ++i)
+    for (int n=0; n<NE; ++n)
     {
+        int i = ElementOrder(n);
         try
         {
             UpdateElementStress(i, tp);
@@ -961,8 +966,9 @@ void FEThermoFluidDomain3D::InertialForces(FEGlobalVector& R)
 {
     int NE = (int)m_Elem.size();
 #pragma omp parallel for shared (NE)
-    for (int i=0; i<NE; ++i)
+    for (int ie=0; ie<NE; ++ie)
     {
+        int i = ElementOrder(ie);
         // element force vector
         vector<double> fe;
         vector<int> lm;
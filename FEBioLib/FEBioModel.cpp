@@ -55,6 +55,8 @@ SOFTWARE.*/
 #include "FECore/log.h"
 #include "FECore/FECoreKernel.h"
 #include "FECore/DumpFile.h"
+#include <FECore/DumpMemStream.h>
+#include <FECore/DumpArchiveWriter.h>
 #include "FECore/DOFS.h"
 #include <FECore/FEAnalysis.h>
 #include <NumCore/MatrixTools.h>
@@ -115,6 +117,7 @@ FEBioModel::FEBioModel()
 
 	m_dumpLevel = FE_DUMP_NEVER;
 	m_dumpStride = 1;
+	m_dumpWriter = new DumpArchiveWriter;
 
 	// --- I/O-Data ---
 	m_ndebug = 0;
@@ -142,6 +145,9 @@ FEBioModel::FEBioModel()
 //-----------------------------------------------------------------------------
 FEBioModel::~FEBioModel()
 {
+	// make sure the last restart archive is written
+	delete m_dumpWriter;
+
 	// close the plot file
 	if (m_plot) { delete m_plot; m_plot = 0; }
 	m_log.close();
@@ -192,6 +198,12 @@ void FEBioModel::SetDumpStride(int n) { m_dumpStride = n; }
 //! get the dump stride
 int FEBioModel::GetDumpStride() const { return m_dumpStride; }
 
+//! Set the compression level of restart archives
+void FEBioModel::SetDumpCompression(int n) { m_dumpWriter->SetCompression(n); }
+
+//! Set the number of restart archives to keep
+void FEBioModel::SetDumpKeep(int n) { m_dumpWriter->SetKeepCount(n); }
+
 //! Set the log level
 void FEBioModel::SetLogLevel(int logLevel) { m_logLevel = logLevel; }
 
@@ -717,22 +729,41 @@ void FEBioModel::DumpData(int nevent)
 		break;
 	case CB_STEP_SOLVED: if (ndump == FE_DUMP_STEP) bdump = true; break;
 	}
+
+	// report the previous archive if it was written in the meantime
+	if (m_dumpWriter->IsDone()) FlushDumpData();
 	
 	if (bdump)
 	{
-		DumpFile ar(*this);
-		if (ar.Create(m_sdump.c_str()) == false)
-		{
-			feLogWarning("Failed creating restart file (%s).\n", m_sdump.c_str());
-		}
-		else
-		{
-			Serialize(ar);
-			feLogInfo("\nRestart point created. Archive name is %s.", m_sdump.c_str());
-		}
+		// Serialize into memory first. The archive is written to disk in the background
+		// and the writer releases the memory when it's done.
+		DumpMemStream* ar = new DumpMemStream(*this);
+		ar->Open(true, false);
+		Serialize(*ar);
+
+		// wait for the previous archive before the new one is started
+		FlushDumpData();
+		m_dumpWriter->Write(m_sdump, ar);
 	}
 }
 
+//-----------------------------------------------------------------------------
+//! wait until pending restart archives are written (and report them)
+bool FEBioModel::FlushDumpData()
+{
+	if (m_dumpWriter->IsPending() == false) return true;
+
+	std::string fileName = m_dumpWriter->FileName();
+	if (m_dumpWriter->Flush() == false)
+	{
+		feLogWarning("Failed creating restart file (%s).\n", fileName.c_str());
+		return false;
+	}
+
+	feLogInfo("\nRestart point created. Archive name is %s.", fileName.c_str());
+	return true;
+}
+
 string removeNewLines(const char* sz)
 {
 	string tmp; tmp.reserve(128);
@@ -1312,6 +1343,7 @@ void FEBioModel::Serialize(DumpStream& ar)
 		if (ar.IsSaving())
 		{
 			// --- version number ---
+			static_assert(RSTRTVERSION == DUMP_VERSION, "restart version does not match dump stream version");
 			ar << (int) RSTRTVERSION;
 		}
 		else
@@ -1320,8 +1352,9 @@ void FEBioModel::Serialize(DumpStream& ar)
 			int nversion;
 			ar >> nversion;
 
-			// make sure it is the right version
-			if (nversion != RSTRTVERSION) throw restart_exception("incorrect version number");
+			// make sure it is a version we can read
+			if ((nversion < DUMP_VERSION_BASE) || (nversion > RSTRTVERSION)) throw restart_exception("incorrect version number");
+			ar.SetVersion(nversion);
 		}
 
 		// serialize model data
@@ -1693,6 +1726,9 @@ bool FEBioModel::Reset()
 //-----------------------------------------------------------------------------
 void FEBioModel::on_cb_solved()
 {
+	// make sure the last restart archive is on disk
+	FlushDumpData();
+
 	FEAnalysis* step = GetCurrentStep();
 	if (step == nullptr) return;
 
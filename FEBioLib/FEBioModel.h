@@ -35,6 +35,8 @@ SOFTWARE.*/
 #include <FEBioLib/Logfile.h>
 #include "febiolib_api.h"
 
+class DumpArchiveWriter;
+
 //-----------------------------------------------------------------------------
 // Dump level determines the times the restart file is written
 enum FE_Dump_Level {
@@ -191,6 +193,15 @@ public:
 	//! get the dump stride
 	int GetDumpStride() const;
 
+	//! Set the compression level of restart archives (0 = none)
+	void SetDumpCompression(int n);
+
+	//! Set the number of restart archives to keep
+	void SetDumpKeep(int n);
+
+	//! wait until pending restart archives are written (and report them)
+	bool FlushDumpData();
+
 	//! Set the log level
 	void SetLogLevel(int logLevel);
 
@@ -227,6 +238,8 @@ private:
 	int			m_dumpLevel;	//!< level or writing restart file
 	int			m_dumpStride;	//!< write dump file every nth iterations
 
+	DumpArchiveWriter*	m_dumpWriter;	//!< writes restart archives in the background
+
 private:
 	// accumulative statistics
 	ModelStats	m_stats;
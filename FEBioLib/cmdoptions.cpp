@@ -84,6 +84,8 @@ bool febio::ProcessOptionsString(const std::string& s, CMDOPTIONS& ops)
 	ops.sztask[0] = 0;
 	ops.szctrl[0] = 0;
 	ops.szimp[0] = 0;
+	ops.szprof[0] = 0;
+	ops.bprofile = false;
 
 	// set initial configuration file name
 	if (ops.szcnf[0] == 0)
@@ -118,6 +120,33 @@ bool febio::ProcessOptionsString(const std::string& s, CMDOPTIONS& ops)
 			bplt = true;
 			strcpy(ops.szplt, args[++i].c_str());
 		}
+		else if (strncmp(sz, "-dump_compress", 14) == 0)
+		{
+			ops.dumpCompress = 1;
+			if (sz[14] == '=') ops.dumpCompress = atoi(sz + 15);
+			if ((ops.dumpCompress < 0) || (ops.dumpCompress > 9))
+			{
+				fprintf(stderr, "FATAL ERROR: invalid dump compression level.\n");
+				return false;
+			}
+		}
+		else if (strncmp(sz, "-dump_keep", 10) == 0)
+		{
+			if (sz[10] == '=')
+			{
+				ops.dumpKeep = atoi(sz + 11);
+				if (ops.dumpKeep < 1)
+				{
+					fprintf(stderr, "FATAL ERROR: invalid number of dump files to keep.\n");
+					return false;
+				}
+			}
+			else
+			{
+				fprintf(stderr, "FATAL ERROR: missing '=' after -dump_keep.\n");
+				return false;
+			}
+		}
 		else if (strncmp(sz, "-dump", 5) == 0)
 		{
 			ops.dumpLevel = FE_DUMP_MAJOR_ITRS;
@@ -207,6 +236,13 @@ bool febio::ProcessOptionsString(const std::string& s, CMDOPTIONS& ops)
 				}
 			}
 		}
+		else if (strncmp(sz, "-profile", 8) == 0)
+		{
+			// collect profiling data and optionally write a trace file
+			ops.bprofile = true;
+			if (sz[8] == '=') strcpy(ops.szprof, sz + 9);
+			else if (sz[8] != 0) { fprintf(stderr, "command line error when parsing profile\n"); return false; }
+		}
 		else if (strcmp(sz, "-import") == 0)
 		{
 			strcpy(ops.szimp, args[++i].c_str());
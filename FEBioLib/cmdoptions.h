@@ -38,9 +38,12 @@ struct FEBIOLIB_API CMDOPTIONS
 	bool	bsplash;			//!< show splash screen or not
 	bool	bsilent;			//!< run FEBio in silent mode (no output to screen)
 	bool	binteractive;		//!< start FEBio interactively
+	bool	bprofile;			//!< collect profiling data
 
 	int		dumpLevel;		//!< requested restart level
 	int		dumpStride;		//!< (cold) restart file stride
+	int		dumpCompress;	//!< compression level of restart files
+	int		dumpKeep;		//!< number of restart files to keep
 
 	char	szfile[MAXFILE];	//!< model input file name
 	char	szlog[MAXFILE];	//!< log file name
@@ -50,6 +53,7 @@ struct FEBIOLIB_API CMDOPTIONS
 	char	sztask[MAXFILE];	//!< task name
 	char	szctrl[MAXFILE];	//!< control file for tasks
 	char	szimp[MAXFILE];		//!< import file
+	char	szprof[MAXFILE];	//!< profiler trace file
 
 	CMDOPTIONS()
 	{
@@ -62,8 +66,11 @@ struct FEBIOLIB_API CMDOPTIONS
 		bsplash = true;
 		bsilent = false;
 		binteractive = false;
+		bprofile = false;
 		dumpLevel = 0;
 		dumpStride = 1;
+		dumpCompress = 0;
+		dumpKeep = 1;
 
 		szfile[0] = 0;
 		szlog[0] = 0;
@@ -73,6 +80,7 @@ struct FEBIOLIB_API CMDOPTIONS
 		sztask[0] = 0;
 		szctrl[0] = 0;
 		szimp[0] = 0;
+		szprof[0] = 0;
 	}
 };
 
@@ -453,6 +453,9 @@ FEBIOLIB_API int RunModel(FEBioModel& fem, CMDOPTIONS* ops)
 	{
 		fem.SetDebugLevel(ops->ndebug);
 		fem.SetDumpLevel(ops->dumpLevel);
+		fem.SetDumpStride(ops->dumpStride);
+		fem.SetDumpCompression(ops->dumpCompress);
+		fem.SetDumpKeep(ops->dumpKeep);
 
 		// set the output filenames
 		fem.SetLogFilename(ops->szlog);
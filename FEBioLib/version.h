@@ -42,9 +42,10 @@ SOFTWARE.*/
 // Restart file version
 // This is the version number of the restart dump file format.
 // It is incremented when the structure of this file is modified.
+// (This must match DUMP_VERSION in FECore/DumpStream.h.)
 //
 
-#define RSTRTVERSION		0x06
+#define RSTRTVERSION		0x07
 
 namespace febio
 {
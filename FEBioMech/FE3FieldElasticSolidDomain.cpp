@@ -138,8 +138,9 @@ void FE3FieldElasticSolidDomain::StiffnessMatrix(FELinearSystem& LS)
 	// repeat over all solid elements
 	int NE = (int)m_Elem.size();
 	#pragma omp parallel for
-	for (int iel=0; iel<NE; ++iel)
+	for (int ie=0; ie<NE; ++ie)
 	{
+		int iel = ElementOrder(ie);
 		FESolidElement& el = m_Elem[iel];
 
 		// element stiffness matrix
@@ -451,8 +452,9 @@ void FE3FieldElasticSolidDomain::Update(const FETimeInfo& tp)
 	bool berr = false;
 	int NE = (int) m_Elem.size();
 	#pragma omp parallel for shared(NE, berr)
-	for (int i=0; i<NE; ++i)
+	for (int n=0; n<NE; ++n)
 	{
+		int i = ElementOrder(n);
 		try
 		{
 			UpdateElementStress(i, tp);
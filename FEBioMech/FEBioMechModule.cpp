@@ -853,6 +853,7 @@ void FEBioMech::InitModule()
 	REGISTER_FECORE_CLASS(FEPlotContinuousDamage_gamma, "continuous damage gamma");
 	REGISTER_FECORE_CLASS(FEPlotContinuousDamage_D2beta, "continuous damage D2beta");
     REGISTER_FECORE_CLASS(FEPlotRVEgenerations, "RVE generations");
+    REGISTER_FECORE_CLASS(FEPlotRVEcompactionError, "RVE compaction error estimate");
     REGISTER_FECORE_CLASS(FEPlotRVEbonds, "RVE reforming bonds");
     REGISTER_FECORE_CLASS(FEPlotRVErecruitment, "RVE recruitment");
     REGISTER_FECORE_CLASS(FEPlotRVEstrain, "RVE strain");
@@ -4002,6 +4002,61 @@ bool FEPlotRVEgenerations::Save(FEDomain& dom, FEDataStream& a)
     return true;
 }
 
+//-----------------------------------------------------------------------------
+bool FEPlotRVEcompactionError::SetFilter(const char* szfilter)
+{
+    sscanf(szfilter, "solid[%d]", &m_comp);
+    return true;
+}
+
+bool FEPlotRVEcompactionError::Save(FEDomain& dom, FEDataStream& a)
+{
+    int N = dom.Elements();
+    FEElasticMaterial* pmat = dom.GetMaterial()->ExtractProperty<FEElasticMaterial>();
+    if (pmat == nullptr) return false;
+    FEReactiveViscoelasticMaterial* rvmat = nullptr;
+    FEUncoupledReactiveViscoelasticMaterial* rumat = nullptr;
+    if (m_comp > -1) {
+        FEElasticMixture* pmm = dynamic_cast<FEElasticMixture*>(pmat);
+        FEUncoupledElasticMixture* pum = dynamic_cast<FEUncoupledElasticMixture*>(pmat);
+        if (pmm) rvmat = dynamic_cast<FEReactiveViscoelasticMaterial*>(pmm->GetMaterial(m_comp));
+        if (pum) rumat = dynamic_cast<FEUncoupledReactiveViscoelasticMaterial*>(pum->GetMaterial(m_comp));
+    }
+    else {
+        rvmat = dynamic_cast<FEReactiveViscoelasticMaterial*>(pmat);
+        rumat = dynamic_cast<FEUncoupledReactiveViscoelasticMaterial*>(pmat);
+    }
+    if (rvmat) {
+        for (int iel=0; iel<N; ++iel)
+        {
+            FEElement& el = dom.ElementRef(iel);
+            
+            int nint = el.GaussPoints();
+            double err = 0;
+            for (int j=0; j<nint; ++j)
+                err = max(err, rvmat->RVECompactionError(*el.GetMaterialPoint(j)));
+            a << err;
+        }
+    }
+    else if (rumat) {
+        for (int iel=0; iel<N; ++iel)
+        {
+            FEElement& el = dom.ElementRef(iel);
+            
+            int nint = el.GaussPoints();
+            double err = 0;
+            for (int j=0; j<nint; ++j)
+                err = max(err, rumat->RVECompactionError(*el.GetMaterialPoint(j)));
+            a << err;
+        }
+    }
+    else {
+        return false;
+    }
+
+    return true;
+}
+
 //-----------------------------------------------------------------------------
 bool FEPlotRVEbonds::SetFilter(const char* szfilter)
 {
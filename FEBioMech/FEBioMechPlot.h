@@ -1232,6 +1232,18 @@ protected:
     int        m_comp;
 };
 
+//-----------------------------------------------------------------------------
+//! Accumulated error estimate of generation compaction in reactive viscoelastic material point
+class FEPlotRVEcompactionError : public FEPlotDomainData
+{
+public:
+    FEPlotRVEcompactionError(FEModel* pfem) : FEPlotDomainData(pfem, PLT_FLOAT, FMT_ITEM) { m_comp = -1; }
+    bool SetFilter(const char* szfilter) override;
+    bool Save(FEDomain& dom, FEDataStream& a) override;
+protected:
+    int        m_comp;
+};
+
 //-----------------------------------------------------------------------------
 //! Reforming bond mass fraction in reactive viscoelastic material point
 class FEPlotRVEbonds : public FEPlotDomainData
@@ -26,6 +26,7 @@ SOFTWARE.*/
 #pragma once
 #include "FEContactInterface.h"
 #include "FEContactSurface.h"
+#include "FEVerletList.h"
 #include <set>
 
 class FEContactPotentialSurface : public FEContactSurface
@@ -104,6 +105,8 @@ protected:
 
 	void UpdateSurface(FESurface& surface);
 
+	void UpdateNeighborLists();
+
 protected:
 	FEContactPotentialSurface	m_surf1;
 	FEContactPotentialSurface	m_surf2;
@@ -115,9 +118,16 @@ protected:
 	double	m_Rout;
 	double	m_Rmin;
 	double	m_wtol;
+	double	m_skin;		//!< skin distance of the neighbor lists (as fraction of R_out)
 
 	double	m_c1, m_c2;
 
+	FEVerletList		m_verlet;	//!< neighbor lists
+	std::vector<vec3d>	m_qpos;		//!< integration point positions of surface 1
+	std::vector<vec3d>	m_tpos;		//!< integration point positions of surface 2
+	std::vector<int>	m_qoff;		//!< index of the first integration point of each surface 1 element
+	std::vector< std::pair<FESurfaceElement*, int> >	m_tpt;	//!< element and integration point of each surface 2 point
+
 	std::vector< std::set<FESurfaceElement*> >	m_activeElements;
 	std::vector< std::set<FESurfaceElement*> >	m_elemNeighbors;
 
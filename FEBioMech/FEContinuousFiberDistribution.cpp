@@ -65,6 +65,9 @@ bool FEContinuousFiberDistribution::Init()
     // initialize base class
 	if (FEElasticMaterial::Init() == false) return false;
 
+	// tabulate the integration points
+	m_fib.Build(m_pFint, m_pFDD);
+
 	return true;
 }
 
@@ -74,6 +77,8 @@ void FEContinuousFiberDistribution::Serialize(DumpStream& ar)
 {	
 	FEElasticMaterial::Serialize(ar);
 	if (ar.IsShallow()) return;
+
+	if (ar.IsLoading()) m_fib.Build(m_pFint, m_pFDD);
 }
 
 //-----------------------------------------------------------------------------
@@ -88,7 +93,15 @@ mat3ds FEContinuousFiberDistribution::Stress(FEMaterialPoint& mp)
 
 	// get the local coordinate system
 	mat3d Q = GetLocalCS(mp);
-    
+
+	// use the tabulated integration points when available
+	if (m_fib.IsValid())
+	{
+		return m_fib.Integrate(mp, m_pFDD, Q, s, [&](const vec3d& n0) {
+			return m_pFmat->FiberStress(mp, fp.FiberPreStretch(n0));
+		});
+	}
+
     double IFD = IntegratedFiberDensity(mp);
 
 	// obtain an integration point iterator
@@ -129,13 +142,21 @@ tens4ds FEContinuousFiberDistribution::Tangent(FEMaterialPoint& mp)
 
 	// get the local coordinate system
 	mat3d Q = GetLocalCS(mp);
-    
-    double IFD = IntegratedFiberDensity(mp);
 
 	// initialize stress tensor
 	tens4ds c;
 	c.zero();
 
+	// use the tabulated integration points when available
+	if (m_fib.IsValid())
+	{
+		return m_fib.Integrate(mp, m_pFDD, Q, c, [&](const vec3d& n0) {
+			return m_pFmat->FiberTangent(mp, fp.FiberPreStretch(n0));
+		});
+	}
+
+    double IFD = IntegratedFiberDensity(mp);
+
 	FEFiberIntegrationSchemeIterator* it = m_pFint->GetIterator(&mp);
 	if (it->IsValid())
 	{
@@ -173,10 +194,18 @@ double FEContinuousFiberDistribution::StrainEnergyDensity(FEMaterialPoint& mp)
 
 	// get the local coordinate system
 	mat3d Q = GetLocalCS(mp);
-    
-    double IFD = IntegratedFiberDensity(mp);
 
 	double sed = 0.0;
+
+	// use the tabulated integration points when available
+	if (m_fib.IsValid())
+	{
+		return m_fib.Integrate(mp, m_pFDD, Q, sed, [&](const vec3d& n0) {
+			return m_pFmat->FiberStrainEnergyDensity(mp, fp.FiberPreStretch(n0));
+		});
+	}
+
+    double IFD = IntegratedFiberDensity(mp);
 	FEFiberIntegrationSchemeIterator* it = m_pFint->GetIterator(&mp);
 	if (it->IsValid())
 	{
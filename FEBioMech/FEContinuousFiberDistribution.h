@@ -69,5 +69,8 @@ protected:
 	FEFiberDensityDistribution* m_pFDD;     // pointer to fiber density distribution
 	FEFiberIntegrationScheme*   m_pFint;    // pointer to fiber integration scheme
 
+private:
+	FEFiberIntegrationTable		m_fib;		// tabulated integration points
+
 	DECLARE_FECORE_CLASS();
 };
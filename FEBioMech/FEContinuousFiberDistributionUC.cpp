@@ -59,6 +59,27 @@ FEMaterialPointData* FEContinuousFiberDistributionUC::CreateMaterialPointData()
 	return mp;
 }
 
+//-----------------------------------------------------------------------------
+bool FEContinuousFiberDistributionUC::Init()
+{
+	// initialize base class
+	if (FEUncoupledMaterial::Init() == false) return false;
+
+	// tabulate the integration points
+	m_fib.Build(m_pFint, m_pFDD);
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+void FEContinuousFiberDistributionUC::Serialize(DumpStream& ar)
+{
+	FEUncoupledMaterial::Serialize(ar);
+	if (ar.IsShallow()) return;
+
+	if (ar.IsLoading()) m_fib.Build(m_pFint, m_pFDD);
+}
+
 //-----------------------------------------------------------------------------
 //! calculate stress at material point
 mat3ds FEContinuousFiberDistributionUC::DevStress(FEMaterialPoint& mp)
@@ -71,6 +92,14 @@ mat3ds FEContinuousFiberDistributionUC::DevStress(FEMaterialPoint& mp)
 	// get the local coordinate system
 	mat3d Q = GetLocalCS(mp);
 
+	// use the tabulated integration points when available
+	if (m_fib.IsValid())
+	{
+		return m_fib.Integrate(mp, m_pFDD, Q, s, [&](const vec3d& n0) {
+			return m_pFmat->DevFiberStress(mp, fp.FiberPreStretch(n0));
+		});
+	}
+
 	double IFD = IntegratedFiberDensity(mp);
 
 	// obtain an integration point iterator
@@ -115,6 +144,14 @@ tens4ds FEContinuousFiberDistributionUC::DevTangent(FEMaterialPoint& mp)
 	tens4ds c;
 	c.zero();
 
+	// use the tabulated integration points when available
+	if (m_fib.IsValid())
+	{
+		return m_fib.Integrate(mp, m_pFDD, Q, c, [&](const vec3d& n0) {
+			return m_pFmat->DevFiberTangent(mp, fp.FiberPreStretch(n0));
+		});
+	}
+
 	double IFD = IntegratedFiberDensity(mp);
 
 	FEFiberIntegrationSchemeIterator* it = m_pFint->GetIterator(&mp);
@@ -153,8 +190,17 @@ double FEContinuousFiberDistributionUC::DevStrainEnergyDensity(FEMaterialPoint&
 	// get the local coordinate system
 	mat3d Q = GetLocalCS(mp);
 
-	double IFD = IntegratedFiberDensity(mp);
 	double sed = 0.0;
+
+	// use the tabulated integration points when available
+	if (m_fib.IsValid())
+	{
+		return m_fib.Integrate(mp, m_pFDD, Q, sed, [&](const vec3d& n0) {
+			return m_pFmat->DevFiberStrainEnergyDensity(mp, fp.FiberPreStretch(n0));
+		});
+	}
+
+	double IFD = IntegratedFiberDensity(mp);
 	FEFiberIntegrationSchemeIterator* it = m_pFint->GetIterator(&mp);
 	if (it->IsValid())
 	{
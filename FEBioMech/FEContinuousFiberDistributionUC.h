@@ -45,6 +45,12 @@ public:
     
     // returns a pointer to a new material point object
 	FEMaterialPointData* CreateMaterialPointData() override;
+
+	// Initialization
+	bool Init() override;
+
+	//! Serialization
+	void Serialize(DumpStream& ar) override;
     
 public:
 	//! calculate stress at material point
@@ -64,5 +70,8 @@ protected:
 	FEFiberDensityDistribution* m_pFDD;     // pointer to fiber density distribution
 	FEFiberIntegrationScheme*	m_pFint;    // pointer to fiber integration scheme
 
+private:
+	FEFiberIntegrationTable		m_fib;		// tabulated integration points
+
 	DECLARE_FECORE_CLASS();
 };
@@ -58,6 +58,9 @@ public: // overridden from FEElasticDomain
 	//! build the matrix profile
 	void BuildMatrixProfile(FEGlobalMatrix& K) override;
 
+	//! the profile connects the nodes, not the elements, so it cannot be updated per element
+	bool UpdateMatrixProfile(FEGlobalMatrix& K, const std::vector<int>& elemList) override { return false; }
+
 	//! calculate stiffness matrix
 	void StiffnessMatrix(FELinearSystem& LS) override;
 	void MassMatrix(FELinearSystem& LS, double scale) override {}
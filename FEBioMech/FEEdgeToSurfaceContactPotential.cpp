@@ -29,7 +29,6 @@ SOFTWARE.*/
 #include <FECore/FEGlobalMatrix.h>
 #include <FECore/FELinearSystem.h>
 #include <FECore/FEBox.h>
-#include <stdexcept>
 
 void FEE2SCPSurface::Update()
 {
@@ -110,6 +109,7 @@ BEGIN_FECORE_CLASS(FEEdgeToSurfaceContactPotential, FESurfaceConstraint)
 	ADD_PARAMETER(m_Rout, "R_out");
 	ADD_PARAMETER(m_Rmin, "R0_min");
 	ADD_PARAMETER(m_wtol, "w_tol");
+	ADD_PARAMETER(m_skin, FE_RANGE_GREATER_OR_EQUAL(0.0), "skin");
 
 	ADD_PROPERTY(m_edge, "edgelist")->AddFlag(FEProperty::Reference);
 
@@ -123,6 +123,7 @@ FEEdgeToSurfaceContactPotential::FEEdgeToSurfaceContactPotential(FEModel* fem) :
 	m_Rout = 2.0;
 	m_Rmin = 0.0;
 	m_wtol = 0.0;
+	m_skin = 0.25;
 }
 
 FESurface* FEEdgeToSurfaceContactPotential::GetSurface()
@@ -142,251 +143,71 @@ static bool is_neighbor(FESurfaceElement& e1, FESurfaceElement& e2)
 	return false;
 }
 
-struct BOX
+// initialization
+bool FEEdgeToSurfaceContactPotential::Init()
 {
-public:
-	vec3d r0, r1;
-
-public:
-	BOX() {}
-	BOX(const vec3d& p0, const vec3d& p1) : r0(p0), r1(p1) {}
-
-	void add(const vec3d& r)
-	{
-		if (r.x < r0.x) r0.x = r.x;
-		if (r.y < r0.y) r0.y = r.y;
-		if (r.z < r0.z) r0.z = r.z;
-
-		if (r.x > r1.x) r1.x = r.x;
-		if (r.y > r1.y) r1.y = r.y;
-		if (r.z > r1.z) r1.z = r.z;
-	}
-
-	void inflate(double l)
-	{
-		r0.x -= l; r0.y -= l; r0.z -= l;
-		r1.x += l; r1.y += l; r1.z += l;
-	}
-
-	bool isInside(const vec3d& r) const
-	{
-		return (
-			(r.x >= r0.x) && (r.x <= r1.x) &&
-			(r.y >= r0.y) && (r.y <= r1.y) &&
-			(r.z >= r0.z) && (r.z <= r1.z));
-	}
+	if (FESurfaceConstraint::Init() == false) return false;
 
-	double MaxExtent() const
+	for (int i = 0; i < m_edge.Elements(); ++i)
 	{
-		double sx = r1.x - r0.x;
-		double sy = r1.y - r0.y;
-		double sz = r1.z - r0.z;
-
-		if ((sx >= sy) && (sx >= sz)) return sx;
-		if ((sy >= sx) && (sy >= sz)) return sy;
-		if ((sz >= sx) && (sz >= sy)) return sz;
-		// we should never reach here
-		return 0;
-	}
-
-	double width () const { return r1.x - r0.x; }
-	double height() const { return r1.y - r0.y; }
-	double depth () const { return r1.z - r0.z; }
-};
+		FELineElement& el = m_edge.Element(i);
 
-class Grid
-{
-public:
-	class Cell
-	{
-	public:
-		Cell() {}
-		Cell(const Cell& c) : m_box(c.m_box), m_elemList(c.m_elemList), m_nbr(c.m_nbr) {}
-		void operator = (const Cell& c) { 
-			m_box = c.m_box; 
-			m_elemList = c.m_elemList; 
-			m_nbr = c.m_nbr;
-		}
+		vec3d r0[FEElement::MAX_NODES];
+		m_edge.GetReferenceNodalCoordinates(el, r0);
 
-		void add(FESurfaceElement* el)
+		int nint = el.GaussPoints();
+		for (int n = 0; n < nint; ++n)
 		{
-			m_elemList.insert(el);
+			FEMaterialPoint& mp = *el.GetMaterialPoint(n);
+			mp.m_r0 = el.Evaluate(r0, n);
 		}
-
-		bool empty() const { return m_elemList.empty(); }
-
-	public:
-		BOX m_box;
-		set<FESurfaceElement*>	m_elemList;
-		vector<Cell*>	m_nbr;
-	};
-
-	Cell* FindCell(const vec3d& r)
-	{
-		if (box.isInside(r) == false) return nullptr;
-
-		int ix = (int)(m_nx * (r.x - box.r0.x) / box.width());
-		int iy = (int)(m_ny * (r.y - box.r0.y) / box.height());
-		int iz = (int)(m_nz * (r.z - box.r0.z) / box.depth());
-		if (ix == m_nx) ix--;
-		if (iy == m_ny) iy--;
-		if (iz == m_nz) iz--;
-
-		int icell = iz * (m_nx * m_ny) + iy * m_nx + ix;
-		Cell* c = m_cell + icell;
-		assert(c->m_box.isInside(r));
-		return m_cell + icell;
 	}
 
-	int GetCellNeighborHood(const vec3d& r, Cell** cellList)
-	{
-		Cell* c = FindCell(r);
-		if (c == nullptr) return 0;
-
-		int n = 0;
-		for (int i = 0; i < 27; ++i)
-		{
-			Cell* ci = c->m_nbr[i];
-			if ((ci != nullptr) && (ci->empty() == false)) cellList[n++] = ci;
-		}
-		return n;
-	}
+	m_activeElements.resize(m_edge.Elements());
 
-public:
-	Grid() { m_nx = m_ny = m_nz = 0; m_cell = nullptr; }
+	return true;
+}
 
-	bool Build(FESurface& s, int boxDivs, double minBoxSize)
+// Update the neighbor lists. The lists contain for each integration point of the edge
+// the integration points of the surface that are within R_out (plus a skin distance), 
+// and only need to be rebuilt when the edge or surface moved more than the skin distance.
+void FEEdgeToSurfaceContactPotential::UpdateNeighborLists()
+{
+	// setup the integration point lookup tables
+	if ((int)m_qoff.size() != m_edge.Elements())
 	{
-		// update the bounding box
-		for (int i = 0; i < s.Nodes(); ++i)
-		{
-			FENode& node = s.Node(i);
-			vec3d ri = node.m_rt;
-			if (i == 0) box.r0 = box.r1 = ri;
-			else box.add(ri);
-		}
-
-		// inflate a little, just to be sure
-		double R = box.MaxExtent();
-		box.inflate(minBoxSize);
-
-		// determine the sizes
-		double W = box.width();
-		double H = box.height();
-		double D = box.depth();
-
-		double boxSize = box.MaxExtent() / boxDivs;
-		if (boxSize < minBoxSize) boxSize = minBoxSize;
-
-		m_nx = (int)(W / boxSize); if (m_nx < 1) m_nx = 1;
-		m_ny = (int)(H / boxSize); if (m_ny < 1) m_ny = 1;
-		m_nz = (int)(D / boxSize); if (m_nz < 1) m_nz = 1;
-
-		// allocate the grid
-		int ncells = m_nx * m_ny * m_nz;
-		m_cell = new Cell[ncells];
-
-		// helper lookup-table for cell neighbors
-		const int LUT[27][3] = {
-			{-1,-1,-1},{ 0,-1,-1},{1,-1,-1},
-			{-1, 0,-1},{ 0, 0,-1},{1, 0,-1},
-			{-1, 1,-1},{ 0, 1,-1},{1, 1,-1},
-			{-1,-1, 0},{ 0,-1, 0},{1,-1, 0},
-			{-1, 0, 0},{ 0, 0, 0},{1, 0, 0},
-			{-1, 1, 0},{ 0, 1, 0},{1, 1, 0},
-			{-1,-1, 1},{ 0,-1, 1},{1,-1, 1},
-			{-1, 0, 1},{ 0, 0, 1},{1, 0, 1},
-			{-1, 1, 1},{ 0, 1, 1},{1, 1, 1} };
-
-		// construct cells
-		Cell* c = m_cell;
-		double X0 = box.r0.x;
-		double Y0 = box.r0.y;
-		double Z0 = box.r0.z;
-		for (int k = 0; k < m_nz; ++k)
+		m_qoff.resize(m_edge.Elements());
+		int nq = 0;
+		for (int i = 0; i < m_edge.Elements(); ++i)
 		{
-			double z0 = Z0 + k * D / m_nz;
-			double z1 = Z0 + (k+1) * D / m_nz;
-			for (int j = 0; j < m_ny; ++j)
-			{
-				double y0 = Y0 + j * H / m_ny;
-				double y1 = Y0 + (j + 1) * H / m_ny;
-				for (int i = 0; i < m_nx; ++i, ++c)
-				{
-					double x0 = X0 + i * W / m_nx;
-					double x1 = X0 + (i + 1) * W / m_nx;
-
-					c->m_box = BOX(vec3d(x0, y0, z0), vec3d(x1, y1, z1));
-					double R = c->m_box.MaxExtent();
-					c->m_box.inflate(R * 1e-4);
-
-					// assign neighbors
-					c->m_nbr.assign(27, nullptr);
-					for (int n = 0; n < 27; ++n)
-					{
-						const int* l = LUT[n];
-						c->m_nbr[n] = GetCell(i + l[0], j + l[1], k + l[2]);
-					}
-				}
-			}
+			m_qoff[i] = nq;
+			nq += m_edge.Element(i).GaussPoints();
 		}
+		m_qpos.resize(nq);
 
-		// assign elements to grid cells
-		for (int i = 0; i < s.Elements(); ++i)
+		m_tpt.clear();
+		for (int i = 0; i < m_surf.Elements(); ++i)
 		{
-			FESurfaceElement& el = s.Element(i);
-			int nint = el.GaussPoints();
-			for (int n = 0; n < nint; ++n)
-			{
-				FESurfaceMaterialPoint& mp = static_cast<FESurfaceMaterialPoint&>(*el.GetMaterialPoint(n));
-				Cell* c = FindCell(mp.m_rt); assert(c);
-				if (c == nullptr) return false;
-				c->add(&el);
-			}
+			FESurfaceElement& el = m_surf.Element(i);
+			for (int n = 0; n < el.GaussPoints(); ++n) m_tpt.push_back(std::make_pair(&el, n));
 		}
-
-		return true;
-	}
-
-	Cell* GetCell(int i, int j, int k) const
-	{
-		if ((i < 0) || (i >= m_nx)) return nullptr;
-		if ((j < 0) || (j >= m_ny)) return nullptr;
-		if ((k < 0) || (k >= m_nz)) return nullptr;
-		return m_cell + (k * (m_nx * m_ny) + j * m_nx + i);
+		m_tpos.resize(m_tpt.size());
+		m_verlet.Clear();
 	}
 
-	~Grid() { delete [] m_cell; }
-
-protected:
-	BOX		box;
-	int		m_nx, m_ny, m_nz;
-	Cell*	m_cell;
-};
-
-// initialization
-bool FEEdgeToSurfaceContactPotential::Init()
-{
-	if (FESurfaceConstraint::Init() == false) return false;
-
+#pragma omp parallel for
 	for (int i = 0; i < m_edge.Elements(); ++i)
 	{
 		FELineElement& el = m_edge.Element(i);
-
-		vec3d r0[FEElement::MAX_NODES];
-		m_edge.GetReferenceNodalCoordinates(el, r0);
-
-		int nint = el.GaussPoints();
-		for (int n = 0; n < nint; ++n)
-		{
-			FEMaterialPoint& mp = *el.GetMaterialPoint(n);
-			mp.m_r0 = el.Evaluate(r0, n);
-		}
+		for (int n = 0; n < el.GaussPoints(); ++n) m_qpos[m_qoff[i] + n] = el.GetMaterialPoint(n)->m_rt;
 	}
 
-	m_activeElements.resize(m_edge.Elements());
+	int nt = (int)m_tpt.size();
+#pragma omp parallel for
+	for (int i = 0; i < nt; ++i) m_tpos[i] = m_tpt[i].first->GetMaterialPoint(m_tpt[i].second)->m_rt;
 
-	return true;
+	m_verlet.SetSkin(m_skin * m_Rout);
+	m_verlet.Update(m_qpos, m_tpos, m_Rout);
 }
 
 // update
@@ -405,17 +226,11 @@ void FEEdgeToSurfaceContactPotential::Update()
 		m_surf.Update();
 	}
 
-	// build the grid
-	int ndivs = (int)pow(m_surf.Elements(), 0.33333);
-	if (ndivs < 2) ndivs = 2;
-	Grid g;
-	if (g.Build(m_surf, ndivs, m_Rout) == false)
-	{
-		throw std::runtime_error("Failed to build grid in FEEdgeToSurfaceContact::Update");
-	}
+	// update the neighbor lists
+	UpdateNeighborLists();
 
 	// build the list of active elements
-//#pragma omp parallel for shared(g) schedule(dynamic)
+//#pragma omp parallel for schedule(dynamic)
 	for (int i = 0; i < m_edge.Elements(); ++i)
 	{
 		FELineElement& el1 = m_edge.Element(i);
@@ -434,56 +249,31 @@ void FEEdgeToSurfaceContactPotential::Update()
 			vec3d r1 = mp1.m_rt;
 			vec3d R1 = mp1.m_r0;
 
-			// find the grid cell this point is in and loop over the cell's neighborhood
-			Grid::Cell* c[27] = { nullptr };
-			int nc = g.GetCellNeighborHood(r1, &c[0]);
-			for (int l = 0; l < nc; ++l)
+			// loop over the integration points of the surface that are close
+			const std::vector<int>& nbr = m_verlet.Neighbors(m_qoff[i] + n);
+			for (int l : nbr)
 			{
-				Grid::Cell* cl = c[l];
-				for (FESurfaceElement* el2 : cl->m_elemList)
+				// make sure we did not process this element yet
+				FESurfaceElement* el2 = m_tpt[l].first;
+				if (excludeList.find(el2) == excludeList.end())
 				{
-					// make sure we did not process this element yet
-					// and the element is not a neighbor (which can be the case for self-contact)
-					if (excludeList.find(el2) == excludeList.end())
+					FEMaterialPoint* mp2 = el2->GetMaterialPoint(m_tpt[l].second);
+					vec3d r12 = r1 - mp2->m_rt;
+					if (r12.norm2() < m_Rout * m_Rout)
 					{
-						// Next, we see if any integration point of el2 is close to the current 
-						// integration point of el1. 
-						vec3d r12;
-						for (int m = 0; m < el2->GaussPoints(); ++m)
+						double L12 = (mp2->m_r0 - R1).norm2();
+						double l12 = r12.unit();
+						if (L12 >= m_Rmin)
 						{
-							FEMaterialPoint* mp2 = el2->GetMaterialPoint(m);
-							vec3d r2 = mp2->m_rt;
-							vec3d R2 = mp2->m_r0;
-
-							r12.x = r1.x - r2.x;
-							r12.y = r1.y - r2.y;
-							r12.z = r1.z - r2.z;
-//							vec3d r12 = r1 - mp2.m_rt;
-							if ((r12.x < m_Rout) && (r12.x > -m_Rout) &&
-								(r12.y < m_Rout) && (r12.y > -m_Rout) &&
-								(r12.z < m_Rout) && (r12.z > -m_Rout) &&
-								(r12.norm2() < m_Rout * m_Rout))
+							// we found one, so insert it to the list of active elements
+							activeElems.insert(el2);
+
+							// also insert it to the exclude list
+							excludeList.insert(el2);
+
+							if ((mp1.m_gap == 0.0) || (l12 < mp1.m_gap))
 							{
-								double L12 = (R2 - R1).norm2();
-								double l12 = r12.unit();
-								if (L12 >= m_Rmin)
-								{
-									// we found one, so insert it to the list of active elements
-									activeElems.insert(el2);
-
-									// also insert it to the exclude list
-									excludeList.insert(el2);
-
-//									fprintf(stderr, "r12: %lg, %lg, %lg\n", r12.x, r12.y, r12.z);
-//									fprintf(stderr, "n1 : %lg, %lg, %lg\n", n1.x, n1.y, n1.z);
-//									fprintf(stderr, "l12 = %lg\n", l12);
-
-									if ((mp1.m_gap == 0.0) || (l12 < mp1.m_gap))
-									{
-										mp1.m_gap = l12;
-									}
-									break;
-								}
+								mp1.m_gap = l12;
 							}
 						}
 					}
@@ -824,4 +614,5 @@ void FEEdgeToSurfaceContactPotential::Serialize(DumpStream& ar)
 	FESurfaceConstraint::Serialize(ar);
 	m_edge.Serialize(ar);
 	m_surf.Serialize(ar);
+	m_verlet.Clear();
 }
@@ -27,6 +27,7 @@ SOFTWARE.*/
 #include <FECore/FESurfaceConstraint.h>
 #include <FECore/FEEdge.h>
 #include "FEContactSurface.h"
+#include "FEVerletList.h"
 #include <set>
 
 class FEE2SCPPoint : public FELineMaterialPoint
@@ -98,6 +99,8 @@ protected:
 	double PotentialDerive(double r);
 	double PotentialDerive2(double r);
 
+	void UpdateNeighborLists();
+
 protected:
 	FEE2SCPEdge	m_edge;
 	FEE2SCPSurface	m_surf;
@@ -109,9 +112,16 @@ protected:
 	double	m_Rout;
 	double	m_Rmin;
 	double	m_wtol;
+	double	m_skin;		//!< skin distance of the neighbor lists (as fraction of R_out)
 
 	double	m_c1, m_c2;
 
+	FEVerletList		m_verlet;	//!< neighbor lists
+	std::vector<vec3d>	m_qpos;		//!< integration point positions of the edge
+	std::vector<vec3d>	m_tpos;		//!< integration point positions of the surface
+	std::vector<int>	m_qoff;		//!< index of the first integration point of each edge element
+	std::vector< std::pair<FESurfaceElement*, int> >	m_tpt;	//!< element and integration point of each surface point
+
 	std::vector< std::set<FESurfaceElement*> >	m_activeElements;
 
 	DECLARE_FECORE_CLASS();
@@ -185,7 +185,7 @@ void FEElasticANSShellDomain::InternalForces(FEGlobalVector& R)
 
 void FEElasticANSShellDomain::ElementInternalForce(FEShellElementNew& el, vector<double>& fe)
 {
-    int i, n;
+    int n;
     
     // jacobian matrix determinant
     double detJt;
@@ -214,7 +214,7 @@ void FEElasticANSShellDomain::ElementInternalForce(FEShellElementNew& el, vector
     vector<vec3d> Nu(neln);
     vector<vec3d> Nw(neln);
     
-    matrix Fu(3,1), Fw(3,1);
+    matrix SC(6,1);
     
     // repeat for all integration points
     for (n=0; n<nint; ++n)
@@ -227,29 +227,14 @@ void FEElasticANSShellDomain::ElementInternalForce(FEShellElementNew& el, vector
         EvaluateANS(el, n, Gcnt, el.m_E[n], hu, hw, EE, HU, HW);
         
         // evaluate 2nd P-K stress
-        matrix SC(6,1);
         mat3ds S = m_pMat->PK2Stress(mp, el.m_E[n]);
         mat3dsCntMat61(S, Gcnt, SC);
         
         // calculate the jacobian and multiply by Gauss weight
         detJt = detJ0(el, n)*gw[n];
         
-        for (i=0; i<neln; ++i)
-        {
-            Fu = hu[i]*SC;
-            Fw = hw[i]*SC;
-            
-            // calculate internal force
-            // the '-' sign is so that the internal forces get subtracted
-            // from the global residual vector
-            fe[6*i  ] -= Fu(0,0)*detJt;
-            fe[6*i+1] -= Fu(1,0)*detJt;
-            fe[6*i+2] -= Fu(2,0)*detJt;
-            
-            fe[6*i+3] -= Fw(0,0)*detJt;
-            fe[6*i+4] -= Fw(1,0)*detJt;
-            fe[6*i+5] -= Fw(2,0)*detJt;
-        }
+        // calculate internal force
+        InternalForce(neln, hu, hw, SC, detJt, fe);
     }
 }
 
@@ -552,7 +537,7 @@ void FEElasticANSShellDomain::ElementStiffness(int iel, matrix& ke)
 {
 	FEShellElementNew& el = ShellElement(iel);
     
-    int i, i6, j, j6, n;
+    int i, j, n;
     
     // Get the current element's data
     const int nint = el.GaussPoints();
@@ -585,7 +570,8 @@ void FEElasticANSShellDomain::ElementStiffness(int iel, matrix& ke)
     
     ke.zero();
     
-    matrix KUU(3,3), KUW(3,3), KWU(3,3), KWW(3,3);
+    matrix SC(6,1);
+    matrix CC(6,6);
     for (n=0; n<nint; ++n)
     {
         FEMaterialPoint& mp = *(el.GetMaterialPoint(n));
@@ -599,46 +585,16 @@ void FEElasticANSShellDomain::ElementStiffness(int iel, matrix& ke)
         detJt = detJ0(el, n)*gw[n];
         
         // evaluate 2nd P-K stress
-        matrix SC(6,1);
         mat3ds S = m_pMat->PK2Stress(mp, el.m_E[n]);
         mat3dsCntMat61(S, Gcnt, SC);
         
         // evaluate the material tangent
-        matrix CC(6,6);
         tens4dmm c = m_pMat->MaterialTangent(mp, el.m_E[n]);
         tens4dmmCntMat66(c, Gcnt, CC);
-//        tens4dsCntMat66(c, Gcnt, CC);
         
         // ------------ constitutive component --------------
         
-        for (i=0, i6=0; i<neln; ++i, i6 += 6)
-        {
-            for (j=0, j6 = 0; j<neln; ++j, j6 += 6)
-            {
-                matrix KUU(3,3), KUW(3,3), KWU(3,3), KWW(3,3);
-                KUU = hu[i]*CC*hu[j].transpose();
-                KUW = hu[i]*CC*hw[j].transpose();
-                KWU = hw[i]*CC*hu[j].transpose();
-                KWW = hw[i]*CC*hw[j].transpose();
-                KUU *= detJt; KUW *= detJt; KWU *= detJt; KWW *= detJt;
-                
-                ke[i6  ][j6  ] += KUU(0,0); ke[i6  ][j6+1] += KUU(0,1); ke[i6  ][j6+2] += KUU(0,2);
-                ke[i6+1][j6  ] += KUU(1,0); ke[i6+1][j6+1] += KUU(1,1); ke[i6+1][j6+2] += KUU(1,2);
-                ke[i6+2][j6  ] += KUU(2,0); ke[i6+2][j6+1] += KUU(2,1); ke[i6+2][j6+2] += KUU(2,2);
-                
-                ke[i6  ][j6+3] += KUW(0,0); ke[i6  ][j6+4] += KUW(0,1); ke[i6  ][j6+5] += KUW(0,2);
-                ke[i6+1][j6+3] += KUW(1,0); ke[i6+1][j6+4] += KUW(1,1); ke[i6+1][j6+5] += KUW(1,2);
-                ke[i6+2][j6+3] += KUW(2,0); ke[i6+2][j6+4] += KUW(2,1); ke[i6+2][j6+5] += KUW(2,2);
-                
-                ke[i6+3][j6  ] += KWU(0,0); ke[i6+3][j6+1] += KWU(0,1); ke[i6+3][j6+2] += KWU(0,2);
-                ke[i6+4][j6  ] += KWU(1,0); ke[i6+4][j6+1] += KWU(1,1); ke[i6+4][j6+2] += KWU(1,2);
-                ke[i6+5][j6  ] += KWU(2,0); ke[i6+5][j6+1] += KWU(2,1); ke[i6+5][j6+2] += KWU(2,2);
-                
-                ke[i6+3][j6+3] += KWW(0,0); ke[i6+3][j6+4] += KWW(0,1); ke[i6+3][j6+5] += KWW(0,2);
-                ke[i6+4][j6+3] += KWW(1,0); ke[i6+4][j6+4] += KWW(1,1); ke[i6+4][j6+5] += KWW(1,2);
-                ke[i6+5][j6+3] += KWW(2,0); ke[i6+5][j6+4] += KWW(2,1); ke[i6+5][j6+5] += KWW(2,2);
-            }
-        }
+        ConstitutiveStiffness(neln, hu, hw, CC, detJt, ke);
         
         // ------------ initial stress component --------------
         
@@ -107,6 +107,7 @@ bool FEElasticEASShellDomain::Init()
     
     // set up EAS arrays
 	m_nEAS = 7;
+	assert(m_nEAS <= MAX_EAS);
 	for (int i=0; i<Elements(); ++i)
     {
         FEShellElementNew& el = ShellElement(i);
@@ -238,8 +239,12 @@ void FEElasticEASShellDomain::ElementInternalForce(FEShellElementNew& el, vector
     // EAS method: Evaluate Kua, Kwa, and Kaa
     // Also evaluate PK2 stress and material tangent using enhanced strain
     EvaluateEAS(el, EE, HU, HW, S, C);
-    matrix Kif(7,1);
-    Kif = el.m_Kaai*el.m_fa;
+    double Kif[MAX_EAS];
+    for (int k=0; k<m_nEAS; ++k)
+    {
+        Kif[k] = 0;
+        for (int l=0; l<m_nEAS; ++l) Kif[k] += el.m_Kaai(k,l)*el.m_fa(l,0);
+    }
     
     vector<matrix> hu(neln, matrix(3,6));
     vector<matrix> hw(neln, matrix(3,6));
@@ -247,25 +252,25 @@ void FEElasticEASShellDomain::ElementInternalForce(FEShellElementNew& el, vector
     vector<vec3d> Nw(neln);
     
     // EAS contribution
-    matrix Fu(3,1), Fw(3,1);
     for (i=0; i<neln; ++i)
     {
-        Fu = el.m_Kua[i]*Kif;
-        Fw = el.m_Kwa[i]*Kif;
-        
-        // calculate internal force
-        // the '-' sign is so that the internal forces get subtracted
-        // from the global residual vector
-        fe[6*i  ] += Fu(0,0);
-        fe[6*i+1] += Fu(1,0);
-        fe[6*i+2] += Fu(2,0);
-        
-        fe[6*i+3] += Fw(0,0);
-        fe[6*i+4] += Fw(1,0);
-        fe[6*i+5] += Fw(2,0);
+        const matrix& Kua = el.m_Kua[i];
+        const matrix& Kwa = el.m_Kwa[i];
+        for (int a=0; a<3; ++a)
+        {
+            double fu = 0, fw = 0;
+            for (int k=0; k<m_nEAS; ++k)
+            {
+                fu += Kua(a,k)*Kif[k];
+                fw += Kwa(a,k)*Kif[k];
+            }
+            fe[6*i+a  ] += fu;
+            fe[6*i+a+3] += fw;
+        }
     }
     
     // repeat for all integration points
+    matrix SC(6,1);
     for (n=0; n<nint; ++n)
     {
         ContraBaseVectors0(el, n, Gcnt);
@@ -275,30 +280,13 @@ void FEElasticEASShellDomain::ElementInternalForce(FEShellElementNew& el, vector
         EvaluateANS(el, n, Gcnt, E, hu, hw, EE, HU, HW);
         
         // evaluate 2nd P-K stress
-        matrix SC(6,1);
         mat3dsCntMat61(S[n], Gcnt, SC);
-        //        mat3ds S = m_pMat->PK2Stress(E);
-        //        mat3dsCntMat61(S, Gcnt, SC);
         
         // calculate the jacobian and multiply by Gauss weight
         detJt = detJ0(el, n)*gw[n];
         
-        for (i=0; i<neln; ++i)
-        {
-            Fu = hu[i]*SC;
-            Fw = hw[i]*SC;
-            
-            // calculate internal force
-            // the '-' sign is so that the internal forces get subtracted
-            // from the global residual vector
-            fe[6*i  ] -= Fu(0,0)*detJt;
-            fe[6*i+1] -= Fu(1,0)*detJt;
-            fe[6*i+2] -= Fu(2,0)*detJt;
-            
-            fe[6*i+3] -= Fw(0,0)*detJt;
-            fe[6*i+4] -= Fw(1,0)*detJt;
-            fe[6*i+5] -= Fw(2,0)*detJt;
-        }
+        // calculate internal force
+        InternalForce(neln, hu, hw, SC, detJt, fe);
     }
 }
 
@@ -640,34 +628,54 @@ void FEElasticEASShellDomain::ElementStiffness(int iel, matrix& ke)
     
     ke.zero();
     
-    matrix KUU(3,3), KUW(3,3), KWU(3,3), KWW(3,3);
+    // static condensation of the EAS parameters: ke -= K_ia*inv(Kaa)*K_ja^T
+    const int NELN = FEElement::MAX_NODES;
+    double KuaK[NELN][3][MAX_EAS], KwaK[NELN][3][MAX_EAS];
+    for (i=0; i<neln; ++i)
+    {
+        const matrix& Kua = el.m_Kua[i];
+        const matrix& Kwa = el.m_Kwa[i];
+        for (int a=0; a<3; ++a)
+            for (int k=0; k<m_nEAS; ++k)
+            {
+                double su = 0, sw = 0;
+                for (int l=0; l<m_nEAS; ++l)
+                {
+                    su += Kua(a,l)*el.m_Kaai(l,k);
+                    sw += Kwa(a,l)*el.m_Kaai(l,k);
+                }
+                KuaK[i][a][k] = su;
+                KwaK[i][a][k] = sw;
+            }
+    }
+    
     for (i=0, i6=0; i<neln; ++i, i6 += 6)
     {
         for (j=0, j6 = 0; j<neln; ++j, j6 += 6)
         {
-            KUU = (el.m_Kua[i]*el.m_Kaai*el.m_Kua[j].transpose());
-            KUW = (el.m_Kua[i]*el.m_Kaai*el.m_Kwa[j].transpose());
-            KWU = (el.m_Kwa[i]*el.m_Kaai*el.m_Kua[j].transpose());
-            KWW = (el.m_Kwa[i]*el.m_Kaai*el.m_Kwa[j].transpose());
-            
-            ke[i6  ][j6  ] -= KUU(0,0); ke[i6  ][j6+1] -= KUU(0,1); ke[i6  ][j6+2] -= KUU(0,2);
-            ke[i6+1][j6  ] -= KUU(1,0); ke[i6+1][j6+1] -= KUU(1,1); ke[i6+1][j6+2] -= KUU(1,2);
-            ke[i6+2][j6  ] -= KUU(2,0); ke[i6+2][j6+1] -= KUU(2,1); ke[i6+2][j6+2] -= KUU(2,2);
-            
-            ke[i6  ][j6+3] -= KUW(0,0); ke[i6  ][j6+4] -= KUW(0,1); ke[i6  ][j6+5] -= KUW(0,2);
-            ke[i6+1][j6+3] -= KUW(1,0); ke[i6+1][j6+4] -= KUW(1,1); ke[i6+1][j6+5] -= KUW(1,2);
-            ke[i6+2][j6+3] -= KUW(2,0); ke[i6+2][j6+4] -= KUW(2,1); ke[i6+2][j6+5] -= KUW(2,2);
-            
-            ke[i6+3][j6  ] -= KWU(0,0); ke[i6+3][j6+1] -= KWU(0,1); ke[i6+3][j6+2] -= KWU(0,2);
-            ke[i6+4][j6  ] -= KWU(1,0); ke[i6+4][j6+1] -= KWU(1,1); ke[i6+4][j6+2] -= KWU(1,2);
-            ke[i6+5][j6  ] -= KWU(2,0); ke[i6+5][j6+1] -= KWU(2,1); ke[i6+5][j6+2] -= KWU(2,2);
-            
-            ke[i6+3][j6+3] -= KWW(0,0); ke[i6+3][j6+4] -= KWW(0,1); ke[i6+3][j6+5] -= KWW(0,2);
-            ke[i6+4][j6+3] -= KWW(1,0); ke[i6+4][j6+4] -= KWW(1,1); ke[i6+4][j6+5] -= KWW(1,2);
-            ke[i6+5][j6+3] -= KWW(2,0); ke[i6+5][j6+4] -= KWW(2,1); ke[i6+5][j6+5] -= KWW(2,2);
+            const matrix& Kua = el.m_Kua[j];
+            const matrix& Kwa = el.m_Kwa[j];
+            for (int a=0; a<3; ++a)
+                for (int b=0; b<3; ++b)
+                {
+                    double kuu = 0, kuw = 0, kwu = 0, kww = 0;
+                    for (int k=0; k<m_nEAS; ++k)
+                    {
+                        kuu += KuaK[i][a][k]*Kua(b,k);
+                        kuw += KuaK[i][a][k]*Kwa(b,k);
+                        kwu += KwaK[i][a][k]*Kua(b,k);
+                        kww += KwaK[i][a][k]*Kwa(b,k);
+                    }
+                    ke[i6+a  ][j6+b  ] -= kuu;
+                    ke[i6+a  ][j6+b+3] -= kuw;
+                    ke[i6+a+3][j6+b  ] -= kwu;
+                    ke[i6+a+3][j6+b+3] -= kww;
+                }
         }
     }
     
+    matrix SC(6,1);
+    matrix CC(6,6);
     for (n=0; n<nint; ++n)
     {
         ContraBaseVectors0(el, n, Gcnt);
@@ -680,48 +688,14 @@ void FEElasticEASShellDomain::ElementStiffness(int iel, matrix& ke)
         detJt = detJ0(el, n)*gw[n];
         
         // evaluate 2nd P-K stress
-        matrix SC(6,1);
         mat3dsCntMat61(S[n], Gcnt, SC);
-        //        mat3ds S = m_pMat->PK2Stress(E);
-        //        mat3dsCntMat61(S, Gcnt, SC);
         
         // evaluate the material tangent
-        matrix CC(6,6);
         tens4dmmCntMat66(C[n], Gcnt, CC);
-//        tens4dsCntMat66(C[n], Gcnt, CC);
-        //        tens4ds c = m_pMat->MaterialTangent(E);
-        //        tens4dsCntMat66(c, Gcnt, CC);
         
         // ------------ constitutive component --------------
         
-        for (i=0, i6=0; i<neln; ++i, i6 += 6)
-        {
-            for (j=0, j6 = 0; j<neln; ++j, j6 += 6)
-            {
-                matrix KUU(3,3), KUW(3,3), KWU(3,3), KWW(3,3);
-                KUU = hu[i]*CC*hu[j].transpose();
-                KUW = hu[i]*CC*hw[j].transpose();
-                KWU = hw[i]*CC*hu[j].transpose();
-                KWW = hw[i]*CC*hw[j].transpose();
-                KUU *= detJt; KUW *= detJt; KWU *= detJt; KWW *= detJt;
-                
-                ke[i6  ][j6  ] += KUU(0,0); ke[i6  ][j6+1] += KUU(0,1); ke[i6  ][j6+2] += KUU(0,2);
-                ke[i6+1][j6  ] += KUU(1,0); ke[i6+1][j6+1] += KUU(1,1); ke[i6+1][j6+2] += KUU(1,2);
-                ke[i6+2][j6  ] += KUU(2,0); ke[i6+2][j6+1] += KUU(2,1); ke[i6+2][j6+2] += KUU(2,2);
-                
-                ke[i6  ][j6+3] += KUW(0,0); ke[i6  ][j6+4] += KUW(0,1); ke[i6  ][j6+5] += KUW(0,2);
-                ke[i6+1][j6+3] += KUW(1,0); ke[i6+1][j6+4] += KUW(1,1); ke[i6+1][j6+5] += KUW(1,2);
-                ke[i6+2][j6+3] += KUW(2,0); ke[i6+2][j6+4] += KUW(2,1); ke[i6+2][j6+5] += KUW(2,2);
-                
-                ke[i6+3][j6  ] += KWU(0,0); ke[i6+3][j6+1] += KWU(0,1); ke[i6+3][j6+2] += KWU(0,2);
-                ke[i6+4][j6  ] += KWU(1,0); ke[i6+4][j6+1] += KWU(1,1); ke[i6+4][j6+2] += KWU(1,2);
-                ke[i6+5][j6  ] += KWU(2,0); ke[i6+5][j6+1] += KWU(2,1); ke[i6+5][j6+2] += KWU(2,2);
-                
-                ke[i6+3][j6+3] += KWW(0,0); ke[i6+3][j6+4] += KWW(0,1); ke[i6+3][j6+5] += KWW(0,2);
-                ke[i6+4][j6+3] += KWW(1,0); ke[i6+4][j6+4] += KWW(1,1); ke[i6+4][j6+5] += KWW(1,2);
-                ke[i6+5][j6+3] += KWW(2,0); ke[i6+5][j6+4] += KWW(2,1); ke[i6+5][j6+5] += KWW(2,2);
-            }
-        }
+        ConstitutiveStiffness(neln, hu, hw, CC, detJt, ke);
         
         // ------------ initial stress component --------------
         
@@ -958,38 +932,57 @@ void FEElasticEASShellDomain::ElementBodyForce(FEModel& fem, FEShellElementNew&
 }
 
 //-----------------------------------------------------------------------------
-// Update alpha in EAS method
-void FEElasticEASShellDomain::UpdateEAS(vector<double>& ui)
+// Evaluate dalpha = inv(Kaa)*(fa + sum_j (Kua_j^T*Du_j + Kwa_j^T*Dw_j))
+void FEElasticEASShellDomain::EvaluateEASIncrement(FEShellElementNew& el, const vector<double>& ui, double* dalpha)
 {
     FEMesh& mesh = *GetMesh();
     
-    for (int i=0; i<(int) m_Elem.size(); ++i)
+    // number of nodes
+    int neln = el.Nodes();
+    
+    double r[MAX_EAS];
+    for (int k=0; k<m_nEAS; ++k) r[k] = el.m_fa(k,0);
+    
+    for (int j=0; j<neln; ++j)
     {
-        // get the solid element
-		FEShellElementNew& el = m_Elem[i];
-        
-        // number of nodes
-        int neln = el.Nodes();
-        
-        // allocate arrays
-        matrix dalpha(m_nEAS,1);
-        matrix Du(3,1), Dw(3,1);
-        
-        // nodal coordinates and EAS vector alpha update
-        dalpha = el.m_fa;
-        for (int j=0; j<neln; ++j)
+        FENode& nj = mesh.Node(el.m_node[j]);
+        double Du[3], Dw[3];
+        for (int a=0; a<3; ++a)
         {
-            FENode& nj = mesh.Node(el.m_node[j]);
-            Du(0,0) = (nj.m_ID[m_dofU[0]] >=0) ? ui[nj.m_ID[m_dofU[0]]] : 0;
-            Du(1,0) = (nj.m_ID[m_dofU[1]] >=0) ? ui[nj.m_ID[m_dofU[1]]] : 0;
-            Du(2,0) = (nj.m_ID[m_dofU[2]] >=0) ? ui[nj.m_ID[m_dofU[2]]] : 0;
-            Dw(0,0) = (nj.m_ID[m_dofSU[0]] >=0) ? ui[nj.m_ID[m_dofSU[0]]] : 0;
-            Dw(1,0) = (nj.m_ID[m_dofSU[1]] >=0) ? ui[nj.m_ID[m_dofSU[1]]] : 0;
-            Dw(2,0) = (nj.m_ID[m_dofSU[2]] >=0) ? ui[nj.m_ID[m_dofSU[2]]] : 0;
-            dalpha += el.m_Kua[j].transpose()*Du + el.m_Kwa[j].transpose()*Dw;
+            Du[a] = (nj.m_ID[m_dofU [a]] >=0) ? ui[nj.m_ID[m_dofU [a]]] : 0;
+            Dw[a] = (nj.m_ID[m_dofSU[a]] >=0) ? ui[nj.m_ID[m_dofSU[a]]] : 0;
         }
-        dalpha = el.m_Kaai*dalpha;
-        el.m_alpha = el.m_alphat + el.m_alphai - dalpha;
+        
+        const matrix& Kua = el.m_Kua[j];
+        const matrix& Kwa = el.m_Kwa[j];
+        for (int k=0; k<m_nEAS; ++k)
+            r[k] += Kua(0,k)*Du[0] + Kua(1,k)*Du[1] + Kua(2,k)*Du[2]
+                  + Kwa(0,k)*Dw[0] + Kwa(1,k)*Dw[1] + Kwa(2,k)*Dw[2];
+    }
+    
+    for (int k=0; k<m_nEAS; ++k)
+    {
+        dalpha[k] = 0;
+        for (int l=0; l<m_nEAS; ++l) dalpha[k] += el.m_Kaai(k,l)*r[l];
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Update alpha in EAS method
+void FEElasticEASShellDomain::UpdateEAS(vector<double>& ui)
+{
+    int NE = (int) m_Elem.size();
+#pragma omp parallel for shared(NE)
+    for (int i=0; i<NE; ++i)
+    {
+        // get the solid element
+        FEShellElementNew& el = m_Elem[i];
+        
+        // EAS vector alpha update
+        double dalpha[MAX_EAS];
+        EvaluateEASIncrement(el, ui, dalpha);
+        for (int k=0; k<m_nEAS; ++k)
+            el.m_alpha(k,0) = el.m_alphat(k,0) + el.m_alphai(k,0) - dalpha[k];
     }
 }
 
@@ -997,36 +990,18 @@ void FEElasticEASShellDomain::UpdateEAS(vector<double>& ui)
 // Update alpha in EAS method
 void FEElasticEASShellDomain::UpdateIncrementsEAS(vector<double>& ui, const bool binc)
 {
-    FEMesh& mesh = *GetMesh();
-    
-    for (int i=0; i<(int) m_Elem.size(); ++i)
+    int NE = (int) m_Elem.size();
+#pragma omp parallel for shared(NE)
+    for (int i=0; i<NE; ++i)
     {
         // get the solid element
-		FEShellElementNew& el = m_Elem[i];
+        FEShellElementNew& el = m_Elem[i];
         
         if (binc) {
-            // number of nodes
-            int neln = el.Nodes();
-            
-            // allocate arrays
-            matrix dalpha(m_nEAS,1);
-            matrix Du(3,1), Dw(3,1);
-            
-            // nodal coordinates and EAS vector alpha update
-            dalpha = el.m_fa;
-            for (int j=0; j<neln; ++j)
-            {
-                FENode& nj = mesh.Node(el.m_node[j]);
-                Du(0,0) = (nj.m_ID[m_dofU[0]] >=0) ? ui[nj.m_ID[m_dofU[0]]] : 0;
-                Du(1,0) = (nj.m_ID[m_dofU[1]] >=0) ? ui[nj.m_ID[m_dofU[1]]] : 0;
-                Du(2,0) = (nj.m_ID[m_dofU[2]] >=0) ? ui[nj.m_ID[m_dofU[2]]] : 0;
-                Dw(0,0) = (nj.m_ID[m_dofSU[0]] >=0) ? ui[nj.m_ID[m_dofSU[0]]] : 0;
-                Dw(1,0) = (nj.m_ID[m_dofSU[1]] >=0) ? ui[nj.m_ID[m_dofSU[1]]] : 0;
-                Dw(2,0) = (nj.m_ID[m_dofSU[2]] >=0) ? ui[nj.m_ID[m_dofSU[2]]] : 0;
-                dalpha += el.m_Kua[j].transpose()*Du + el.m_Kwa[j].transpose()*Dw;
-            }
-            dalpha = el.m_Kaai*dalpha;
-            el.m_alphai -= dalpha;
+            // EAS vector alpha update
+            double dalpha[MAX_EAS];
+            EvaluateEASIncrement(el, ui, dalpha);
+            for (int k=0; k<m_nEAS; ++k) el.m_alphai(k,0) -= dalpha[k];
         }
         else el.m_alphat += el.m_alphai;
     }
@@ -1216,67 +1191,67 @@ void FEElasticEASShellDomain::GenerateGMatrix(FEShellElementNew& el, const int n
     double G21 = Gcov[2]*Gcnt[1];
     double G22 = Gcov[2]*Gcnt[2];
     
-    matrix T0(6,6);
-    T0(0,0) = G00*G00; T0(0,1) = G01*G01; T0(0,2) = G02*G02; T0(0,3) = G00*G01; T0(0,4) = G01*G02; T0(0,5) = G00*G02;
-    T0(1,0) = G10*G10; T0(1,1) = G11*G11; T0(1,2) = G12*G12; T0(1,3) = G10*G11; T0(1,4) = G11*G12; T0(1,5) = G10*G12;
-    T0(2,0) = G20*G20; T0(2,1) = G21*G21; T0(2,2) = G22*G22; T0(2,3) = G20*G21; T0(2,4) = G21*G22; T0(2,5) = G20*G22;
-    T0(3,0) = 2*G00*G10; T0(3,1) = 2*G01*G11; T0(3,2) = 2*G02*G12; T0(3,3) = G00*G11+G01*G10; T0(3,4) = G01*G12+G02*G11; T0(3,5) = G00*G12+G02*G10;
-    T0(4,0) = 2*G10*G20; T0(4,1) = 2*G11*G21; T0(4,2) = 2*G12*G22; T0(4,3) = G10*G21+G11*G20; T0(4,4) = G11*G22+G12*G21; T0(4,5) = G10*G22+G12*G20;
-    T0(5,0) = 2*G00*G20; T0(5,1) = 2*G01*G21; T0(5,2) = 2*G02*G22; T0(5,3) = G00*G21+G01*G20; T0(5,4) = G01*G22+G02*G21; T0(5,5) = G00*G22+G02*G20;
+    double T0[6][6];
+    T0[0][0] = G00*G00; T0[0][1] = G01*G01; T0[0][2] = G02*G02; T0[0][3] = G00*G01; T0[0][4] = G01*G02; T0[0][5] = G00*G02;
+    T0[1][0] = G10*G10; T0[1][1] = G11*G11; T0[1][2] = G12*G12; T0[1][3] = G10*G11; T0[1][4] = G11*G12; T0[1][5] = G10*G12;
+    T0[2][0] = G20*G20; T0[2][1] = G21*G21; T0[2][2] = G22*G22; T0[2][3] = G20*G21; T0[2][4] = G21*G22; T0[2][5] = G20*G22;
+    T0[3][0] = 2*G00*G10; T0[3][1] = 2*G01*G11; T0[3][2] = 2*G02*G12; T0[3][3] = G00*G11+G01*G10; T0[3][4] = G01*G12+G02*G11; T0[3][5] = G00*G12+G02*G10;
+    T0[4][0] = 2*G10*G20; T0[4][1] = 2*G11*G21; T0[4][2] = 2*G12*G22; T0[4][3] = G10*G21+G11*G20; T0[4][4] = G11*G22+G12*G21; T0[4][5] = G10*G22+G12*G20;
+    T0[5][0] = 2*G00*G20; T0[5][1] = 2*G01*G21; T0[5][2] = 2*G02*G22; T0[5][3] = G00*G21+G01*G20; T0[5][4] = G01*G22+G02*G21; T0[5][5] = G00*G22+G02*G20;
     
     G.resize(6, m_nEAS);
     double r = el.gr(n);
     double s = el.gs(n);
     double t = el.gt(n);
     
-    G(0,0) = r*T0(0,0)*Jr;
-    G(1,0) = r*T0(1,0)*Jr;
-    G(2,0) = r*T0(2,0)*Jr;
-    G(3,0) = r*T0(3,0)*Jr;
-    G(4,0) = r*T0(4,0)*Jr;
-    G(5,0) = r*T0(5,0)*Jr;
-    
-    G(0,1) = s*T0(0,1)*Jr;
-    G(1,1) = s*T0(1,1)*Jr;
-    G(2,1) = s*T0(2,1)*Jr;
-    G(3,1) = s*T0(3,1)*Jr;
-    G(4,1) = s*T0(4,1)*Jr;
-    G(5,1) = s*T0(5,1)*Jr;
-    
-    G(0,2) = t*T0(0,2)*Jr;
-    G(1,2) = t*T0(1,2)*Jr;
-    G(2,2) = t*T0(2,2)*Jr;
-    G(3,2) = t*T0(3,2)*Jr;
-    G(4,2) = t*T0(4,2)*Jr;
-    G(5,2) = t*T0(5,2)*Jr;
-    
-    G(0,3) = r*t*T0(0,2)*Jr;
-    G(1,3) = r*t*T0(1,2)*Jr;
-    G(2,3) = r*t*T0(2,2)*Jr;
-    G(3,3) = r*t*T0(3,2)*Jr;
-    G(4,3) = r*t*T0(4,2)*Jr;
-    G(5,3) = r*t*T0(5,2)*Jr;
-    
-    G(0,4) = s*t*T0(0,2)*Jr;
-    G(1,4) = s*t*T0(1,2)*Jr;
-    G(2,4) = s*t*T0(2,2)*Jr;
-    G(3,4) = s*t*T0(3,2)*Jr;
-    G(4,4) = s*t*T0(4,2)*Jr;
-    G(5,4) = s*t*T0(5,2)*Jr;
-    
-    G(0,5) = r*T0(0,3)*Jr;
-    G(1,5) = r*T0(1,3)*Jr;
-    G(2,5) = r*T0(2,3)*Jr;
-    G(3,5) = r*T0(3,3)*Jr;
-    G(4,5) = r*T0(4,3)*Jr;
-    G(5,5) = r*T0(5,3)*Jr;
-    
-    G(0,6) = s*T0(0,3)*Jr;
-    G(1,6) = s*T0(1,3)*Jr;
-    G(2,6) = s*T0(2,3)*Jr;
-    G(3,6) = s*T0(3,3)*Jr;
-    G(4,6) = s*T0(4,3)*Jr;
-    G(5,6) = s*T0(5,3)*Jr;
+    G(0,0) = r*T0[0][0]*Jr;
+    G(1,0) = r*T0[1][0]*Jr;
+    G(2,0) = r*T0[2][0]*Jr;
+    G(3,0) = r*T0[3][0]*Jr;
+    G(4,0) = r*T0[4][0]*Jr;
+    G(5,0) = r*T0[5][0]*Jr;
+    
+    G(0,1) = s*T0[0][1]*Jr;
+    G(1,1) = s*T0[1][1]*Jr;
+    G(2,1) = s*T0[2][1]*Jr;
+    G(3,1) = s*T0[3][1]*Jr;
+    G(4,1) = s*T0[4][1]*Jr;
+    G(5,1) = s*T0[5][1]*Jr;
+    
+    G(0,2) = t*T0[0][2]*Jr;
+    G(1,2) = t*T0[1][2]*Jr;
+    G(2,2) = t*T0[2][2]*Jr;
+    G(3,2) = t*T0[3][2]*Jr;
+    G(4,2) = t*T0[4][2]*Jr;
+    G(5,2) = t*T0[5][2]*Jr;
+    
+    G(0,3) = r*t*T0[0][2]*Jr;
+    G(1,3) = r*t*T0[1][2]*Jr;
+    G(2,3) = r*t*T0[2][2]*Jr;
+    G(3,3) = r*t*T0[3][2]*Jr;
+    G(4,3) = r*t*T0[4][2]*Jr;
+    G(5,3) = r*t*T0[5][2]*Jr;
+    
+    G(0,4) = s*t*T0[0][2]*Jr;
+    G(1,4) = s*t*T0[1][2]*Jr;
+    G(2,4) = s*t*T0[2][2]*Jr;
+    G(3,4) = s*t*T0[3][2]*Jr;
+    G(4,4) = s*t*T0[4][2]*Jr;
+    G(5,4) = s*t*T0[5][2]*Jr;
+    
+    G(0,5) = r*T0[0][3]*Jr;
+    G(1,5) = r*T0[1][3]*Jr;
+    G(2,5) = r*T0[2][3]*Jr;
+    G(3,5) = r*T0[3][3]*Jr;
+    G(4,5) = r*T0[4][3]*Jr;
+    G(5,5) = r*T0[5][3]*Jr;
+    
+    G(0,6) = s*T0[0][3]*Jr;
+    G(1,6) = s*T0[1][3]*Jr;
+    G(2,6) = s*T0[2][3]*Jr;
+    G(3,6) = s*T0[3][3]*Jr;
+    G(4,6) = s*T0[4][3]*Jr;
+    G(5,6) = s*T0[5][3]*Jr;
 }
 
 //-----------------------------------------------------------------------------
@@ -1364,8 +1339,6 @@ void FEElasticEASShellDomain::EvaluateEAS(FEShellElementNew& el, vector<double>&
     // jacobian matrix determinant
     double detJt;
     
-    const double* Mr, *Ms, *M;
-    
     int nint = el.GaussPoints();
     int neln = el.Nodes();
     
@@ -1377,7 +1350,6 @@ void FEElasticEASShellDomain::EvaluateEAS(FEShellElementNew& el, vector<double>&
     matrix NN(neln,8);
     
     double*    gw = el.GaussWeights();
-    double eta;
     vec3d Gcnt[3];
     
     // Evaluate fa, Kua, Kwa, and Kaa by integrating over the element
@@ -1388,6 +1360,11 @@ void FEElasticEASShellDomain::EvaluateEAS(FEShellElementNew& el, vector<double>&
         el.m_Kwa[i].zero();
     }
     
+    // these are reused for all integration points
+    matrix G(6, m_nEAS);
+    matrix SM(6, 1);
+    matrix CC(6, 6);
+    
     // repeat for all integration points
     for (n=0; n<nint; ++n)
     {
@@ -1404,61 +1381,78 @@ void FEElasticEASShellDomain::EvaluateEAS(FEShellElementNew& el, vector<double>&
         detJt = detJ0(el, n);
         
         // generate G matrix for EAS method
-        matrix G;
         GenerateGMatrix(el, n, detJt, G);
         
         detJt *= gw[n];
         
-        // Evaluate enhancing strain ES (covariant components)
-        matrix ES(6,1);
-        ES = G*el.m_alpha;
+        // Evaluate enhancing strain ES = G*alpha (covariant components)
+        double ES[6];
+        for (int a=0; a<6; ++a)
+        {
+            ES[a] = 0;
+            for (int k=0; k<m_nEAS; ++k) ES[a] += G(a,k)*el.m_alpha(k,0);
+        }
         // Evaluate the tensor form of ES
-        mat3ds Es = ((Gcnt[0] & Gcnt[0])*ES(0,0) + (Gcnt[1] & Gcnt[1])*ES(1,0) + (Gcnt[2] & Gcnt[2])*ES(2,0) +
-                     ((Gcnt[0] & Gcnt[1]) + (Gcnt[1] & Gcnt[0]))*(ES(3,0)/2) +
-                     ((Gcnt[1] & Gcnt[2]) + (Gcnt[2] & Gcnt[1]))*(ES(4,0)/2) +
-                     ((Gcnt[2] & Gcnt[0]) + (Gcnt[0] & Gcnt[2]))*(ES(5,0)/2)).sym();
+        mat3ds Es = ((Gcnt[0] & Gcnt[0])*ES[0] + (Gcnt[1] & Gcnt[1])*ES[1] + (Gcnt[2] & Gcnt[2])*ES[2] +
+                     ((Gcnt[0] & Gcnt[1]) + (Gcnt[1] & Gcnt[0]))*(ES[3]/2) +
+                     ((Gcnt[1] & Gcnt[2]) + (Gcnt[2] & Gcnt[1]))*(ES[4]/2) +
+                     ((Gcnt[2] & Gcnt[0]) + (Gcnt[0] & Gcnt[2]))*(ES[5]/2)).sym();
         // Evaluate enhanced strain
         el.m_E[n] = Ec + Es;
         
         // get the stress tensor for this integration point and evaluate its contravariant components
         S[n] = m_pMat->PK2Stress(mp, el.m_E[n]);
-        matrix SM;
         mat3dsCntMat61(S[n], Gcnt, SM);
         
         // get the material tangent
         c[n] = m_pMat->MaterialTangent(mp, el.m_E[n]);
         // get contravariant components of material tangent
-        matrix CC;
         tens4dmmCntMat66(c[n], Gcnt, CC);
-//        tens4dsCntMat66(c[n], Gcnt, CC);
         
-        // Evaluate fa
-        matrix tmp(m_nEAS,1);
-        tmp = G.transpose()*SM;
-        tmp *= detJt;
-        el.m_fa += tmp;
-        
-        // Evaluate Kaa
-        matrix Tmpa(m_nEAS,m_nEAS);
-        Tmpa = G.transpose()*CC*G;
-        Tmpa *= detJt;
-        el.m_Kaai += Tmpa;
+        // CG = CC*G*detJt
+        double CG[6][MAX_EAS];
+        for (int a=0; a<6; ++a)
+            for (int k=0; k<m_nEAS; ++k)
+            {
+                double sum = 0;
+                for (int l=0; l<6; ++l) sum += CC(a,l)*G(l,k);
+                CG[a][k] = sum*detJt;
+            }
         
-        eta = el.gt(n);
-        Mr = el.Hr(n);
-        Ms = el.Hs(n);
-        M  = el.H(n);
+        // Evaluate fa and Kaa
+        for (int k=0; k<m_nEAS; ++k)
+        {
+            double fa = 0;
+            for (int l=0; l<6; ++l) fa += G(l,k)*SM(l,0);
+            el.m_fa(k,0) += fa*detJt;
+            
+            for (int m=0; m<m_nEAS; ++m)
+            {
+                double kaa = 0;
+                for (int l=0; l<6; ++l) kaa += G(l,k)*CG[l][m];
+                el.m_Kaai(k,m) += kaa;
+            }
+        }
         
         // Evaluate Kua and Kwa
-        matrix Tmp(3,m_nEAS);
         for (i=0; i<neln; ++i)
         {
-            Tmp = hu[i]*CC*G;
-            Tmp *= detJt;
-            el.m_Kua[i] += Tmp;
-            Tmp = hw[i]*CC*G;
-            Tmp *= detJt;
-            el.m_Kwa[i] += Tmp;
+            const matrix& hui = hu[i];
+            const matrix& hwi = hw[i];
+            matrix& Kua = el.m_Kua[i];
+            matrix& Kwa = el.m_Kwa[i];
+            for (int a=0; a<3; ++a)
+                for (int k=0; k<m_nEAS; ++k)
+                {
+                    double su = 0, sw = 0;
+                    for (int l=0; l<6; ++l)
+                    {
+                        su += hui(a,l)*CG[l][k];
+                        sw += hwi(a,l)*CG[l][k];
+                    }
+                    Kua(a,k) += su;
+                    Kwa(a,k) += sw;
+                }
         }
     }
     // invert Kaa
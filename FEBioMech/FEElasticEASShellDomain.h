@@ -35,6 +35,9 @@ SOFTWARE.*/
 //! Domain described by 3D shell elements
 class FEBIOMECH_API FEElasticEASShellDomain : public FESSIShellDomain, public FEElasticDomain
 {
+public:
+    enum { MAX_EAS = 7 };   //!< max number of EAS parameters (for stack storage)
+
 public:
     FEElasticEASShellDomain(FEModel* pfem);
     
@@ -153,6 +156,10 @@ public:
     void UpdateEAS(vector<double>& ui) override;
     void UpdateIncrementsEAS(vector<double>& ui, const bool binc) override;
     
+protected:
+    // Evaluate the increment of the EAS parameters from the solution increment ui
+    void EvaluateEASIncrement(FEShellElementNew& el, const vector<double>& ui, double* dalpha);
+    
 protected:
     FESolidMaterial*    m_pMat;
     int                 m_nEAS;
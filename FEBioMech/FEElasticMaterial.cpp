@@ -100,6 +100,24 @@ mat3ds FEElasticMaterial::SecantStress(FEMaterialPoint& mp, bool PK2)
     }
 }
 
+//-----------------------------------------------------------------------------
+//! evaluate the Cauchy stress at a block of material points
+void FEElasticMaterial::BlockStress(FEMaterialPoint** mp, int n)
+{
+	for (int i = 0; i < n; ++i)
+	{
+		FEElasticMaterialPoint& pt = *mp[i]->ExtractData<FEElasticMaterialPoint>();
+		pt.m_s = Stress(*mp[i]);
+	}
+}
+
+//-----------------------------------------------------------------------------
+//! evaluate the spatial tangent at a block of material points
+void FEElasticMaterial::BlockTangent(FEMaterialPoint** mp, int n, tens4ds* c)
+{
+	for (int i = 0; i < n; ++i) c[i] = Tangent(*mp[i]);
+}
+
 //-----------------------------------------------------------------------------
 //! return the strain energy density
 double FEElasticMaterial::StrainEnergyDensity(FEMaterialPoint& pt) { return 0; }
@@ -55,6 +55,19 @@ public:
 	//! evaluates approximation to Cauchy stress using forward difference
 	mat3ds SecantStress(FEMaterialPoint& pt, bool PK2 = false) override;
 
+public:
+	//! returns true if the material provides a specialized block evaluation
+	virtual bool HasBlockEvaluation() const { return false; }
+
+	//! evaluate the Cauchy stress at a block of n material points. The points may
+	//! belong to different elements. The stress is stored in the m_s member of each
+	//! point's elastic data. The default calls Stress for each point.
+	virtual void BlockStress(FEMaterialPoint** mp, int n);
+
+	//! evaluate the spatial tangent at a block of n material points.
+	//! c[i] is the tangent at point i. The default calls Tangent for each point.
+	virtual void BlockTangent(FEMaterialPoint** mp, int n, tens4ds* c);
+
 public:
     virtual double StrongBondSED(FEMaterialPoint& pt) { return StrainEnergyDensity(pt); }
     virtual double WeakBondSED(FEMaterialPoint& pt) { return 0; }
@@ -38,6 +38,7 @@ SOFTWARE.*/
 #include "FEBioMech.h"
 #include <FECore/FELinearSystem.h>
 #include "FEResidualVector.h"
+#include <FECore/FEProfiler.h>
 
 //-----------------------------------------------------------------------------
 //! constructor
@@ -101,6 +102,16 @@ void FEElasticSolidDomain::SetMaterial(FEMaterial* pmat)
 	else m_pMat = 0;
 }
 
+//-----------------------------------------------------------------------------
+//! Returns the material if it can evaluate all the integration points of an 
+//! element in one call. Derived classes may assign m_pMat directly, so this is
+//! not cached in SetMaterial.
+FEElasticMaterial* FEElasticSolidDomain::BlockMaterial()
+{
+	FEElasticMaterial* pme = dynamic_cast<FEElasticMaterial*>(m_pMat);
+	return (pme && pme->HasBlockEvaluation() ? pme : nullptr);
+}
+
 //-----------------------------------------------------------------------------
 void FEElasticSolidDomain::Activate()
 {
@@ -145,7 +156,7 @@ void FEElasticSolidDomain::PreSolveUpdate(const FETimeInfo& timeInfo)
 #pragma omp parallel for
 	for (int i=0; i<Elements(); ++i)
 	{
-		FESolidElement& el = m_Elem[i];
+		FESolidElement& el = m_Elem[ElementOrder(i)];
 		if (el.isActive())
 		{
 			int n = el.GaussPoints();
@@ -169,7 +180,7 @@ void FEElasticSolidDomain::InternalForces(FEGlobalVector& R)
 	for (int i=0; i<NE; ++i)
 	{
 		// get the element
-		FESolidElement& el = m_Elem[i];
+		FESolidElement& el = m_Elem[ElementOrder(i)];
 
 		if (el.isActive()) {
 			// element force vector
@@ -321,6 +332,14 @@ void FEElasticSolidDomain::ElementGeometricalStiffness(FESolidElement &el, matri
 //! Calculates element material stiffness element matrix
 
 void FEElasticSolidDomain::ElementMaterialStiffness(FESolidElement &el, matrix &ke)
+{
+	ElementMaterialStiffness(el, ke, nullptr);
+}
+
+//-----------------------------------------------------------------------------
+//! Calculates element material stiffness element matrix. If C is not null, it 
+//! contains the tangents at the element's integration points.
+void FEElasticSolidDomain::ElementMaterialStiffness(FESolidElement &el, matrix &ke, tens4ds* C)
 {
 	// Get the current element's data
 	const int nint = el.GaussPoints();
@@ -355,9 +374,13 @@ void FEElasticSolidDomain::ElementMaterialStiffness(FESolidElement &el, matrix &
 		FEMaterialPoint& mp = *el.GetMaterialPoint(n);
 
 		// get the 'D' matrix
-//		tens4ds C = m_pMat->Tangent(mp);
-        tens4dmm C = (m_secant_tangent ? m_pMat->SecantTangent(mp) : m_pMat->SolidTangent(mp));
-		C.extract(D);
+		if (C) C[n].extract(D);
+		else
+		{
+//			tens4ds Cn = m_pMat->Tangent(mp);
+			tens4dmm Cn = (m_secant_tangent ? m_pMat->SecantTangent(mp) : m_pMat->SolidTangent(mp));
+			Cn.extract(D);
+		}
 
 		// we only calculate the upper triangular part
 		// since ke is symmetric. The other part is
@@ -418,43 +441,81 @@ void FEElasticSolidDomain::ElementMaterialStiffness(FESolidElement &el, matrix &
 //-----------------------------------------------------------------------------
 void FEElasticSolidDomain::StiffnessMatrix(FELinearSystem& LS)
 {
+	// When the material supports it, the tangents are evaluated for all the
+	// integration points of a block of elements in one call.
+	FEElasticMaterial* pbm = (m_secant_tangent || m_pMat->UseSecantTangent() ? nullptr : BlockMaterial());
+
 	// repeat over all solid elements
 	int NE = Elements();
-	
-	#pragma omp parallel for shared (NE)
-	for (int iel=0; iel<NE; ++iel)
-	{
-		FESolidElement& el = m_Elem[iel];
-
-		if (el.isActive()) {
-
-			// get the element's LM vector
-			vector<int> lm;
-			UnpackLM(el, lm);
-
-			// element stiffness matrix
-			FEElementMatrix ke(el, lm);
+	int NB = (NE + ELEMENT_BLOCK - 1) / ELEMENT_BLOCK;
 
-			// create the element's stiffness matrix
-			int ndof = 3 * el.Nodes();
-			ke.resize(ndof, ndof);
-			ke.zero();
+	#pragma omp parallel shared (NE, NB)
+	{
+		vector<FEMaterialPoint*> mpb(pbm ? ELEMENT_BLOCK*FEElement::MAX_INTPOINTS : 0);
+		vector<tens4ds> C(pbm ? ELEMENT_BLOCK*FEElement::MAX_INTPOINTS : 0);
 
-			// calculate geometrical stiffness
-			ElementGeometricalStiffness(el, ke);
+		#pragma omp for
+		for (int nb = 0; nb < NB; ++nb)
+		{
+			int n0 = nb*ELEMENT_BLOCK;
+			int n1 = (n0 + ELEMENT_BLOCK < NE ? n0 + ELEMENT_BLOCK : NE);
 
-			// calculate material stiffness
-			ElementMaterialStiffness(el, ke);
+			// evaluate the tangents of the block's active elements
+			if (pbm)
+			{
+				int npts = 0;
+				for (int iel = n0; iel < n1; ++iel)
+				{
+					FESolidElement& el = m_Elem[ElementOrder(iel)];
+					if (el.isActive())
+					{
+						for (int n = 0; n < el.GaussPoints(); ++n) mpb[npts++] = el.GetMaterialPoint(n);
+					}
+				}
+				if (npts > 0) pbm->BlockTangent(&mpb[0], npts, &C[0]);
+			}
 
-/*			// assign symmetic parts
-			// TODO: Can this be omitted by changing the Assemble routine so that it only
-			// grabs elements from the upper diagonal matrix?
-			for (int i = 0; i < ndof; ++i)
-				for (int j = i + 1; j < ndof; ++j)
-					ke[j][i] = ke[i][j];
+			int m = 0;
+			for (int iel = n0; iel < n1; ++iel)
+			{
+				FESolidElement& el = m_Elem[ElementOrder(iel)];
+
+				if (el.isActive()) {
+
+					// get the element's LM vector
+					vector<int> lm;
+					UnpackLM(el, lm);
+
+					// element stiffness matrix
+					FEElementMatrix ke(el, lm);
+
+					// create the element's stiffness matrix
+					int ndof = 3 * el.Nodes();
+					ke.resize(ndof, ndof);
+					ke.zero();
+
+					// calculate geometrical stiffness
+					ElementGeometricalStiffness(el, ke);
+
+					// calculate material stiffness
+					if (pbm)
+					{
+						ElementMaterialStiffness(el, ke, &C[m]);
+						m += el.GaussPoints();
+					}
+					else ElementMaterialStiffness(el, ke);
+
+/*					// assign symmetic parts
+					// TODO: Can this be omitted by changing the Assemble routine so that it only
+					// grabs elements from the upper diagonal matrix?
+					for (int i = 0; i < ndof; ++i)
+						for (int j = i + 1; j < ndof; ++j)
+							ke[j][i] = ke[i][j];
 */
-			// assemble element matrix in global stiffness matrix
-			LS.Assemble(ke);
+					// assemble element matrix in global stiffness matrix
+					LS.Assemble(ke);
+				}
+			}
 		}
 	}
 }
@@ -546,27 +607,53 @@ void FEElasticSolidDomain::ElementStiffness(const FETimeInfo& tp, int iel, matri
 //-----------------------------------------------------------------------------
 void FEElasticSolidDomain::Update(const FETimeInfo& tp)
 {
+	// When the material supports it, the stresses of all the integration points of a
+	// block of elements are evaluated in one call, after the kinematics have been updated.
+	// This is not done for the mid-point rule, which corrects the stress point by point.
+	FEElasticMaterial* pbm = (m_secant_stress || (m_alphaf == 0.5) ? nullptr : BlockMaterial());
+
 	bool berr = false;
 	int NE = Elements();
-	#pragma omp parallel for shared(NE, berr)
-	for (int i=0; i<NE; ++i)
+	int NB = (NE + ELEMENT_BLOCK - 1) / ELEMENT_BLOCK;
+	#pragma omp parallel shared(NE, NB, berr)
 	{
-		try
-		{
-			FESolidElement& el = Element(i);
-			if (el.isActive())
-			{
-				UpdateElementStress(i, tp);
-			}
-		}
-		catch (NegativeJacobian e)
+		vector<FEMaterialPoint*> mpb(pbm ? ELEMENT_BLOCK*FEElement::MAX_INTPOINTS : 0);
+
+		#pragma omp for
+		for (int nb = 0; nb < NB; ++nb)
 		{
-			#pragma omp critical
+			int n0 = nb*ELEMENT_BLOCK;
+			int n1 = (n0 + ELEMENT_BLOCK < NE ? n0 + ELEMENT_BLOCK : NE);
+			int npts = 0;
+			for (int n = n0; n < n1; ++n)
 			{
-				// reset the logfile mode
-				berr = true;
-				if (e.DoOutput()) feLogError(e.what());
+				try
+				{
+					int i = ElementOrder(n);
+					FESolidElement& el = Element(i);
+					if (el.isActive())
+					{
+						if (pbm)
+						{
+							UpdateElementState(i, tp, false);
+							for (int j = 0; j < el.GaussPoints(); ++j) mpb[npts++] = el.GetMaterialPoint(j);
+						}
+						else UpdateElementStress(i, tp);
+					}
+				}
+				catch (NegativeJacobian e)
+				{
+					#pragma omp critical
+					{
+						// reset the logfile mode
+						berr = true;
+						if (e.DoOutput()) feLogError(e.what());
+					}
+				}
 			}
+
+			// evaluate the stresses of the block
+			if (npts > 0) pbm->BlockStress(&mpb[0], npts);
 		}
 	}
 
@@ -577,6 +664,14 @@ void FEElasticSolidDomain::Update(const FETimeInfo& tp)
 //! Update element state data (mostly stresses, but some other stuff as well)
 //! \todo Remove the remodeling solid stuff
 void FEElasticSolidDomain::UpdateElementStress(int iel, const FETimeInfo& tp)
+{
+	UpdateElementState(iel, tp, true);
+}
+
+//-----------------------------------------------------------------------------
+//! Updates the kinematics of the element's integration points. The stresses are
+//! only evaluated if bstress is true.
+void FEElasticSolidDomain::UpdateElementState(int iel, const FETimeInfo& tp, bool bstress)
 {
     double dt =tp.timeIncrement;
     
@@ -585,6 +680,7 @@ void FEElasticSolidDomain::UpdateElementStress(int iel, const FETimeInfo& tp)
 
 	// get the number of integration points
 	int nint = el.GaussPoints();
+	PROFILE_COUNT(GaussPoints, nint);
 
 	// number of nodes
 	int neln = el.Nodes();
@@ -642,7 +738,10 @@ void FEElasticSolidDomain::UpdateElementStress(int iel, const FETimeInfo& tp)
 
         // update specialized material points
         m_pMat->UpdateSpecializedMaterialPoints(mp, tp);
-        
+
+		// the stress is evaluated by the caller
+		if (bstress == false) continue;
+
 		// calculate the stress at this material point
 //		pt.m_s = m_pMat->Stress(mp);
 		pt.m_s = (m_secant_stress ? m_pMat->SecantStress(mp) : m_pMat->Stress(mp));
@@ -716,8 +815,9 @@ void FEElasticSolidDomain::InertialForces(FEGlobalVector& R, vector<double>& F)
 {
     int NE = Elements();
 #pragma omp parallel for shared(R, F)
-	for (int i=0; i<NE; ++i)
+	for (int n=0; n<NE; ++n)
     {
+		int i = ElementOrder(n);
 		// get the element
 		FESolidElement& el = m_Elem[i];
 
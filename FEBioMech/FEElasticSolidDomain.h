@@ -32,6 +32,8 @@ SOFTWARE.*/
 #include "FESolidMaterial.h"
 #include <FECore/FEDofList.h>
 
+class FEElasticMaterial;
+
 //-----------------------------------------------------------------------------
 //! domain described by Lagrange-type 3D volumetric elements
 //!
@@ -125,6 +127,19 @@ protected:
 	bool	m_secant_stress;	//!< use secant approximation to stress
 	bool	m_secant_tangent;   //!< flag for using secant tangent
 
+protected:
+	//! returns the material if it supports block evaluation, or zero otherwise
+	FEElasticMaterial* BlockMaterial();
+
+	//! update the kinematics of an element's integration points, and the stresses if bstress is true
+	void UpdateElementState(int iel, const FETimeInfo& tp, bool bstress);
+
+	//! element material stiffness using the tangents C at the integration points (evaluated here if C is null)
+	void ElementMaterialStiffness(FESolidElement& el, matrix& ke, tens4ds* C);
+
+	// number of elements whose integration points are evaluated in one block
+	enum { ELEMENT_BLOCK = 16 };
+
 protected:
 	FEDofList	m_dofU;		// displacement dofs
 	FEDofList	m_dofR;		// rigid rotation rofs
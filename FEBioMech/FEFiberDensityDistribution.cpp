@@ -28,11 +28,45 @@ SOFTWARE.*/
 
 #include "stdafx.h"
 #include "FEFiberDensityDistribution.h"
+#include <FECore/FEModel.h>
 
 #ifndef SQR
 #define SQR(x) ((x)*(x))
 #endif
 
+//-----------------------------------------------------------------------------
+bool FEFiberDensityDistribution::IsUniform()
+{
+	// we can't tell if properties depend on the material point, so assume they do
+	if (Properties() > 0) return false;
+
+	FEModel* fem = GetFEModel();
+	FEParameterList& PL = GetParameterList();
+	FEParamIterator it = PL.first();
+	for (int i = 0; i < PL.Parameters(); ++i, ++it)
+	{
+		FEParam& pi = *it;
+
+		// parameters under load control change with time
+		if (fem && fem->GetLoadController(&pi)) return false;
+
+		// mapped parameters must be constant
+		for (int j = 0; j < pi.dim(); ++j)
+		{
+			switch (pi.type())
+			{
+			case FE_PARAM_DOUBLE_MAPPED: if (pi.value<FEParamDouble>(j).isConst() == false) return false; break;
+			case FE_PARAM_VEC3D_MAPPED : if (pi.value<FEParamVec3  >(j).isConst() == false) return false; break;
+			case FE_PARAM_MAT3D_MAPPED : if (pi.value<FEParamMat3d >(j).isConst() == false) return false; break;
+			case FE_PARAM_MAT3DS_MAPPED: if (pi.value<FEParamMat3ds>(j).isConst() == false) return false; break;
+			default:
+				break;
+			}
+		}
+	}
+	return true;
+}
+
 //-----------------------------------------------------------------------------
 // define the ellipsoidal fiber density distributionmaterial parameters
 BEGIN_FECORE_CLASS(FEEllipsoidalFiberDensityDistribution, FEFiberDensityDistribution)
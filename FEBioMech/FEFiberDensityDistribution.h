@@ -42,6 +42,10 @@ public:
     // Evaluation of fiber density along n0
     virtual double FiberDensity(FEMaterialPoint& mp, const vec3d& n0) = 0;
 
+    // Returns true if the fiber density does not depend on the material point or on time,
+    // i.e. all parameters are constant and not under load control.
+    virtual bool IsUniform();
+
     FECORE_BASE_CLASS(FEFiberDensityDistribution)
 };
 
@@ -57,6 +57,9 @@ public:
 	// get iterator
 	virtual FEFiberIntegrationSchemeIterator* GetIterator(FEMaterialPoint* mp) override;
 
+	// the integration points follow the principal strain directions
+	bool IsPointDependent() const override { return true; }
+
 protected:
 	bool InitRule();
     
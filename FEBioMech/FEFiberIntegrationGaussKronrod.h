@@ -58,6 +58,9 @@ public:
 	// get the iterator
 	FEFiberIntegrationSchemeIterator* GetIterator(FEMaterialPoint* mp) override;
 
+	// the integration points follow the principal strain directions
+	bool IsPointDependent() const override { return true; }
+
 protected:
 	bool InitRule();
     
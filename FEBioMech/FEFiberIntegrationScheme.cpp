@@ -32,3 +32,67 @@ SOFTWARE.*/
 FEFiberIntegrationScheme::FEFiberIntegrationScheme(FEModel* pfem) : FEMaterialProperty(pfem)
 {
 }
+
+//-----------------------------------------------------------------------------
+FEFiberIntegrationTable::FEFiberIntegrationTable()
+{
+	m_nint = 0;
+	m_bdensity = false;
+	m_IFD = 1.0;
+}
+
+//-----------------------------------------------------------------------------
+void FEFiberIntegrationTable::Clear()
+{
+	m_nx.clear(); m_ny.clear(); m_nz.clear();
+	m_w.clear();
+	m_R.clear();
+	m_nint = 0;
+	m_bdensity = false;
+	m_IFD = 1.0;
+}
+
+//-----------------------------------------------------------------------------
+bool FEFiberIntegrationTable::Build(FEFiberIntegrationScheme* pint, FEFiberDensityDistribution* pdd)
+{
+	Clear();
+	if ((pint == nullptr) || pint->IsPointDependent()) return false;
+
+	// collect the integration points
+	FEFiberIntegrationSchemeIterator* it = pint->GetIterator(nullptr);
+	if (it->IsValid())
+	{
+		do
+		{
+			m_nx.push_back(it->m_fiber.x);
+			m_ny.push_back(it->m_fiber.y);
+			m_nz.push_back(it->m_fiber.z);
+			m_w.push_back(it->m_weight);
+		} 
+		while (it->Next());
+	}
+	delete it;
+
+	m_nint = (int)m_w.size();
+	if (m_nint == 0) return false;
+
+	// tabulate the fiber densities if they don't depend on the material point
+	if (pdd && pdd->IsUniform())
+	{
+		FEMaterialPoint mp;
+		m_R.resize(m_nint);
+		double IFD = 0.0;
+		for (int n = 0; n < m_nint; ++n)
+		{
+			vec3d N(m_nx[n], m_ny[n], m_nz[n]);
+			m_R[n] = pdd->FiberDensity(mp, N);
+			IFD += m_R[n] * m_w[n];
+		}
+
+		// just in case
+		m_IFD = (IFD == 0.0 ? 1.0 : IFD);
+		m_bdensity = true;
+	}
+
+	return true;
+}
@@ -31,6 +31,7 @@ SOFTWARE.*/
 #include "FEElasticFiberMaterial.h"
 #include "FEFiberDensityDistribution.h"
 #include "febiomech_api.h"
+#include <vector>
 
 //----------------------------------------------------------------------------------
 // This is an iterator class that can be used to loop over all integration points of
@@ -71,5 +72,89 @@ public:
 	// The passed material point pointer will be zero when evaluating the integrated fiber density
 	virtual FEFiberIntegrationSchemeIterator* GetIterator(FEMaterialPoint* mp = 0) = 0;
 
+	// Returns true if the integration points depend on the material point (e.g. 
+	// schemes that adapt to the principal strain directions). The integration points 
+	// of these schemes cannot be tabulated.
+	virtual bool IsPointDependent() const { return false; }
+
 	FECORE_BASE_CLASS(FEFiberIntegrationScheme)
 };
+
+//----------------------------------------------------------------------------------
+// Table of precomputed integration points of a fiber integration scheme. The fiber 
+// directions, weights, and (when the fiber density distribution is uniform) the fiber
+// densities are stored in separate arrays so that the fiber loop does not require 
+// an iterator and can be vectorized by the compiler.
+class FEBIOMECH_API FEFiberIntegrationTable
+{
+public:
+	FEFiberIntegrationTable();
+
+	// Build the table for the scheme. Returns false if the scheme cannot be tabulated,
+	// in which case the iterator of the scheme must be used instead.
+	// The fiber densities are tabulated as well if the distribution is uniform. Otherwise,
+	// only the fiber directions and weights are tabulated (these don't depend on the 
+	// material point) and the densities are evaluated at each material point.
+	bool Build(FEFiberIntegrationScheme* pint, FEFiberDensityDistribution* pdd);
+
+	// clear all data
+	void Clear();
+
+	// is the table valid
+	bool IsValid() const { return (m_nint > 0); }
+
+	// are the fiber densities tabulated
+	bool HasDensity() const { return m_bdensity; }
+
+	// number of integration points
+	int Points() const { return m_nint; }
+
+	// integrated fiber density (only valid when fiber densities are tabulated)
+	double IntegratedFiberDensity() const { return m_IFD; }
+
+	// Integrate the fiber contributions f(n0) over the table, where n0 is the fiber 
+	// direction in global coordinates, and divide by the integrated fiber density.
+	// The fiber densities are evaluated at the material point, unless they were tabulated.
+	template <typename T, typename F>
+	T Integrate(FEMaterialPoint& mp, FEFiberDensityDistribution* pdd, const mat3d& Q, T sum, F f) const;
+
+public:
+	std::vector<double>	m_nx, m_ny, m_nz;	// fiber directions (in local coordinates)
+	std::vector<double>	m_w;				// integration weights
+	std::vector<double>	m_R;				// fiber densities
+
+private:
+	int		m_nint;
+	bool	m_bdensity;
+	double	m_IFD;
+};
+
+template <typename T, typename F>
+T FEFiberIntegrationTable::Integrate(FEMaterialPoint& mp, FEFiberDensityDistribution* pdd, const mat3d& Q, T sum, F f) const
+{
+	const double* nx = &m_nx[0];
+	const double* ny = &m_ny[0];
+	const double* nz = &m_nz[0];
+	const double* w  = &m_w[0];
+	double IFD = 0.0;
+	for (int n = 0; n < m_nint; ++n)
+	{
+		// get the fiber direction for that fiber distribution
+		vec3d N(nx[n], ny[n], nz[n]);
+
+		// evaluate the fiber density (unless it was tabulated)
+		double R = (m_bdensity ? m_R[n] : pdd->FiberDensity(mp, N));
+		IFD += R*w[n];
+
+		// convert fiber to global coordinates
+		vec3d n0 = Q*N;
+
+		sum += f(n0)*(R*w[n]);
+	}
+
+	if (m_bdensity) IFD = m_IFD;
+	else if (IFD == 0.0) IFD = 1.0;
+
+	// divide by IFD
+	return sum / IFD;
+}
@@ -83,6 +83,16 @@ bool FEGenericHyperelastic::BuildMathExpressions()
     MITEM WJJ = MDerive(m_WJ.GetExpression(), *m_WJ.Variable(2), 1);
 	m_WJJ.AddVariables(vars); m_WJJ.SetExpression(WJJ);
 
+	// compile the derivatives into a single kernel with shared subexpressions
+	m_dW.Clear();
+	m_dW.AddExpression(m_W1);
+	m_dW.AddExpression(m_W2);
+	m_dW.AddExpression(m_WJ);
+	m_dW.AddExpression(m_W11);
+	m_dW.AddExpression(m_W12);
+	m_dW.AddExpression(m_W22);
+	m_dW.AddExpression(m_WJJ);
+
 #ifndef NDEBUG
 	MObj2String o2s;
 	string sW1 = o2s.Convert(m_W1); feLog("W1  = %s\n", sW1.c_str());
@@ -125,9 +135,11 @@ mat3ds FEGenericHyperelastic::Stress(FEMaterialPoint& mp)
 	vector<double> v = { I1, I2, J, mp.m_r0.x, mp.m_r0.y, mp.m_r0.z };
 	for (int i = 0; i < m_param.size(); ++i) v.push_back(*m_param[i]);
 
-	double W1 = m_W1.value_s(v);
-	double W2 = m_W2.value_s(v);
-	double WJ = m_WJ.value_s(v);
+	double w[3];
+	m_dW.value_s(v, w, 3);
+	double W1 = w[0];
+	double W2 = w[1];
+	double WJ = w[2];
 
 	mat3dd I(1.0);
 
@@ -152,15 +164,17 @@ tens4ds FEGenericHyperelastic::Tangent(FEMaterialPoint& mp)
 	vector<double> v = { I1, I2, J, mp.m_r0.x, mp.m_r0.y, mp.m_r0.z };
 	for (int i = 0; i < m_param.size(); ++i) v.push_back(*m_param[i]);
 
-	double W1 = m_W1.value_s(v);
-	double W2 = m_W2.value_s(v);
-	double WJ = m_WJ.value_s(v);
+	double w[7];
+	m_dW.value_s(v, w);
+	double W1 = w[0];
+	double W2 = w[1];
+	double WJ = w[2];
 
-	double W11 = m_W11.value_s(v);
-	double W22 = m_W22.value_s(v);
-	double W12 = m_W12.value_s(v);
+	double W11 = w[3];
+	double W22 = w[5];
+	double W12 = w[4];
 
-	double WJJ = m_WJJ.value_s(v);
+	double WJJ = w[6];
 
 	mat3dd I(1.0);
 	tens4ds IxI = dyad1s(I);
@@ -68,5 +68,8 @@ private:
 	MSimpleExpression	m_W22;
 	MSimpleExpression	m_WJJ;
 
+	// all derivatives, evaluated in one pass (first derivatives come first)
+	MFusedExpression	m_dW;
+
 	DECLARE_FECORE_CLASS();
 };
@@ -79,6 +79,14 @@ bool FEGenericHyperelasticUC::BuildMathExpressions()
 	m_W12.AddVariables(vars); m_W12.SetExpression(W12);
 	m_W22.AddVariables(vars); m_W22.SetExpression(W22);
 
+	// compile the derivatives into a single kernel with shared subexpressions
+	m_dW.Clear();
+	m_dW.AddExpression(m_W1);
+	m_dW.AddExpression(m_W2);
+	m_dW.AddExpression(m_W11);
+	m_dW.AddExpression(m_W12);
+	m_dW.AddExpression(m_W22);
+
 	if (m_printDerivs)
 	{
 		feLog("\nStrain energy and derivatives for material %d (%s):\n", GetID(), GetName().c_str());
@@ -127,8 +135,10 @@ mat3ds FEGenericHyperelasticUC::DevStress(FEMaterialPoint& mp)
 	// get strain energy derivatives
 	vector<double> v = { I1, I2, mp.m_r0.x, mp.m_r0.y, mp.m_r0.z };
 	for (int i = 0; i < m_param.size(); ++i) v.push_back(*m_param[i]);
-	double W1 = m_W1.value_s(v);
-	double W2 = m_W2.value_s(v);
+	double w[2];
+	m_dW.value_s(v, w, 2);
+	double W1 = w[0];
+	double W2 = w[1];
 
 	// calculate T = F*dW/dC*Ft
 	mat3ds T = B*(W1 + W2*I1) - B2*W2;
@@ -160,12 +170,14 @@ tens4ds FEGenericHyperelasticUC::DevTangent(FEMaterialPoint& mp)
 	// get strain energy derivatives
 	vector<double> v = { I1, I2, mp.m_r0.x, mp.m_r0.y, mp.m_r0.z };
 	for (int i = 0; i < m_param.size(); ++i) v.push_back(*m_param[i]);
-	double W1 = m_W1.value_s(v);
-	double W2 = m_W2.value_s(v);
-
-	double W11 = m_W11.value_s(v);
-	double W22 = m_W22.value_s(v);
-	double W12 = m_W12.value_s(v);
+	double w[5];
+	m_dW.value_s(v, w);
+	double W1 = w[0];
+	double W2 = w[1];
+
+	double W11 = w[2];
+	double W22 = w[4];
+	double W12 = w[3];
 
 	// define fourth-order tensors
 	mat3dd I(1.0);
@@ -64,5 +64,8 @@ private:
 	MSimpleExpression	m_W12;
 	MSimpleExpression	m_W22;
 
+	// all derivatives, evaluated in one pass (first derivatives come first)
+	MFusedExpression	m_dW;
+
 	DECLARE_FECORE_CLASS();
 };
@@ -72,5 +72,8 @@ private:
 	MSimpleExpression	m_W55;
 	MSimpleExpression	m_WJJ;
 
+	// all derivatives, evaluated in one pass (first derivatives come first)
+	MFusedExpression	m_dW;
+
 	DECLARE_FECORE_CLASS();
 };
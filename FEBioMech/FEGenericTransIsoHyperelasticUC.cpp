@@ -97,6 +97,23 @@ bool FEGenericTransIsoHyperelasticUC::Init()
 	m_W45.AddVariables(vars); m_W45.SetExpression(W45);
 	m_W55.AddVariables(vars); m_W55.SetExpression(W55);
 
+	// compile the derivatives into a single kernel with shared subexpressions
+	m_dW.Clear();
+	m_dW.AddExpression(m_W1);
+	m_dW.AddExpression(m_W2);
+	m_dW.AddExpression(m_W4);
+	m_dW.AddExpression(m_W5);
+	m_dW.AddExpression(m_W11);
+	m_dW.AddExpression(m_W12);
+	m_dW.AddExpression(m_W14);
+	m_dW.AddExpression(m_W15);
+	m_dW.AddExpression(m_W22);
+	m_dW.AddExpression(m_W24);
+	m_dW.AddExpression(m_W25);
+	m_dW.AddExpression(m_W44);
+	m_dW.AddExpression(m_W45);
+	m_dW.AddExpression(m_W55);
+
 	if (m_printDerivs)
 	{
 		feLog("\nStrain energy and derivatives for material %d (%s):\n", GetID(), GetName().c_str());
@@ -149,10 +166,12 @@ mat3ds FEGenericTransIsoHyperelasticUC::DevStress(FEMaterialPoint& mp)
 	for (int i = 0; i < m_param.size(); ++i) v.push_back(*m_param[i]);
 
 	// evaluate the strain energy derivatives
-	double W1 = m_W1.value_s(v);
-	double W2 = m_W2.value_s(v);
-	double W4 = m_W4.value_s(v);
-	double W5 = m_W5.value_s(v);
+	double w[4];
+	m_dW.value_s(v, w, 4);
+	double W1 = w[0];
+	double W2 = w[1];
+	double W4 = w[2];
+	double W5 = w[3];
 
 	mat3dd I(1.0);
 	mat3ds AxA = dyad(a);
@@ -194,21 +213,23 @@ tens4ds FEGenericTransIsoHyperelasticUC::DevTangent(FEMaterialPoint& mp)
 	for (int i = 0; i < m_param.size(); ++i) v.push_back(*m_param[i]);
 
 	// evaluate strain energy derivatives
-	double W1 = m_W1.value_s(v);
-	double W2 = m_W2.value_s(v);
-	double W4 = m_W4.value_s(v);
-	double W5 = m_W5.value_s(v);
-
-	double W11 = m_W11.value_s(v);
-	double W12 = m_W12.value_s(v);
-	double W14 = m_W14.value_s(v);
-	double W15 = m_W15.value_s(v);
-	double W22 = m_W22.value_s(v);
-	double W24 = m_W24.value_s(v);
-	double W25 = m_W25.value_s(v);
-	double W44 = m_W44.value_s(v);
-	double W45 = m_W45.value_s(v);
-	double W55 = m_W55.value_s(v);
+	double w[14];
+	m_dW.value_s(v, w);
+	double W1 = w[0];
+	double W2 = w[1];
+	double W4 = w[2];
+	double W5 = w[3];
+
+	double W11 = w[4];
+	double W12 = w[5];
+	double W14 = w[6];
+	double W15 = w[7];
+	double W22 = w[8];
+	double W24 = w[9];
+	double W25 = w[10];
+	double W44 = w[11];
+	double W45 = w[12];
+	double W55 = w[13];
 
 	// a few tensors we'll need
 	mat3dd I(1.0);
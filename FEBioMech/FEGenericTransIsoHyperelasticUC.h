@@ -72,5 +72,8 @@ private:
 	MSimpleExpression	m_W45;
 	MSimpleExpression	m_W55;
 
+	// all derivatives, evaluated in one pass (first derivatives come first)
+	MFusedExpression	m_dW;
+
 	DECLARE_FECORE_CLASS();
 };
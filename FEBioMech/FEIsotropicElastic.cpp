@@ -89,6 +89,54 @@ tens4ds FEIsotropicElastic::Tangent(FEMaterialPoint& mp)
 	return dyad1s(b)*lam + dyad4s(b)*(2.0*mu);
 }
 
+//-----------------------------------------------------------------------------
+//! Evaluates the stress of a block of material points. The material parameters
+//! are evaluated once for the whole block when they are constant.
+void FEIsotropicElastic::BlockStress(FEMaterialPoint** mp, int n)
+{
+	if ((m_E.isConst() == false) || (m_v.isConst() == false)) { FEElasticMaterial::BlockStress(mp, n); return; }
+
+	double E = m_E(*mp[0]);
+	double v = m_v(*mp[0]);
+	double lam0 = v*E/((1+v)*(1-2*v));
+	double mu0  = 0.5*E/(1+v);
+
+	// s = (lam*trE - mu)*b + mu*b^2
+	for (int i = 0; i < n; ++i)
+	{
+		FEElasticMaterialPoint& pt = *mp[i]->ExtractData<FEElasticMaterialPoint>();
+		double Ji = 1.0 / pt.m_J;
+		double lam = lam0*Ji;
+		double mu  = mu0*Ji;
+
+		mat3ds b = pt.LeftCauchyGreen();
+		mat3ds b2 = b.sqr();
+		double a = lam*0.5*(b.tr() - 3) - mu;
+
+		pt.m_s = b*a + b2*mu;
+	}
+}
+
+//-----------------------------------------------------------------------------
+//! Evaluates the spatial tangent of a block of material points.
+void FEIsotropicElastic::BlockTangent(FEMaterialPoint** mp, int n, tens4ds* c)
+{
+	if ((m_E.isConst() == false) || (m_v.isConst() == false)) { FEElasticMaterial::BlockTangent(mp, n, c); return; }
+
+	double E = m_E(*mp[0]);
+	double v = m_v(*mp[0]);
+	double lam0 = v*E/((1+v)*(1-2*v));
+	double mu0  = 0.5*E/(1+v);
+
+	for (int i = 0; i < n; ++i)
+	{
+		FEElasticMaterialPoint& pt = *mp[i]->ExtractData<FEElasticMaterialPoint>();
+		double Ji = 1.0 / pt.m_J;
+		mat3ds b = pt.LeftCauchyGreen();
+		c[i] = dyad1s(b)*(lam0*Ji) + dyad4s(b)*(2.0*mu0*Ji);
+	}
+}
+
 //-----------------------------------------------------------------------------
 double FEIsotropicElastic::StrainEnergyDensity(FEMaterialPoint& mp)
 {
@@ -48,6 +48,11 @@ public:
 
 	//! calculate strain energy density at material point
 	virtual double StrainEnergyDensity(FEMaterialPoint& pt) override;
+
+	//! block evaluation of stress and tangent
+	bool HasBlockEvaluation() const override { return true; }
+	void BlockStress(FEMaterialPoint** mp, int n) override;
+	void BlockTangent(FEMaterialPoint** mp, int n, tens4ds* c) override;
     
     //! calculate the 2nd Piola-Kirchhoff stress at material point
     mat3ds PK2Stress(FEMaterialPoint& pt, const mat3ds E) override;
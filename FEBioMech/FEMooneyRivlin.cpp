@@ -37,15 +37,9 @@ BEGIN_FECORE_CLASS(FEMooneyRivlin, FEUncoupledMaterial)
 END_FECORE_CLASS();
 
 //-----------------------------------------------------------------------------
-//! Calculate the deviatoric stress
-mat3ds FEMooneyRivlin::DevStress(FEMaterialPoint& mp)
+//! Deviatoric stress for given material parameters
+static mat3ds MooneyRivlinDevStress(const FEElasticMaterialPoint& pt, double c1, double c2)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-
-	// get material parameters
-	double c1 = m_c1(mp);
-	double c2 = m_c2(mp);
-
 	// determinant of deformation gradient
 	double J = pt.m_J;
 
@@ -77,15 +71,9 @@ mat3ds FEMooneyRivlin::DevStress(FEMaterialPoint& mp)
 }
 
 //-----------------------------------------------------------------------------
-//! Calculate the deviatoric tangent
-tens4ds FEMooneyRivlin::DevTangent(FEMaterialPoint& mp)
+//! Deviatoric tangent for given material parameters
+static tens4ds MooneyRivlinDevTangent(const FEElasticMaterialPoint& pt, double c1, double c2)
 {
-	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
-
-	// get material parameters
-	double c1 = m_c1(mp);
-	double c2 = m_c2(mp);
-
 	// determinant of deformation gradient
 	double J = pt.m_J;
 	double Ji = 1.0/J;
@@ -135,6 +123,74 @@ tens4ds FEMooneyRivlin::DevTangent(FEMaterialPoint& mp)
 	return c;
 }
 
+//-----------------------------------------------------------------------------
+//! Calculate the deviatoric stress
+mat3ds FEMooneyRivlin::DevStress(FEMaterialPoint& mp)
+{
+	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+
+	// get material parameters
+	double c1 = m_c1(mp);
+	double c2 = m_c2(mp);
+
+	return MooneyRivlinDevStress(pt, c1, c2);
+}
+
+//-----------------------------------------------------------------------------
+//! Calculate the deviatoric tangent
+tens4ds FEMooneyRivlin::DevTangent(FEMaterialPoint& mp)
+{
+	FEElasticMaterialPoint& pt = *mp.ExtractData<FEElasticMaterialPoint>();
+
+	// get material parameters
+	double c1 = m_c1(mp);
+	double c2 = m_c2(mp);
+
+	return MooneyRivlinDevTangent(pt, c1, c2);
+}
+
+//-----------------------------------------------------------------------------
+//! Evaluates the total stress (see FEUncoupledMaterial::Stress) of a block of
+//! material points. The material parameters are evaluated once for the whole
+//! block when they are constant.
+void FEMooneyRivlin::BlockStress(FEMaterialPoint** mp, int n)
+{
+	// spatially varying parameters are evaluated point by point
+	if ((m_c1.isConst() == false) || (m_c2.isConst() == false)) { FEElasticMaterial::BlockStress(mp, n); return; }
+
+	double c1 = m_c1(*mp[0]);
+	double c2 = m_c2(*mp[0]);
+
+	for (int i = 0; i < n; ++i)
+	{
+		FEElasticMaterialPoint& pt = *mp[i]->ExtractData<FEElasticMaterialPoint>();
+		pt.m_p = UJ(pt.m_J);
+		pt.m_s = mat3dd(pt.m_p) + MooneyRivlinDevStress(pt, c1, c2);
+	}
+}
+
+//-----------------------------------------------------------------------------
+//! Evaluates the total spatial tangent (see FEUncoupledMaterial::Tangent) of a
+//! block of material points.
+void FEMooneyRivlin::BlockTangent(FEMaterialPoint** mp, int n, tens4ds* c)
+{
+	if ((m_c1.isConst() == false) || (m_c2.isConst() == false)) { FEElasticMaterial::BlockTangent(mp, n, c); return; }
+
+	double c1 = m_c1(*mp[0]);
+	double c2 = m_c2(*mp[0]);
+
+	mat3dd I(1);
+	tens4ds IxI = dyad1s(I);
+	tens4ds I4  = dyad4s(I);
+
+	for (int i = 0; i < n; ++i)
+	{
+		FEElasticMaterialPoint& pt = *mp[i]->ExtractData<FEElasticMaterialPoint>();
+		pt.m_p = UJ(pt.m_J);
+		c[i] = MooneyRivlinDevTangent(pt, c1, c2) + (IxI - I4*2)*pt.m_p + IxI*(UJJ(pt.m_J)*pt.m_J);
+	}
+}
+
 //-----------------------------------------------------------------------------
 //! calculate deviatoric strain energy density
 double FEMooneyRivlin::DevStrainEnergyDensity(FEMaterialPoint& mp)
@@ -51,6 +51,11 @@ public:
 
 	//! calculate deviatoric strain energy density
 	double DevStrainEnergyDensity(FEMaterialPoint& mp) override;
+
+	//! block evaluation of the total stress and tangent
+	bool HasBlockEvaluation() const override { return true; }
+	void BlockStress(FEMaterialPoint** mp, int n) override;
+	void BlockTangent(FEMaterialPoint** mp, int n, tens4ds* c) override;
     
 	// declare the parameter list
 	DECLARE_FECORE_CLASS();
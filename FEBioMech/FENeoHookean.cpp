@@ -92,6 +92,58 @@ tens4ds FENeoHookean::Tangent(FEMaterialPoint& mp)
 	return dyad1s(I)*lam1 + dyad4s(I)*(2*mu1);
 }
 
+//-----------------------------------------------------------------------------
+//! Evaluates the stress of a block of material points. The material parameters
+//! are evaluated once for the whole block when they are constant.
+void FENeoHookean::BlockStress(FEMaterialPoint** mp, int n)
+{
+	// spatially varying parameters are evaluated point by point
+	if ((m_E.isConst() == false) || (m_v.isConst() == false)) { FEElasticMaterial::BlockStress(mp, n); return; }
+
+	double E = m_E(*mp[0]);
+	double v = m_v(*mp[0]);
+	double lam = v*E/((1+v)*(1-2*v));
+	double mu  = 0.5*E/(1+v);
+
+	// s = mu/J*(b - I) + lam*ln(J)/J*I
+	for (int i = 0; i < n; ++i)
+	{
+		FEElasticMaterialPoint& pt = *mp[i]->ExtractData<FEElasticMaterialPoint>();
+		mat3ds b = pt.LeftCauchyGreen();
+		double J = pt.m_J;
+		double Ji = 1.0 / J;
+		double a = mu*Ji;
+		double p = (lam*log(J) - mu)*Ji;
+		pt.m_s = mat3ds(a*b.xx() + p, a*b.yy() + p, a*b.zz() + p, a*b.xy(), a*b.yz(), a*b.xz());
+	}
+}
+
+//-----------------------------------------------------------------------------
+//! Evaluates the spatial tangent of a block of material points.
+void FENeoHookean::BlockTangent(FEMaterialPoint** mp, int n, tens4ds* c)
+{
+	if ((m_E.isConst() == false) || (m_v.isConst() == false)) { FEElasticMaterial::BlockTangent(mp, n, c); return; }
+
+	double E = m_E(*mp[0]);
+	double v = m_v(*mp[0]);
+	double lam = v*E/((1+v)*(1-2*v));
+	double mu  = 0.5*E/(1+v);
+
+	// c = lam/J*IxI + 2*(mu - lam*ln(J))/J*I(x)I
+	for (int i = 0; i < n; ++i)
+	{
+		double J = mp[i]->ExtractData<FEElasticMaterialPoint>()->m_J;
+		double lam1 = lam / J;
+		double mu1 = (mu - lam*log(J)) / J;
+
+		double* d = c[i].d;
+		for (int k = 0; k < tens4ds::NNZ; ++k) d[k] = 0.0;
+		d[0] = d[2] = d[5] = lam1 + 2*mu1;
+		d[1] = d[3] = d[4] = lam1;
+		d[9] = d[14] = d[20] = mu1;
+	}
+}
+
 //-----------------------------------------------------------------------------
 double FENeoHookean::StrainEnergyDensity(FEMaterialPoint& mp)
 {
@@ -104,7 +104,7 @@ void FEPressureLoad::StiffnessMatrix(FELinearSystem& LS)
 
 	// evaluate the integral
 	FESurface& surf = GetSurface();
-	surf.LoadStiffness(LS, m_dof, m_dof, [&](FESurfaceMaterialPoint& mp, const FESurfaceDofShape& dof_a, const FESurfaceDofShape& dof_b, matrix& kab) {
+	surf.LoadStiffnessT(LS, m_dof, m_dof, [&](FESurfaceMaterialPoint& mp, const FESurfaceDofShape& dof_a, const FESurfaceDofShape& dof_b, matrix& kab) {
 
 		// evaluate pressure at this material point
 		double P = -m_pressure(mp);
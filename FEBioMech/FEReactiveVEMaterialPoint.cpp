@@ -69,6 +69,7 @@ void FEReactiveVEMaterialPoint::Init()
 	m_Jv.clear();
 	m_v.clear();
 	m_f.clear();
+    m_cerr = 0;
     
     m_Et = 0;
     m_wv.clear();
@@ -93,6 +94,7 @@ void FEReactiveVEMaterialPoint::Serialize(DumpStream& ar)
         int n = (int)m_Uv.size();
         ar << n;
         for (int i=0; i<n; ++i) ar << m_Uv[i] << m_Jv[i] << m_v[i] << m_f[i];
+        ar << m_cerr;
         ar << m_Et;
         int m = (int)m_wv.size();
         ar << m;
@@ -107,6 +109,7 @@ void FEReactiveVEMaterialPoint::Serialize(DumpStream& ar)
 		m_v.resize(n);
 		m_f.resize(n);
         for (int i=0; i<n; ++i) ar >> m_Uv[i] >> m_Jv[i] >> m_v[i] >> m_f[i];
+        if (ar.Version() >= DUMP_VERSION_RVECOMPACT) ar >> m_cerr; else m_cerr = 0;
         ar >> m_Et;
         int m;
         ar >> m;
@@ -114,3 +117,57 @@ void FEReactiveVEMaterialPoint::Serialize(DumpStream& ar)
         for (int i=0; i<m; ++i) ar >> m_wv[i];
     }
 }
+
+//-----------------------------------------------------------------------------
+//! Merge two consecutive generations into one, to keep the number of generations
+//! bounded. The pair is selected that introduces the smallest error, estimated as the
+//! bond mass fraction of the younger generation times the change in its reference
+//! stretch. Generations are merged as long as the accumulated error estimate stays 
+//! below gtol, or when the number of generations exceeds gmax. Note that this is an
+//! estimate and not a bound, since the rescaling of the mass fractions for type 1 
+//! kinetics changes the weights of later merges.
+bool FEReactiveVEMaterialPoint::CompactGenerations(int btype, int gmax, double gtol, std::function<double(int)> brf)
+{
+    // the newest generation is still being updated, so we need at least three
+    int ng = (int)m_v.size();
+    if (ng < 3) return false;
+    
+    // Merging generation a into generation b=a+1 shifts the reference configuration
+    // of the bonds of b from Uv[a] to Uv[a-1] (or identity for a = 0).
+    int imin = -1;
+    double emin = 0;
+    for (int a=0; a<ng-2; ++a) {
+        double wb = brf(a+1)*m_wv[a+1];
+        mat3ds dU = (a > 0) ? m_Uv[a] - m_Uv[a-1] : m_Uv[a] - mat3dd(1);
+        double e = wb*dU.norm();
+        if ((imin == -1) || (e < emin)) { imin = a; emin = e; }
+    }
+    
+    // check if we need to merge
+    if (((gmax <= 0) || (ng <= gmax)) && (m_cerr + emin > gtol)) return false;
+
+    // evaluate the bond mass fractions of the pair
+    int a = imin, b = imin + 1;
+    double ra = brf(a);
+    double rb = brf(b);
+    double wa = ra*m_wv[a];
+    double wb = rb*m_wv[b];
+    
+    // The merged generation keeps the breaking state of b. Its mass fraction
+    // is ra + rb, which for kinetics type 2 follows from the telescoping sum, but
+    // for type 1 requires rescaling. The recruitment fraction is set such that
+    // the weak bond mass is conserved.
+    if ((btype == 1) && (rb > 0)) m_f[b] *= (ra + rb)/rb;
+    if (ra + rb > 0) m_wv[b] = (wa + wb)/(ra + rb);
+    
+    m_Uv.erase(m_Uv.begin() + a);
+    m_Jv.erase(m_Jv.begin() + a);
+    m_v.erase(m_v.begin() + a);
+    m_f.erase(m_f.begin() + a);
+    m_wv.erase(m_wv.begin() + a);
+    
+    // accumulate the error estimate
+    m_cerr += emin;
+    
+    return true;
+}
@@ -31,6 +31,7 @@ SOFTWARE.*/
 #include "FEReactiveViscoelastic.h"
 #include "FEUncoupledReactiveViscoelastic.h"
 #include <deque>
+#include <functional>
 
 class FEReactiveViscoelasticMaterial;
 class FEUncoupledReactiveViscoelasticMaterial;
@@ -54,7 +55,7 @@ class FEReactiveVEMaterialPoint : public FEMaterialPointData
 {
 public:
     //! olverloaded constructors
-    FEReactiveVEMaterialPoint(FEMaterialPointData*pt) : FEMaterialPointData(pt) {}
+    FEReactiveVEMaterialPoint(FEMaterialPointData*pt) : FEMaterialPointData(pt) { m_cerr = 0; }
     
     //! copy material point data
 	FEMaterialPointData* Copy() override;
@@ -67,6 +68,11 @@ public:
 
     //! Serialize data to archive
     void Serialize(DumpStream& ar) override;
+
+    //! Merge the pair of consecutive generations with the smallest error estimate.
+    //! The function brf(ig) returns the breaking bond mass fraction of generation ig.
+    //! Returns false if no merge was done.
+    bool CompactGenerations(int btype, int gmax, double gtol, std::function<double(int)> brf);
     
 public:
     // multigenerational material data
@@ -74,6 +80,7 @@ public:
     deque <double> m_Jv;	//!< determinant of Uv (store for efficiency)
     deque <double> m_v;     //!< time tv when generation starts breaking
     deque <double> m_f;     //!< mass fraction when generation starts breaking
+    double         m_cerr;  //!< accumulated error estimate of generation compaction
     
 public:
     // weak bond recruitment parameters
@@ -47,6 +47,8 @@ BEGIN_FECORE_CLASS(FEReactiveViscoelasticMaterial, FEElasticMaterial)
     ADD_PARAMETER(m_btype, FE_RANGE_CLOSED(1,2), "kinetics");
     ADD_PARAMETER(m_ttype, FE_RANGE_CLOSED(0,2), "trigger");
     ADD_PARAMETER(m_emin , FE_RANGE_GREATER_OR_EQUAL(0.0), "emin");
+    ADD_PARAMETER(m_gmax , FE_RANGE_GREATER_OR_EQUAL(0), "max_generations");
+    ADD_PARAMETER(m_gtol , FE_RANGE_GREATER_OR_EQUAL(0.0), "compaction_tol");
 
 	// set material properties
 	ADD_PROPERTY(m_pBase, "elastic");
@@ -64,7 +66,9 @@ FEReactiveViscoelasticMaterial::FEReactiveViscoelasticMaterial(FEModel* pfem) :
     m_btype = 0;
     m_ttype = 0;
     m_emin = 0;
-    
+    m_gmax = 0;
+    m_gtol = 0;
+
     m_nmax = 0;
 
 	m_pBase = nullptr;
@@ -644,6 +648,39 @@ void FEReactiveViscoelasticMaterial::CullGenerations(FEMaterialPoint& mp)
     return;
 }
 
+//-----------------------------------------------------------------------------
+//! Merge generations while the accumulated error estimate stays below m_gtol, 
+//! or while the number of generations exceeds m_gmax.
+void FEReactiveViscoelasticMaterial::CompactGenerations(FEMaterialPoint& mp)
+{
+    // get the elastic material point data
+    FEElasticMaterialPoint& ep = *mp.ExtractData<FEElasticMaterialPoint>();
+    
+    // get the reactive viscoelastic point data
+    FEReactiveVEMaterialPoint& pt = *mp.ExtractData<FEReactiveVEMaterialPoint>();
+    
+    mat3ds D = ep.RateOfDeformation();
+    
+    // keep safe copy of deformation gradient
+    mat3d F = ep.m_F;
+    double J = ep.m_J;
+    
+    bool bmerged = false;
+    while (pt.CompactGenerations(m_btype, m_gmax, m_gtol, [&](int ig) {
+        ep.m_F = pt.m_Uv[ig];
+        ep.m_J = pt.m_Jv[ig];
+        return BreakingBondMassFraction(mp, ig, D);
+    })) bmerged = true;
+    
+    // restore safe copy of deformation gradient
+    ep.m_F = F;
+    ep.m_J = J;
+    
+    // Culling stops when the number of generations drops below the max achieved so far,
+    // so the max needs to be adjusted after compaction. 
+    if (bmerged) m_nmax = min(m_nmax, (int)pt.m_v.size());
+}
+
 //-----------------------------------------------------------------------------
 //! Update specialized material points
 void FEReactiveViscoelasticMaterial::UpdateSpecializedMaterialPoints(FEMaterialPoint& mp, const FETimeInfo& tp)
@@ -680,6 +717,7 @@ void FEReactiveViscoelasticMaterial::UpdateSpecializedMaterialPoints(FEMaterialP
             double f = (!pt.m_v.empty()) ? ReformingBondMassFraction(wb) : 1;
             pt.m_f.push_back(f);
             CullGenerations(wb);
+            if ((m_gmax > 0) || (m_gtol > 0)) CompactGenerations(wb);
         }
     }
     // otherwise, if we already have a generation for the current time, update the stored values
@@ -707,6 +745,18 @@ int FEReactiveViscoelasticMaterial::RVEGenerations(FEMaterialPoint& mp)
     return (int)pt.m_v.size();
 }
 
+//-----------------------------------------------------------------------------
+//! return the accumulated error estimate of generation compaction
+double FEReactiveViscoelasticMaterial::RVECompactionError(FEMaterialPoint& mp)
+{
+    FEMaterialPoint& wb = *GetBondMaterialPoint(mp);
+    
+    // get the reactive viscoelastic point data
+    FEReactiveVEMaterialPoint& pt = *wb.ExtractData<FEReactiveVEMaterialPoint>();
+    
+    return pt.m_cerr;
+}
+
 //-----------------------------------------------------------------------------
 //! evaluate trigger strain
 double FEReactiveViscoelasticMaterial::ScalarStrain(FEMaterialPoint& mp)
@@ -78,6 +78,9 @@ public:
 
     //! cull generations
     void CullGenerations(FEMaterialPoint& pt);
+
+    //! merge generations to bound their number
+    void CompactGenerations(FEMaterialPoint& pt);
     
     //! evaluate bond mass fraction for a given generation
     double BreakingBondMassFraction(FEMaterialPoint& pt, const int ig, const mat3ds D);
@@ -90,6 +93,9 @@ public:
     
     //! return number of generations
     int RVEGenerations(FEMaterialPoint& pt);
+
+    //! return the accumulated error estimate of generation compaction
+    double RVECompactionError(FEMaterialPoint& pt);
     
 	//! returns a pointer to a new material point object
 	FEMaterialPointData* CreateMaterialPointData() override;
@@ -123,6 +129,8 @@ public:
     int     m_btype;    //!< bond kinetics type
     int     m_ttype;    //!< bond breaking trigger type
     double  m_emin;     //!< strain threshold for triggering new generation
+    int     m_gmax;     //!< max number of generations per point (0 = no limit)
+    double  m_gtol;     //!< tolerance on the accumulated error estimate of merging generations
     
     int     m_nmax;     //!< highest number of generations achieved in analysis
     
@@ -88,8 +88,9 @@ void FERemodelingElasticDomain::StiffnessMatrix(FELinearSystem& LS)
 	double dt = GetFEModel()->GetTime().timeIncrement;
 
 	#pragma omp parallel for
-	for (int iel=0; iel<NE; ++iel)
+	for (int ie=0; ie<NE; ++ie)
 	{
+		int iel = ElementOrder(ie);
 		FESolidElement& el = m_Elem[iel];
 
 		// element stiffness matrix
@@ -40,6 +40,7 @@ SOFTWARE.*/
 #include "FEMechModel.h"
 #include <FECore/FELinearSystem.h>
 #include "FESolidAnalysis.h"
+#include <FECore/sys.h>
 
 FERigidSolver::FERigidSolver(FEModel* fem)
 {
@@ -48,6 +49,9 @@ FERigidSolver::FERigidSolver(FEModel* fem)
 	m_dofX = m_dofY = m_dofZ = -1;
 
 	m_bAllowMixedBCs = false;
+
+	m_bbuffer = false;
+	m_nrdofs = 0;
 }
 
 int FERigidSolver::InitEquations(int neq)
@@ -314,6 +318,139 @@ void FERigidSolver::PrepStep(const FETimeInfo& timeInfo, vector<double>& ui)
     }
 }
 
+//-----------------------------------------------------------------------------
+void FERigidSolver::BeginRigidAssembly(double alpha)
+{
+	m_bbuffer = false;
+	if (m_fem == nullptr) return;
+	FEMechModel& fem = *m_fem;
+
+	int NRB = fem.RigidBodies();
+	if (NRB == 0) return;
+
+	// The buffers are dense, so we only use them when there are not too many rigid bodies.
+	// Otherwise, the terms are added directly to the global matrix.
+	m_nrdofs = 6 * NRB;
+	if (m_nrdofs > 300) return;
+
+	int nthreads = omp_get_max_threads();
+	if (nthreads < 1) nthreads = 1;
+	m_Krr.resize(nthreads);
+	m_Frr.resize(nthreads);
+	for (int i = 0; i < nthreads; ++i)
+	{
+		m_Krr[i].assign(m_nrdofs*m_nrdofs, 0.0);
+		m_Frr[i].assign(m_nrdofs, 0.0);
+	}
+
+	// evaluate the offsets of the rigid nodes to their rigid body's center of mass
+	FEMesh& mesh = fem.GetMesh();
+	int NN = mesh.Nodes();
+	m_zt.resize(NN);
+	m_za.resize(NN);
+#pragma omp parallel for
+	for (int i = 0; i < NN; ++i)
+	{
+		FENode& node = mesh.Node(i);
+		if (node.m_rid >= 0)
+		{
+			FERigidBody& RB = *fem.GetRigidBody(node.m_rid);
+			m_zt[i] = node.m_rt - RB.m_rt;
+			m_za[i] = (node.m_rt - RB.m_rt)*alpha + (node.m_rp - RB.m_rp)*(1 - alpha);
+		}
+	}
+
+	m_bbuffer = true;
+}
+
+//-----------------------------------------------------------------------------
+void FERigidSolver::EndRigidAssembly(SparseMatrix& K, vector<double>& F)
+{
+	if (m_bbuffer == false) return;
+	m_bbuffer = false;
+
+	FEMechModel& fem = *m_fem;
+	int nr = m_nrdofs;
+
+	// reduce the thread buffers
+	vector<double>& Krr = m_Krr[0];
+	vector<double>& Frr = m_Frr[0];
+	for (int n = 1; n < (int)m_Krr.size(); ++n)
+	{
+		const vector<double>& Kn = m_Krr[n];
+		const vector<double>& Fn = m_Frr[n];
+		for (int i = 0; i < nr*nr; ++i) Krr[i] += Kn[i];
+		for (int i = 0; i < nr; ++i) Frr[i] += Fn[i];
+	}
+
+	// add to global system
+	for (int i = 0; i < nr; ++i)
+	{
+		int I = fem.GetRigidBody(i / 6)->m_LM[i % 6];
+		if (I < 0) continue;
+
+		F[I] += Frr[i];
+
+		for (int j = 0; j < nr; ++j)
+		{
+			double kij = Krr[i*nr + j];
+			if (kij == 0.0) continue;
+
+			int J = fem.GetRigidBody(j / 6)->m_LM[j % 6];
+			if (J >= 0) K.add(I, J, kij);
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+void FERigidSolver::AddRigidBlock(SparseMatrix& K, vector<double>& ui, vector<double>& F, int rbi, int rbj, double KR[6][6])
+{
+	FEMechModel& fem = *m_fem;
+	int* lmi = fem.GetRigidBody(rbi)->m_LM;
+	int* lmj = fem.GetRigidBody(rbj)->m_LM;
+
+	if (m_bbuffer)
+	{
+		int nr = m_nrdofs;
+		int n = omp_get_thread_num();
+		double* Kb = &(m_Krr[n][0]);
+		double* Fb = &(m_Frr[n][0]);
+		for (int k = 0; k < 6; ++k)
+			for (int l = 0; l < 6; ++l)
+			{
+				int J = lmj[k];
+				int I = lmi[l];
+
+				if (I >= 0)
+				{
+					int ri = 6 * rbi + l;
+					int rj = 6 * rbj + k;
+					if (J < -1) Fb[ri] -= KR[l][k] * ui[-J - 2];
+					else if (J >= 0) Kb[ri*nr + rj] += KR[l][k];
+				}
+			}
+	}
+	else
+	{
+		for (int k = 0; k < 6; ++k)
+			for (int l = 0; l < 6; ++l)
+			{
+				int J = lmj[k];
+				int I = lmi[l];
+
+				if (I >= 0)
+				{
+					// multiply KR by alpha for alpha rule
+					if (J < -1) {
+						#pragma omp atomic
+						F[I] -= KR[l][k] * ui[-J - 2];
+					}
+					else if (J >= 0) K.add(I, J, KR[l][k]);
+				}
+			}
+	}
+}
+
 //-----------------------------------------------------------------------------
 //! This function calculates the rigid stiffness matrices
 void FERigidSolver::RigidStiffness(SparseMatrix& K, vector<double>& ui, vector<double>& F, const FEElementMatrix& ke, double alpha)
@@ -384,7 +521,7 @@ void FERigidSolver::RigidStiffnessSolid(SparseMatrix& K, vector<double>& ui, vec
 				int* lmj = RBj.m_LM;
 
 				// get the relative distance to the center of mass
-				vec3d zj = nodej.m_rt - RBj.m_rt;
+				vec3d zj = (m_bbuffer ? m_zt[en[j]] : nodej.m_rt - RBj.m_rt);
 				mat3d Zj; Zj.skew(zj);
 
 				// loop over rows
@@ -412,7 +549,7 @@ void FERigidSolver::RigidStiffnessSolid(SparseMatrix& K, vector<double>& ui, vec
 							int* lmi = RBi.m_LM;
 
 							// get the relative distance (use alpha rule)
-							vec3d zi = (nodei.m_rt - RBi.m_rt)*alpha + (nodei.m_rp - RBi.m_rp)*(1 - alpha);
+							vec3d zi = (m_bbuffer ? m_za[en[i]] : (nodei.m_rt - RBi.m_rt)*alpha + (nodei.m_rp - RBi.m_rp)*(1 - alpha));
 							mat3d Zi; Zi.skew(zi);
 
 							mat3d M;
@@ -445,22 +582,7 @@ void FERigidSolver::RigidStiffnessSolid(SparseMatrix& K, vector<double>& ui, vec
 							KR[5][3] = M[2][0]; KR[5][4] = M[2][1]; KR[5][5] = M[2][2];
 
 							// add the stiffness components to the Krr matrix
-							for (int k = 0; k < 6; ++k)
-								for (int l = 0; l < 6; ++l)
-								{
-									int J = lmj[k];
-									int I = lmi[l];
-
-									if (I >= 0)
-									{
-										// multiply KR by alpha for alpha rule
-										if (J < -1) {
-											#pragma omp atomic
-											F[I] -= KR[l][k] * ui[-J - 2];
-										}
-										else if (J >= 0) K.add(I, J, KR[l][k]);
-									}
-								}
+							AddRigidBlock(K, ui, F, nodei.m_rid, nodej.m_rid, KR);
 
 							// we still need to couple the non-rigid degrees of node i to the
 							// rigid dofs of node j
@@ -566,7 +688,7 @@ void FERigidSolver::RigidStiffnessSolid(SparseMatrix& K, vector<double>& ui, vec
 							int* lmi = RBi.m_LM;
 
 							// get the relative distance (use alpha rule)
-							vec3d zi = (nodei.m_rt - RBi.m_rt)*alpha + (nodei.m_rp - RBi.m_rp)*(1 - alpha);
+							vec3d zi = (m_bbuffer ? m_za[en[i]] : (nodei.m_rt - RBi.m_rt)*alpha + (nodei.m_rp - RBi.m_rp)*(1 - alpha));
 							mat3d Zi; Zi.skew(zi);
 
 							// get the element sub-matrix
@@ -652,7 +774,7 @@ void FERigidSolver::RigidStiffnessShell(SparseMatrix& K, vector<double>& ui, vec
             lmj = RBj.m_LM;
             
             // get the relative distance to the center of mass
-            aj = nodej.m_rt - RBj.m_rt;
+            aj = (m_bbuffer ? m_zt[en[j]] : nodej.m_rt - RBj.m_rt);
             Aj.skew(aj);
             
             // get the shell director
@@ -694,7 +816,7 @@ void FERigidSolver::RigidStiffnessShell(SparseMatrix& K, vector<double>& ui, vec
                     lmi = RBi.m_LM;
                     
                     // get the relative distance (use alpha rule)
-                    ai = (nodei.m_rt - RBi.m_rt)*alpha + (nodei.m_rp - RBi.m_rp)*(1 - alpha);
+                    ai = (m_bbuffer ? m_za[en[i]] : (nodei.m_rt - RBi.m_rt)*alpha + (nodei.m_rp - RBi.m_rp)*(1 - alpha));
                     Ai.skew(ai);
                     
                     // get the shell director
@@ -731,22 +853,7 @@ void FERigidSolver::RigidStiffnessShell(SparseMatrix& K, vector<double>& ui, vec
                     KR[5][3] = M[2][0]; KR[5][4] = M[2][1]; KR[5][5] = M[2][2];
                     
                     // add the stiffness components to the Krr matrix
-                    for (k = 0; k<6; ++k)
-                        for (l = 0; l<6; ++l)
-                        {
-                            J = lmj[k];
-                            I = lmi[l];
-                            
-                            if (I >= 0)
-                            {
-                                // multiply KR by alpha for alpha rule
-								if (J < -1) {
-									#pragma omp atomic
-									F[I] -= KR[l][k] * ui[-J - 2];
-								}
-                                else if (J >= 0) K.add(I, J, KR[l][k]);
-                            }
-                        }
+                    AddRigidBlock(K, ui, F, nodei.m_rid, nodej.m_rid, KR);
                     
                     // we still need to couple the non-rigid degrees of node i to the
                     // rigid dofs of node j
@@ -853,7 +960,7 @@ void FERigidSolver::RigidStiffnessShell(SparseMatrix& K, vector<double>& ui, vec
                     lmi = RBi.m_LM;
                     
                     // get the relative distance (use alpha rule)
-                    ai = (nodei.m_rt - RBi.m_rt)*alpha + (nodei.m_rp - RBi.m_rp)*(1 - alpha);
+                    ai = (m_bbuffer ? m_za[en[i]] : (nodei.m_rt - RBi.m_rt)*alpha + (nodei.m_rp - RBi.m_rp)*(1 - alpha));
                     Ai.skew(ai);
                     
                     // get the shell director
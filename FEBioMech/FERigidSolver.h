@@ -62,6 +62,15 @@ public:
 	// This is called at the start of each time step
 	void PrepStep(const FETimeInfo& timeInfo, vector<double>& ui);
 
+	// Start buffering the rigid-rigid coupling terms of the element matrices.
+	// These are collected in per-thread dense buffers since all elements attached to
+	// a rigid body contribute to the same few entries of the global matrix.
+	// Must be called outside a parallel region, before the element matrices are assembled.
+	void BeginRigidAssembly(double alpha);
+
+	// Add the buffered rigid-rigid coupling terms to the global matrix and residual.
+	void EndRigidAssembly(SparseMatrix& K, std::vector<double>& F);
+
 	// correct stiffness matrix for rigid bodies
 	void RigidStiffness(SparseMatrix& K, std::vector<double>& ui, std::vector<double>& F, const FEElementMatrix& ke, double alpha);
 
@@ -93,6 +102,10 @@ public:
 public:
 	void AllowMixedBCs(bool b) { m_bAllowMixedBCs = b; }
 
+protected:
+	// add a 6x6 block that couples rigid bodies rbi and rbj
+	void AddRigidBlock(SparseMatrix& K, std::vector<double>& ui, std::vector<double>& F, int rbi, int rbj, double KR[6][6]);
+
 protected:
 	FEMechModel*	m_fem;
 	int			m_dofX, m_dofY, m_dofZ;
@@ -101,6 +114,14 @@ protected:
     int         m_dofSX, m_dofSY, m_dofSZ;
     int         m_dofSVX, m_dofSVY, m_dofSVZ;
 	bool		m_bAllowMixedBCs;
+
+	// rigid assembly buffers
+	bool		m_bbuffer;			// rigid-rigid terms are being buffered
+	int			m_nrdofs;			// buffer size (six times the number of rigid bodies)
+	std::vector< std::vector<double> >	m_Krr;	// per-thread rigid-rigid stiffness
+	std::vector< std::vector<double> >	m_Frr;	// per-thread residual of rigid dofs
+	std::vector<vec3d>	m_zt;		// node offsets from the center of mass of their rigid body
+	std::vector<vec3d>	m_za;		// same as m_zt, but using the alpha rule
 };
 
 //-----------------------------------------------------------------------------
@@ -1097,6 +1097,84 @@ void FESSIShellDomain::Update(const FETimeInfo& tp)
 	};
 }
 
+//-----------------------------------------------------------------------------
+//! This evaluates the products with stack storage, since it is called for each
+//! integration point of each element.
+void FESSIShellDomain::ConstitutiveStiffness(int neln, const vector<matrix>& hu, const vector<matrix>& hw, const matrix& CC, double detJt, matrix& ke)
+{
+	const int NELN = FEElement::MAX_NODES;
+	assert(neln <= NELN);
+
+	// evaluate h_i*CC*detJt
+	double huC[NELN][3][6], hwC[NELN][3][6];
+	for (int i = 0; i < neln; ++i)
+	{
+		const matrix& hui = hu[i];
+		const matrix& hwi = hw[i];
+		for (int a = 0; a < 3; ++a)
+			for (int k = 0; k < 6; ++k)
+			{
+				double su = 0.0, sw = 0.0;
+				for (int l = 0; l < 6; ++l)
+				{
+					su += hui(a, l)*CC(l, k);
+					sw += hwi(a, l)*CC(l, k);
+				}
+				huC[i][a][k] = su*detJt;
+				hwC[i][a][k] = sw*detJt;
+			}
+	}
+
+	for (int i = 0, i6 = 0; i < neln; ++i, i6 += 6)
+	{
+		for (int j = 0, j6 = 0; j < neln; ++j, j6 += 6)
+		{
+			const matrix& huj = hu[j];
+			const matrix& hwj = hw[j];
+			for (int a = 0; a < 3; ++a)
+				for (int b = 0; b < 3; ++b)
+				{
+					double kuu = 0.0, kuw = 0.0, kwu = 0.0, kww = 0.0;
+					for (int k = 0; k < 6; ++k)
+					{
+						kuu += huC[i][a][k]*huj(b, k);
+						kuw += huC[i][a][k]*hwj(b, k);
+						kwu += hwC[i][a][k]*huj(b, k);
+						kww += hwC[i][a][k]*hwj(b, k);
+					}
+					ke[i6 + a    ][j6 + b    ] += kuu;
+					ke[i6 + a    ][j6 + b + 3] += kuw;
+					ke[i6 + a + 3][j6 + b    ] += kwu;
+					ke[i6 + a + 3][j6 + b + 3] += kww;
+				}
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+void FESSIShellDomain::InternalForce(int neln, const vector<matrix>& hu, const vector<matrix>& hw, const matrix& SC, double detJt, vector<double>& fe)
+{
+	for (int i = 0; i < neln; ++i)
+	{
+		const matrix& hui = hu[i];
+		const matrix& hwi = hw[i];
+		for (int a = 0; a < 3; ++a)
+		{
+			double fu = 0.0, fw = 0.0;
+			for (int k = 0; k < 6; ++k)
+			{
+				fu += hui(a, k)*SC(k, 0);
+				fw += hwi(a, k)*SC(k, 0);
+			}
+
+			// the '-' sign is so that the internal forces get subtracted
+			// from the global residual vector
+			fe[6*i + a    ] -= fu*detJt;
+			fe[6*i + a + 3] -= fw*detJt;
+		}
+	}
+}
+
 //=================================================================================================
 template <class T> void _writeIntegratedElementValueT(FESSIShellDomain& dom, FEDataStream& ar, std::function<T (const FEMaterialPoint& mp)> fnc)
 {
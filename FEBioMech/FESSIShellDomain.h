@@ -32,6 +32,7 @@ SOFTWARE.*/
 #include <functional>
 #include "febiomech_api.h"
 #include <FECore/FEDofList.h>
+#include <FECore/matrix.h>
 class FEDataStream;
 
 //-----------------------------------------------------------------------------
@@ -154,6 +155,14 @@ public:
 
 	void Update(const FETimeInfo& tp) override;
 
+protected:
+	//! add the constitutive stiffness h_i*CC*h_j^T*detJt of all node pairs to ke,
+	//! where h = hu or hw are the (3x6) strain-displacement matrices of a node
+	static void ConstitutiveStiffness(int neln, const vector<matrix>& hu, const vector<matrix>& hw, const matrix& CC, double detJt, matrix& ke);
+
+	//! subtract the internal force h_i*SC*detJt of all nodes from fe
+	static void InternalForce(int neln, const vector<matrix>& hu, const vector<matrix>& hw, const matrix& SC, double detJt, vector<double>& fe);
+
 protected:
 	FEDofList	m_dofU;		// displacement dofs
 	FEDofList	m_dofSU;	// shell displacement dofs
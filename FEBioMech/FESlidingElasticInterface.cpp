@@ -72,6 +72,7 @@ FESlidingElasticSurface::Data::Data()
     m_tr = vec3d(0,0,0);
     m_rs = m_rsp = vec2d(0,0);
     m_bstick = false;
+    m_pmec = nullptr;
 }
 
 //-----------------------------------------------------------------------------
@@ -86,6 +87,7 @@ void FESlidingElasticSurface::Data::Init()
 	m_tr = vec3d(0, 0, 0);
 	m_rs = m_rsp = vec2d(0, 0);
 	m_bstick = false;
+	m_pmec = nullptr;
 }
 
 //-----------------------------------------------------------------------------
@@ -119,6 +121,9 @@ bool FESlidingElasticSurface::Init()
     // initialize surface data first
     if (FEContactSurface::Init() == false) return false;
 
+	// create the element neighbor list
+	if ((Elements() > 0) && (m_EEL.Create(this) == false)) return false;
+
 	return true;
 }
 
@@ -487,10 +492,11 @@ void FESlidingElasticInterface::ProjectSurface(FESlidingElasticSurface& ss, FESl
     FEMesh& mesh = GetFEModel()->GetMesh();
     
     // initialize projection data
+    // (The search structures are only built when we need to do a global search.)
     FENormalProjection np(ms);
     np.SetTolerance(m_stol);
     np.SetSearchRadius(m_srad);
-    np.Init();
+    bool bnpInit = false;
     
     double psf = GetPenaltyScaleFactor();
     
@@ -498,6 +504,9 @@ void FESlidingElasticInterface::ProjectSurface(FESlidingElasticSurface& ss, FESl
     // let's do this first
     if (bmove)
     {
+        np.Init();
+        bnpInit = true;
+
         int NN = ss.Nodes();
         int NE = ss.Elements();
         // first we need to calculate the node normals
@@ -563,9 +572,98 @@ void FESlidingElasticInterface::ProjectSurface(FESlidingElasticSurface& ss, FESl
         }
     }
     
+    // Find the secondary surface element for all integration points. We first check
+    // the element of the last iteration and its neighborhood, since most points
+    // will not have moved far. Elements with points for which this fails are tagged
+    // and these points are then found with a global search. 
+    int NE = ss.Elements();
+    vector<int> tag(NE, 0);
+#pragma omp parallel
+    {
+        vector<FEElement*> nbrs;
+#pragma omp for schedule(dynamic)
+        for (int i=0; i<NE; ++i)
+        {
+            FESurfaceElement& el = ss.Element(i);
+            int nint = el.GaussPoints();
+            for (int j=0; j<nint; ++j)
+            {
+                // get the integration point data
+                FESlidingElasticSurface::Data& data = static_cast<FESlidingElasticSurface::Data&>(*el.GetMaterialPoint(j));
+
+                // calculate the global position of the integration point
+                vec3d r = ss.Local2Global(el, j);
+
+                // calculate the normal at this integration point
+                vec3d nu = ss.SurfaceNormal(el, j);
+
+                // first see if the old intersected face is still good enough
+                FESurfaceElement* pme = data.m_pme;
+                double rs[2] = {0,0};
+                if (pme)
+                {
+                    // see if the ray intersects this element
+                    double g;
+                    if (ms.Intersect(*pme, r, nu, rs, g, m_stol) == false) pme = 0;
+                }
+
+                // if not, search the neighborhood of the last element we found
+                if ((pme == 0) && bupseg)
+                {
+                    FESurfaceElement* pe = (data.m_pme ? data.m_pme : data.m_pmec);
+                    if (pe)
+                    {
+                        // this uses the same selection rule as the global search
+                        ms.m_EEL.GetNeighborhood(pe, 2, nbrs);
+                        pme = np.Project(r, nu, rs, nbrs);
+                    }
+                    if (pme == 0) tag[i] = 1;
+                }
+
+                data.m_pme = pme;
+                data.m_nu = nu;
+                data.m_rs[0] = rs[0];
+                data.m_rs[1] = rs[1];
+                if (pme) data.m_pmec = pme;
+            }
+        }
+    }
+
+    // do a global search for the points that were not found
+    bool bsearch = false;
+    for (int i=0; i<NE; ++i) if (tag[i]) { bsearch = true; break; }
+    if (bsearch)
+    {
+        if (bnpInit == false) np.Init();
+
+#pragma omp parallel for schedule(dynamic)
+        for (int i=0; i<NE; ++i)
+        {
+            if (tag[i] == 0) continue;
+
+            FESurfaceElement& el = ss.Element(i);
+            int nint = el.GaussPoints();
+            for (int j=0; j<nint; ++j)
+            {
+                FESlidingElasticSurface::Data& data = static_cast<FESlidingElasticSurface::Data&>(*el.GetMaterialPoint(j));
+                if (data.m_pme) continue;
+
+                // find the intersection point with the secondary surface
+                vec3d r = ss.Local2Global(el, j);
+                double rs[2] = {0,0};
+                FESurfaceElement* pme = np.Project(r, data.m_nu, rs);
+
+                data.m_pme = pme;
+                data.m_rs[0] = rs[0];
+                data.m_rs[1] = rs[1];
+                if (pme) data.m_pmec = pme;
+            }
+        }
+    }
+
     // loop over all integration points
 #pragma omp parallel for schedule(dynamic)
-    for (int i=0; i<ss.Elements(); ++i)
+    for (int i=0; i<NE; ++i)
     {
         FESurfaceElement& el = ss.Element(i);
         
@@ -579,35 +677,9 @@ void FESlidingElasticInterface::ProjectSurface(FESlidingElasticSurface& ss, FESl
             // calculate the global position of the integration point
             vec3d r = ss.Local2Global(el, j);
             
-            // calculate the normal at this integration point
-            vec3d nu = ss.SurfaceNormal(el, j);
-            
-            // first see if the old intersected face is still good enough
+            vec3d nu = data.m_nu;
             FESurfaceElement* pme = data.m_pme;
-            double rs[2] = {0,0};
-            if (pme)
-            {
-                double g;
-                
-                // see if the ray intersects this element
-                if (ms.Intersect(*pme, r, nu, rs, g, m_stol))
-                {
-                    data.m_rs[0] = rs[0];
-                    data.m_rs[1] = rs[1];
-                }
-                else
-                {
-                    pme = 0;
-                }
-            }
-            
-            // find the intersection point with the secondary surface
-            if (pme == 0 && bupseg) pme = np.Project(r, nu, rs);
-            
-            data.m_pme = pme;
-            data.m_nu = nu;
-            data.m_rs[0] = rs[0];
-            data.m_rs[1] = rs[1];
+            double rs[2] = { data.m_rs[0], data.m_rs[1] };
             if (pme)
             {
                 // the node could potentially be in contact
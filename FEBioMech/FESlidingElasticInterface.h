@@ -29,6 +29,7 @@ SOFTWARE.*/
 #pragma once
 #include "FEContactInterface.h"
 #include "FEContactSurface.h"
+#include <FECore/FEElemElemList.h>
 
 // Elastic sliding contact, reducing the algorithm of biphasic sliding contact
 // (FESlidingInterface2) to elastic case.  The algorithm derives from Bonet
@@ -59,6 +60,7 @@ public:
         vec2d	m_rs;		//!< natural coordinates of this integration point
         vec2d   m_rsp;      //!< m_rs at the previous time step
         bool    m_bstick;   //!< stick flag
+        FESurfaceElement*	m_pmec;	//!< last secondary element found (the search starts here)
     };
     
 public:
@@ -93,6 +95,8 @@ public:
      
 public:
     vec3d    m_Ft;     //!< total contact force (from equivalent nodal forces)
+
+    FEElemElemList	m_EEL;	//!< element neighbor list (used to search the neighborhood of elements)
 };
 
 //-----------------------------------------------------------------------------
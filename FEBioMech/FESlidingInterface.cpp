@@ -33,6 +33,7 @@ SOFTWARE.*/
 #include "FECore/FEModel.h"
 #include "FECore/FEGlobalMatrix.h"
 #include "FECore/log.h"
+#include <memory>
 #include <FECore/FELinearSystem.h>
 #include <FECore/FEAnalysis.h>
 
@@ -48,6 +49,7 @@ FESlidingSurface::FESlidingPoint::FESlidingPoint()
 	m_off = 0.0;
 	m_eps = 1.0;
 	m_Ln = 0.0;
+	m_pmec = nullptr;
 }
 
 void FESlidingSurface::FESlidingPoint::Serialize(DumpStream& ar)
@@ -72,6 +74,7 @@ void FESlidingSurface::FESlidingPoint::Init()
 	m_Lt = vec2d(0, 0);
 	m_off = 0.0;
 	m_eps = 1.0;
+	m_pmec = nullptr;
 }
 
 //-----------------------------------------------------------------------------
@@ -224,6 +227,9 @@ bool FESlidingSurface::Init()
 	}
 	for (int i=0; i<nn; ++i) m_data[i].m_off = tag[NodeIndex(i)];
 
+	// create the element neighbor list
+	if ((Elements() > 0) && (m_EEL.Create(this) == false)) return false;
+
 	return true;
 }
 
@@ -510,6 +516,58 @@ void FESlidingInterface::Activate()
 	}
 }
 
+//-----------------------------------------------------------------------------
+// Find the closest point projection of node m (at x) onto the element pe or one of the 
+// elements in its neighborhood. Only elements that contain the projection are considered and
+// the closest one is returned. Returns null if no such element is found.
+// As in FEClosestPointProjection::Project, elements that contain the node itself are skipped
+// and, if a search radius is given, the closest surface node must lie within it. The closest
+// node of the neighborhood is never closer than the closest node of the whole surface, so if
+// it is outside the radius we leave the decision to the global search.
+static FESurfaceElement* ProjectNearby(FESlidingSurface& ms, FESurfaceElement* pe, int m, const vec3d& x, double srad, vec3d& q, vec2d& rs, double tol, vector<FEElement*>& nbrs)
+{
+	ms.m_EEL.GetNeighborhood(pe, 2, nbrs);
+
+	if (srad > 0)
+	{
+		FEMesh& mesh = *ms.GetMesh();
+		double d2min = -1.0;
+		for (size_t k = 0; k < nbrs.size(); ++k)
+		{
+			FEElement& el = *nbrs[k];
+			for (int l = 0; l < el.Nodes(); ++l)
+			{
+				if (el.m_node[l] == m) continue;
+				double d2 = (mesh.Node(el.m_node[l]).m_rt - x).norm2();
+				if ((d2min < 0) || (d2 < d2min)) d2min = d2;
+			}
+		}
+		if ((d2min < 0) || (d2min > srad*srad)) return nullptr;
+	}
+
+	FESurfaceElement* pme = nullptr;
+	double dmin = 0.0;
+	for (size_t k = 0; k < nbrs.size(); ++k)
+	{
+		FESurfaceElement& el = static_cast<FESurfaceElement&>(*nbrs[k]);
+		if (el.HasNode(m)) continue;
+		double r = 0, s = 0;
+		vec3d qk = ms.ProjectToSurface(el, x, r, s);
+		if (ms.IsInsideElement(el, r, s, tol))
+		{
+			double d = (x - qk).norm2();
+			if ((pme == nullptr) || (d < dmin))
+			{
+				pme = &el;
+				dmin = d;
+				q = qk;
+				rs = vec2d(r, s);
+			}
+		}
+	}
+	return pme;
+}
+
 //-----------------------------------------------------------------------------
 //!  Projects the primary surface onto the secondary surface.
 //!  That is, for each primary surface node we determine the closest
@@ -528,11 +586,21 @@ void FESlidingInterface::ProjectSurface(FESlidingSurface& ss, FESlidingSurface&
 	double r, s;
 	vec3d q;
 
-	FEClosestPointProjection cpp(ms);
-	cpp.SetTolerance(m_stol);
-	cpp.SetSearchRadius(m_sradius);
-	cpp.HandleSpecialCases(true);
-	cpp.Init();
+	// The closest point projection is only set up when we need a global search.
+	// Most nodes are found in the neighborhood of their last element.
+	std::unique_ptr<FEClosestPointProjection> cpp;
+	auto globalProjection = [&](int m, vec3d& q, vec2d& rs) {
+		if (cpp == nullptr)
+		{
+			cpp.reset(new FEClosestPointProjection(ms));
+			cpp->SetTolerance(m_stol);
+			cpp->SetSearchRadius(m_sradius);
+			cpp->HandleSpecialCases(true);
+			cpp->Init();
+		}
+		return cpp->Project(m, q, rs);
+	};
+	vector<FEElement*> nbrs;
 
 	// loop over all primary surface nodes
 	for (int i=0; i<ss.Nodes(); ++i)
@@ -570,10 +638,12 @@ void FESlidingInterface::ProjectSurface(FESlidingSurface& ss, FESlidingSurface&
 				if (!ms.IsInsideElement(mel, r, s, m_stol))
 				{
 					// see if the node might have moved to another element
+					// (we try the neighbors first)
 					FESurfaceElement* pold = pme; 
 					ss.m_data[i].m_rs = vec2d(0,0);
 
-					pme = cpp.Project(m, q, ss.m_data[i].m_rs);
+					pme = ProjectNearby(ms, pold, m, x, m_sradius, q, ss.m_data[i].m_rs, m_stol, nbrs);
+					if (pme == 0) pme = globalProjection(m, q, ss.m_data[i].m_rs);
 
 					if (pme == 0)
 					{
@@ -610,7 +680,9 @@ void FESlidingInterface::ProjectSurface(FESlidingSurface& ss, FESlidingSurface&
 			// get the secondary surface element
 			// don't forget to initialize the search for the first node!
 			ss.m_data[i].m_rs = vec2d(0,0);
-			pme = cpp.Project(m, q, ss.m_data[i].m_rs);
+			FESurfaceElement* pe = ss.m_data[i].m_pmec;
+			if (pe) pme = ProjectNearby(ms, pe, m, x, m_sradius, q, ss.m_data[i].m_rs, m_stol, nbrs);
+			if (pme == 0) pme = globalProjection(m, q, ss.m_data[i].m_rs);
 			if (pme)
 			{
 				// the node has come into contact so make sure to initialize
@@ -623,6 +695,8 @@ void FESlidingInterface::ProjectSurface(FESlidingSurface& ss, FESlidingSurface&
 		ss.m_data[i].m_pme = pme;
 		if (pme != 0)
 		{
+			ss.m_data[i].m_pmec = pme;
+
 			FESurfaceElement& mel =  *ss.m_data[i].m_pme;
 
 			r = ss.m_data[i].m_rs[0];
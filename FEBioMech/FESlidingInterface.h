@@ -30,6 +30,7 @@ SOFTWARE.*/
 #include "FEContactSurface.h"
 #include "FEContactInterface.h"
 #include <FECore/FEClosestPointProjection.h>
+#include <FECore/FEElemElemList.h>
 #include <FECore/vector.h>
 
 //-----------------------------------------------------------------------------
@@ -53,6 +54,7 @@ class FEBIOMECH_API FESlidingSurface : public FEContactSurface
 		vec2d				m_Lt;	  //!< Lagrange multipliers for friction
 		double				m_off;  //!< gap offset (= shell thickness)
 		double				m_eps;  //!< normal penalty factors
+		FESurfaceElement*	m_pmec;	//!< last secondary element found (the search starts here)
 	};
 
 public:
@@ -81,6 +83,7 @@ public:
 
 public:
 	vector<FESlidingPoint>		m_data;	//!< sliding contact surface data
+	FEElemElemList				m_EEL;	//!< element neighbor list (used to search the neighborhood of elements)
 };
 
 //-----------------------------------------------------------------------------
@@ -30,6 +30,7 @@ SOFTWARE.*/
 #include "FESolidSolver.h"
 #include <FECore/FELinearConstraintManager.h>
 #include <FECore/FEModel.h>
+#include <FECore/FEProfiler.h>
 
 FESolidLinearSystem::FESolidLinearSystem(FESolver* solver, FERigidSolver* rigidSolver, FEGlobalMatrix& K, std::vector<double>& F, std::vector<double>& u, bool bsymm, double alpha, int nreq) : FELinearSystem(solver, K, F, u, bsymm)
 {
@@ -68,6 +69,7 @@ void FESolidLinearSystem::Assemble(const FEElementMatrix& ke)
 			FEElementMatrix kes(ke, m_stiffnessScale);
 			m_K.Assemble(kes);
 		}
+		PROFILE_COUNT(AssembledEntries, (long long)ke.rows()*ke.columns());
 
 		// get the vector that stores the prescribed BC values
 		vector<double>& ui = m_u;
@@ -121,7 +123,6 @@ void FESolidLinearSystem::Assemble(const FEElementMatrix& ke)
 		}
 
 		// see if there are any rigid body dofs here
-		#pragma omp critical (rigidStiffness)
 		m_rigidSolver->RigidStiffness(m_K, m_u, m_F, ke, m_alpha);
 	}
 }
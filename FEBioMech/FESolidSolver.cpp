@@ -495,6 +495,9 @@ bool FESolidSolver::Quasin()
 
 			// something went wrong with the update, so we'll need to break
 			if (bret == false) break;
+
+			// update the Lagrange multipliers before the iterations have converged
+			DoInexactAugmentation(normR1, normRi);
 		}
 		else if (m_baugment)
 		{
@@ -528,6 +531,7 @@ bool FESolidSolver::StiffnessMatrix()
 
 	// setup the linear syster
 	FESolidLinearSystem LS(this, &m_rigidSolver, *m_pK, m_Fd, m_ui, (m_msymm == REAL_SYMMETRIC), 1.0, m_nreq);
+	m_rigidSolver.BeginRigidAssembly(1.0);
 
 	// get the mesh
 	FEMesh& mesh = fem.GetMesh();
@@ -588,6 +592,9 @@ bool FESolidSolver::StiffnessMatrix()
 	// calculate the stiffness contributions for the rigid forces
 	for (int i = 0; i<fem.ModelLoads(); ++i) fem.ModelLoad(i)->StiffnessMatrix(LS);
 
+	// add the buffered rigid body coupling terms
+	m_rigidSolver.EndRigidAssembly(*m_pK, m_Fd);
+
 	// we still need to set the diagonal elements to 1
 	// for the prescribed rigid body dofs.
 	m_rigidSolver.StiffnessMatrix(*m_pK, tp);
@@ -50,6 +50,7 @@ SOFTWARE.*/
 #include <FECore/FEModelLoad.h>
 #include <FECore/FELinearConstraintManager.h>
 #include <FECore/LinearSolver.h>
+#include <FECore/FEProfiler.h>
 #include <FECore/vector.h>
 #include "FESolidLinearSystem.h"
 #include "FEBioMech.h"
@@ -1138,6 +1139,9 @@ bool FESolidSolver2::Quasin()
 
 			// something went wrong with the update, so we'll need to break
 			if (bret == false) break;
+
+			// update the Lagrange multipliers before the iterations have converged
+			DoInexactAugmentation(normR1, normRi);
 		}
 		else if (m_baugment)
 		{
@@ -1325,6 +1329,7 @@ bool FESolidSolver2::StiffnessMatrix()
 
 	// setup the linear system
 	FESolidLinearSystem LS(this, &m_rigidSolver, *m_pK, m_Fd, m_ui, (m_msymm == REAL_SYMMETRIC), m_alpha, m_nreq);
+	m_rigidSolver.BeginRigidAssembly(m_alpha);
 
 	// calculate the stiffness matrix for each domain
 	for (int i=0; i<mesh.Domains(); ++i) 
@@ -1332,6 +1337,7 @@ bool FESolidSolver2::StiffnessMatrix()
 		if (mesh.Domain(i).IsActive()) 
 		{
 			FEElasticDomain& dom = dynamic_cast<FEElasticDomain&>(mesh.Domain(i));
+			PROFILE_SCOPE(&mesh.Domain(i));
 			dom.StiffnessMatrix(LS);
 		}
 	}
@@ -1340,7 +1346,7 @@ bool FESolidSolver2::StiffnessMatrix()
 	for (int j = 0; j<fem.ModelLoads(); ++j)
 	{
 		FEModelLoad* pml = fem.ModelLoad(j);
-		if (pml->IsActive()) pml->StiffnessMatrix(LS);
+		if (pml->IsActive()) { PROFILE_SCOPE(pml); pml->StiffnessMatrix(LS); }
 	}
     
     // TODO: add body force stiffness for rigid bodies
@@ -1386,6 +1392,9 @@ bool FESolidSolver2::StiffnessMatrix()
 	// constrainst enforced with augmented lagrangian
 	NonLinearConstraintStiffness(LS, tp);
 
+	// add the buffered rigid body coupling terms
+	m_rigidSolver.EndRigidAssembly(*m_pK, m_Fd);
+
 	// add contributions from rigid bodies
 	m_rigidSolver.StiffnessMatrix(*m_pK, tp);
 
@@ -1401,7 +1410,7 @@ void FESolidSolver2::NonLinearConstraintStiffness(FELinearSystem& LS, const FETi
 	for (int i=0; i<N; ++i) 
 	{
 		FENLConstraint* plc = fem.NonlinearConstraint(i);
-		if (plc->IsActive()) plc->StiffnessMatrix(LS, tp);
+		if (plc->IsActive()) { PROFILE_SCOPE(plc); plc->StiffnessMatrix(LS, tp); }
 	}
 }
 
@@ -1415,7 +1424,7 @@ void FESolidSolver2::ContactStiffness(FELinearSystem& LS)
 	for (int i = 0; i<fem.SurfacePairConstraints(); ++i)
 	{
 		FEContactInterface* pci = dynamic_cast<FEContactInterface*>(fem.SurfacePairConstraint(i));
-		if (pci->IsActive()) pci->StiffnessMatrix(LS, tp);
+		if (pci->IsActive()) { PROFILE_SCOPE(pci); pci->StiffnessMatrix(LS, tp); }
 	}
 }
 
@@ -1428,7 +1437,7 @@ void FESolidSolver2::ContactForces(FEGlobalVector& R)
 	for (int i = 0; i<fem.SurfacePairConstraints(); ++i)
 	{
 		FEContactInterface* pci = dynamic_cast<FEContactInterface*>(fem.SurfacePairConstraint(i));
-		if (pci->IsActive()) pci->LoadVector(R, tp);
+		if (pci->IsActive()) { PROFILE_SCOPE(pci); pci->LoadVector(R, tp); }
 	}
 }
 
@@ -1527,7 +1536,7 @@ void FESolidSolver2::InternalForces(FEGlobalVector& R)
 	for (int i = 0; i<mesh.Domains(); ++i)
 	{
 		FEElasticDomain* edom = dynamic_cast<FEElasticDomain*>(&mesh.Domain(i));
-		if (edom) edom->InternalForces(R);
+		if (edom) { PROFILE_SCOPE(&mesh.Domain(i)); edom->InternalForces(R); }
 	}
 }
 
@@ -1543,7 +1552,7 @@ void FESolidSolver2::ExternalForces(FEGlobalVector& RHS)
 	for (int j = 0; j<fem.ModelLoads(); ++j)
 	{
 		FEModelLoad* pml = fem.ModelLoad(j);
-		if (pml->IsActive()) pml->LoadVector(RHS);
+		if (pml->IsActive()) { PROFILE_SCOPE(pml); pml->LoadVector(RHS); }
 	}
 
 	// calculate inertial forces for dynamic problems
@@ -1618,6 +1627,6 @@ void FESolidSolver2::NonLinearConstraintForces(FEGlobalVector& R, const FETimeIn
 	for (int i=0; i<N; ++i) 
 	{
 		FENLConstraint* plc = fem.NonlinearConstraint(i);
-		if (plc->IsActive()) plc->LoadVector(R, tp);
+		if (plc->IsActive()) { PROFILE_SCOPE(plc); plc->LoadVector(R, tp); }
 	}
 }
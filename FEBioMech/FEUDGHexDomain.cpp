@@ -72,8 +72,9 @@ void FEUDGHexDomain::InternalForces(FEGlobalVector& R)
 {
 	int NE = (int)m_Elem.size();
 #pragma omp parallel for
-	for (int i=0; i<NE; ++i)
+	for (int n=0; n<NE; ++n)
 	{
+		int i = ElementOrder(n);
 		// get the element
 		FESolidElement& el = m_Elem[i];
 
@@ -75,6 +75,9 @@ public:
 	//! build the matrix profile
 	void BuildMatrixProfile(FEGlobalMatrix& M) override;
 
+	//! the nodal patches cannot be updated for individual elements
+	bool UpdateMatrixProfile(FEGlobalMatrix& M, const std::vector<int>& elemList) override { return false; }
+
 	//! Set UT4 parameters
 	void SetUT4Parameters(double alpha, bool bdev);
 
@@ -0,0 +1,216 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#include "stdafx.h"
+#include "FEVerletList.h"
+#include <math.h>
+
+FEVerletList::FEVerletList()
+{
+	m_skin = 0.0;
+	m_radius = 0.0;
+	m_nbuilds = 0;
+	m_h = 0.0;
+	m_nx = m_ny = m_nz = 0;
+}
+
+void FEVerletList::Clear()
+{
+	m_q0.clear();
+	m_t0.clear();
+	m_nbr.clear();
+	m_nx = m_ny = m_nz = 0;
+	m_cellStart.clear();
+	m_cellItems.clear();
+}
+
+bool FEVerletList::Update(const std::vector<vec3d>& query, const std::vector<vec3d>& target, double radius)
+{
+	if (NeedsRebuild(query, target, radius) == false) return false;
+	Build(query, target, radius);
+	return true;
+}
+
+// The lists are valid as long as no pair of points came closer than the search radius
+// that was further than the radius plus skin at the last build. This is guaranteed
+// when the largest query displacement plus the largest target displacement does
+// not exceed the skin.
+bool FEVerletList::NeedsRebuild(const std::vector<vec3d>& query, const std::vector<vec3d>& target, double radius) const
+{
+	if ((query.size() != m_q0.size()) || (target.size() != m_t0.size())) return true;
+	if (radius != m_radius) return true;
+	if (m_skin <= 0.0) return true;
+
+	int nq = (int)query.size();
+	int nt = (int)target.size();
+	double dq = 0.0, dt = 0.0;
+#pragma omp parallel
+	{
+		double dqi = 0.0, dti = 0.0;
+#pragma omp for nowait
+		for (int i = 0; i < nq; ++i)
+		{
+			double d = (query[i] - m_q0[i]).norm2();
+			if (d > dqi) dqi = d;
+		}
+#pragma omp for nowait
+		for (int i = 0; i < nt; ++i)
+		{
+			double d = (target[i] - m_t0[i]).norm2();
+			if (d > dti) dti = d;
+		}
+#pragma omp critical
+		{
+			if (dqi > dq) dq = dqi;
+			if (dti > dt) dt = dti;
+		}
+	}
+
+	return (sqrt(dq) + sqrt(dt) > m_skin);
+}
+
+void FEVerletList::CellCoords(const vec3d& r, int& i, int& j, int& k) const
+{
+	i = (int)floor((r.x - m_r0.x) / m_h);
+	j = (int)floor((r.y - m_r0.y) / m_h);
+	k = (int)floor((r.z - m_r0.z) / m_h);
+}
+
+void FEVerletList::BuildGrid(const std::vector<vec3d>& target, double cutoff)
+{
+	int nt = (int)target.size();
+
+	// find the bounding box of the target points
+	vec3d r0 = target[0], r1 = target[0];
+	for (int i = 1; i < nt; ++i)
+	{
+		const vec3d& r = target[i];
+		if (r.x < r0.x) r0.x = r.x;
+		if (r.y < r0.y) r0.y = r.y;
+		if (r.z < r0.z) r0.z = r.z;
+
+		if (r.x > r1.x) r1.x = r.x;
+		if (r.y > r1.y) r1.y = r.y;
+		if (r.z > r1.z) r1.z = r.z;
+	}
+
+	// we only need to resize the grid if the points no longer fit or the 
+	// cutoff distance exceeds the cell size
+	bool resize = ((m_nx == 0) || (cutoff > m_h) ||
+		(r0.x < m_r0.x) || (r0.y < m_r0.y) || (r0.z < m_r0.z) ||
+		(r1.x > m_r1.x) || (r1.y > m_r1.y) || (r1.z > m_r1.z));
+
+	if (resize)
+	{
+		// add a margin so that the grid can be reused when the points move
+		double W = r1.x - r0.x, H = r1.y - r0.y, D = r1.z - r0.z;
+		double L = W; if (H > L) L = H; if (D > L) L = D;
+		double margin = 0.1*L + cutoff;
+		m_r0 = r0 - vec3d(margin, margin, margin);
+		m_r1 = r1 + vec3d(margin, margin, margin);
+
+		// The cells must not be smaller than the cutoff, so that we only need to
+		// look at neighboring cells. We also limit the number of cells to be about
+		// the number of target points.
+		W = m_r1.x - m_r0.x; H = m_r1.y - m_r0.y; D = m_r1.z - m_r0.z;
+		double h = pow(W*H*D / (double)nt, 1.0 / 3.0);
+		if (h < cutoff) h = cutoff;
+		if (h <= 0.0) h = 1.0;
+		m_h = h;
+
+		m_nx = (int)(W / h) + 1;
+		m_ny = (int)(H / h) + 1;
+		m_nz = (int)(D / h) + 1;
+	}
+
+	// sort the target points into the cells
+	int ncells = m_nx*m_ny*m_nz;
+	m_cellStart.assign(ncells + 1, 0);
+	std::vector<int> tag(nt);
+	for (int n = 0; n < nt; ++n)
+	{
+		int i, j, k;
+		CellCoords(target[n], i, j, k);
+		tag[n] = CellIndex(i, j, k);
+		m_cellStart[tag[n] + 1]++;
+	}
+	for (int n = 0; n < ncells; ++n) m_cellStart[n + 1] += m_cellStart[n];
+
+	m_cellItems.resize(nt);
+	std::vector<int> pos(m_cellStart.begin(), m_cellStart.end() - 1);
+	for (int n = 0; n < nt; ++n) m_cellItems[pos[tag[n]]++] = n;
+}
+
+void FEVerletList::Build(const std::vector<vec3d>& query, const std::vector<vec3d>& target, double radius)
+{
+	m_radius = radius;
+	m_q0 = query;
+	m_t0 = target;
+	m_nbuilds++;
+
+	int nq = (int)query.size();
+	m_nbr.resize(nq);
+	if (target.empty())
+	{
+		for (int i = 0; i < nq; ++i) m_nbr[i].clear();
+		return;
+	}
+
+	double cutoff = radius + m_skin;
+	double cutoff2 = cutoff*cutoff;
+	BuildGrid(target, cutoff);
+
+#pragma omp parallel for schedule(dynamic, 64)
+	for (int n = 0; n < nq; ++n)
+	{
+		std::vector<int>& nbr = m_nbr[n];
+		nbr.clear();
+
+		const vec3d& r = query[n];
+		int i0, j0, k0;
+		CellCoords(r, i0, j0, k0);
+
+		for (int k = k0 - 1; k <= k0 + 1; ++k)
+		{
+			if ((k < 0) || (k >= m_nz)) continue;
+			for (int j = j0 - 1; j <= j0 + 1; ++j)
+			{
+				if ((j < 0) || (j >= m_ny)) continue;
+				for (int i = i0 - 1; i <= i0 + 1; ++i)
+				{
+					if ((i < 0) || (i >= m_nx)) continue;
+					int c = CellIndex(i, j, k);
+					for (int l = m_cellStart[c]; l < m_cellStart[c + 1]; ++l)
+					{
+						int m = m_cellItems[l];
+						if ((target[m] - r).norm2() < cutoff2) nbr.push_back(m);
+					}
+				}
+			}
+		}
+	}
+}
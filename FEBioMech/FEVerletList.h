@@ -0,0 +1,83 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#pragma once
+#include <FECore/vec3d.h>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+//! Verlet-style neighbor lists used by the contact potentials.
+//! For each query point, this class stores the target points that are within the 
+//! search radius plus a skin distance. The lists remain valid until the points
+//! have moved more than the skin distance (combined) since the lists were built, so
+//! in most updates only the displacements need to be checked. The target points are
+//! binned in a uniform grid, which is only resized when the target points
+//! move outside of it.
+class FEVerletList
+{
+public:
+	FEVerletList();
+
+	//! Set the skin distance
+	void SetSkin(double skin) { m_skin = skin; }
+
+	//! Update the neighbor lists for the current query and target positions. 
+	//! Returns true if the lists were rebuilt.
+	bool Update(const std::vector<vec3d>& query, const std::vector<vec3d>& target, double radius);
+
+	//! Invalidate the lists, forcing a rebuild on the next update
+	void Clear();
+
+	//! Return the target points that could be within the search radius of query point i
+	const std::vector<int>& Neighbors(int i) const { return m_nbr[i]; }
+
+	//! number of times the lists were (re)built
+	int Builds() const { return m_nbuilds; }
+
+private:
+	bool NeedsRebuild(const std::vector<vec3d>& query, const std::vector<vec3d>& target, double radius) const;
+	void BuildGrid(const std::vector<vec3d>& target, double cutoff);
+	void Build(const std::vector<vec3d>& query, const std::vector<vec3d>& target, double radius);
+	int CellIndex(int i, int j, int k) const { return (k*m_ny + j)*m_nx + i; }
+	void CellCoords(const vec3d& r, int& i, int& j, int& k) const;
+
+private:
+	double	m_skin;		//!< skin distance
+	double	m_radius;	//!< search radius used to build the lists
+	int		m_nbuilds;	//!< number of builds
+
+	std::vector<vec3d>	m_q0;	//!< query positions at last build
+	std::vector<vec3d>	m_t0;	//!< target positions at last build
+	std::vector< std::vector<int> >	m_nbr;	//!< neighbor lists
+
+	// the grid
+	vec3d	m_r0, m_r1;			//!< grid bounding box
+	double	m_h;				//!< cell size
+	int		m_nx, m_ny, m_nz;	//!< grid divisions
+	std::vector<int>	m_cellStart;	//!< start of each cell in m_cellItems
+	std::vector<int>	m_cellItems;	//!< target points sorted by cell
+};
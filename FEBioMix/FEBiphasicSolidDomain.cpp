@@ -264,8 +264,9 @@ void FEBiphasicSolidDomain::InternalForces(FEGlobalVector& R)
 
 	int NE = (int)m_Elem.size();
 	#pragma omp parallel for shared (NE)
-	for (int i=0; i<NE; ++i)
+	for (int ie=0; ie<NE; ++ie)
 	{
+		int i = ElementOrder(ie);
 		// element force vector
 		vector<double> fe;
 		vector<int> lm;
@@ -390,8 +391,9 @@ void FEBiphasicSolidDomain::InternalForcesSS(FEGlobalVector& R)
 {
     int NE = (int)m_Elem.size();
 #pragma omp parallel for shared (NE)
-    for (int i=0; i<NE; ++i)
+    for (int ie=0; ie<NE; ++ie)
     {
+        int i = ElementOrder(ie);
         // element force vector
         vector<double> fe;
         vector<int> lm;
@@ -509,8 +511,9 @@ void FEBiphasicSolidDomain::StiffnessMatrix(FELinearSystem& LS, bool bsymm)
 	int NE = (int)m_Elem.size();
     
     #pragma omp parallel for shared(NE)
-	for (int iel=0; iel<NE; ++iel)
+	for (int ie=0; ie<NE; ++ie)
 	{
+		int iel = ElementOrder(ie);
 		FESolidElement& el = m_Elem[iel];
 
 		// element stiffness matrix
@@ -542,8 +545,9 @@ void FEBiphasicSolidDomain::StiffnessMatrixSS(FELinearSystem& LS, bool bsymm)
 	int NE = (int)m_Elem.size();
 
 	#pragma omp parallel for shared(NE)
-	for (int iel=0; iel<NE; ++iel)
+	for (int ie=0; ie<NE; ++ie)
 	{
+		int iel = ElementOrder(ie);
 		FESolidElement& el = m_Elem[iel];
 
 		// element stiffness matrix
@@ -887,8 +891,9 @@ void FEBiphasicSolidDomain::Update(const FETimeInfo& tp)
 	bool berr = false;
 	int NE = (int) m_Elem.size();
 	#pragma omp parallel for shared(NE, berr)
-	for (int i=0; i<NE; ++i)
+	for (int n=0; n<NE; ++n)
 	{
+		int i = ElementOrder(n);
 		try
 		{
 			UpdateElementStress(i);
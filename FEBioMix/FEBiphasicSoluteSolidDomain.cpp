@@ -335,8 +335,9 @@ void FEBiphasicSoluteSolidDomain::InternalForces(FEGlobalVector& R)
 {
     size_t NE = m_Elem.size();
 #pragma omp parallel for shared (NE)
-    for (int i=0; i<NE; ++i)
+    for (int ie=0; ie<NE; ++ie)
     {
+        int i = ElementOrder(ie);
         // element force vector
         vector<double> fe;
         vector<int> lm;
@@ -450,8 +451,9 @@ void FEBiphasicSoluteSolidDomain::InternalForcesSS(FEGlobalVector& R)
 {
     size_t NE = m_Elem.size();
 #pragma omp parallel for shared (NE)
-    for (int i=0; i<NE; ++i)
+    for (int ie=0; ie<NE; ++ie)
     {
+        int i = ElementOrder(ie);
         // element force vector
         vector<double> fe;
         vector<int> lm;
@@ -560,8 +562,9 @@ void FEBiphasicSoluteSolidDomain::StiffnessMatrix(FELinearSystem& LS, bool bsymm
     const int NE = (int)m_Elem.size();
     
 #pragma omp parallel for
-    for (int iel=0; iel<NE; ++iel)
+    for (int ie=0; ie<NE; ++ie)
     {
+		int iel = ElementOrder(ie);
 		FESolidElement& el = m_Elem[iel];
 
         // element stiffness matrix
@@ -592,8 +595,9 @@ void FEBiphasicSoluteSolidDomain::StiffnessMatrixSS(FELinearSystem& LS, bool bsy
     const int NE = (int)m_Elem.size();
     
 #pragma omp parallel for
-    for (int iel=0; iel<NE; ++iel)
+    for (int ie=0; ie<NE; ++ie)
     {
+		int iel = ElementOrder(ie);
 		FESolidElement& el = m_Elem[iel];
 
         // element stiffness matrix
@@ -1037,8 +1041,9 @@ void FEBiphasicSoluteSolidDomain::Update(const FETimeInfo& tp)
     bool berr = false;
     int NE = (int) m_Elem.size();
 #pragma omp parallel for shared(NE, berr)
-    for (int i=0; i<NE; ++i)
+    for (int n=0; n<NE; ++n)
     {
+        int i = ElementOrder(n);
         try
         {
             UpdateElementStress(i);
@@ -356,6 +356,9 @@ bool FEBiphasicSoluteSolver::Quasin()
 
 			// something went wrong with the update, so we'll need to break
 			if (bret == false) break;
+
+			// update the Lagrange multipliers before the iterations have converged
+			DoInexactAugmentation(normR1, normRi);
 		}
 		else if (m_baugment)
 		{
@@ -488,6 +491,7 @@ bool FEBiphasicSoluteSolver::StiffnessMatrix()
 
 	// setup the linear system
 	FESolidLinearSystem LS(this, &m_rigidSolver, *m_pK, m_Fd, m_ui, (m_msymm == REAL_SYMMETRIC), m_alpha, m_nreq);
+	m_rigidSolver.BeginRigidAssembly(m_alpha);
 
 	// calculate the stiffness matrix for each domain
 	FEAnalysis* pstep = fem.GetCurrentStep();
@@ -538,6 +542,9 @@ bool FEBiphasicSoluteSolver::StiffnessMatrix()
 	// constrainst enforced with augmented lagrangian
 	NonLinearConstraintStiffness(LS, tp);
 
+	// add the buffered rigid body coupling terms
+	m_rigidSolver.EndRigidAssembly(*m_pK, m_Fd);
+
 	// add contributions from rigid bodies
 	m_rigidSolver.StiffnessMatrix(*m_pK, tp);
 
@@ -49,6 +49,7 @@ SOFTWARE.*/
 #include <FECore/FEBoundaryCondition.h>
 #include <FECore/FENLConstraint.h>
 #include <FECore/FELinearConstraintManager.h>
+#include <FECore/FEProfiler.h>
 #include "FEBiphasicAnalysis.h"
 
 //-----------------------------------------------------------------------------
@@ -535,6 +536,9 @@ bool FEBiphasicSolver::Quasin()
 
 			// something went wrong with the update, so we'll need to break
 			if (bret == false) break;
+
+			// update the Lagrange multipliers before the iterations have converged
+			DoInexactAugmentation(normR1, normRi);
 		}
 		else if (m_baugment)
 		{
@@ -609,6 +613,7 @@ bool FEBiphasicSolver::StiffnessMatrix()
 
 	// setup the linear system of equations
 	FESolidLinearSystem LS(this, &m_rigidSolver, *m_pK, m_Fd, m_ui, (m_msymm == REAL_SYMMETRIC), m_alpha, m_nreq);
+	m_rigidSolver.BeginRigidAssembly(m_alpha);
 
 	// calculate the stiffness matrix for each domain
 	FEAnalysis* pstep = fem.GetCurrentStep();
@@ -617,6 +622,7 @@ bool FEBiphasicSolver::StiffnessMatrix()
 	{
 		for (int i=0; i<mesh.Domains(); ++i) 
 		{
+			PROFILE_SCOPE(&mesh.Domain(i));
             // Biphasic analyses may include biphasic and elastic domains
 			FEBiphasicDomain* pbdom = dynamic_cast<FEBiphasicDomain*>(&mesh.Domain(i));
 			if (pbdom) pbdom->StiffnessMatrixSS(LS, bsymm);
@@ -631,6 +637,7 @@ bool FEBiphasicSolver::StiffnessMatrix()
 	{
 		for (int i=0; i<mesh.Domains(); ++i) 
 		{
+			PROFILE_SCOPE(&mesh.Domain(i));
             // Biphasic analyses may include biphasic and elastic domains
 			FEBiphasicDomain* pbdom = dynamic_cast<FEBiphasicDomain*>(&mesh.Domain(i));
 			if (pbdom) pbdom->StiffnessMatrix(LS, bsymm);
@@ -650,7 +657,7 @@ bool FEBiphasicSolver::StiffnessMatrix()
 	for (int i=0; i<nml; ++i)
 	{
 		FEModelLoad* pml = fem.ModelLoad(i);
-		if (pml->IsActive()) pml->StiffnessMatrix(LS);
+		if (pml->IsActive()) { PROFILE_SCOPE(pml); pml->StiffnessMatrix(LS); }
 	}
 
 	// calculate nonlinear constraint stiffness
@@ -658,6 +665,9 @@ bool FEBiphasicSolver::StiffnessMatrix()
 	// constrainst enforced with augmented lagrangian
 	NonLinearConstraintStiffness(LS, tp);
 
+	// add the buffered rigid body coupling terms
+	m_rigidSolver.EndRigidAssembly(*m_pK, m_Fd);
+
 	// add contributions from rigid bodies
 	m_rigidSolver.StiffnessMatrix(*m_pK, tp);
 
@@ -1002,6 +1012,7 @@ void FEBiphasicSolver::InternalForces(FEGlobalVector& RHS)
     {
         for (int i=0; i<mesh.Domains(); ++i)
         {
+            PROFILE_SCOPE(&mesh.Domain(i));
             FEBiphasicDomain* pdom = dynamic_cast<FEBiphasicDomain*>(&mesh.Domain(i));
             if (pdom) pdom->InternalForcesSS(RHS);
             else
@@ -1015,6 +1026,7 @@ void FEBiphasicSolver::InternalForces(FEGlobalVector& RHS)
     {
         for (int i=0; i<mesh.Domains(); ++i)
         {
+            PROFILE_SCOPE(&mesh.Domain(i));
             FEBiphasicDomain* pdom = dynamic_cast<FEBiphasicDomain*>(&mesh.Domain(i));
             if (pdom) pdom->InternalForces(RHS);
             else
@@ -1043,7 +1055,7 @@ void FEBiphasicSolver::ExternalForces(FEGlobalVector& RHS)
     for (int i=0; i<NML; ++i)
     {
         FEModelLoad& mli = *fem.ModelLoad(i);
-        if (mli.IsActive()) mli.LoadVector(RHS);
+        if (mli.IsActive()) { PROFILE_SCOPE(&mli); mli.LoadVector(RHS); }
     }
     
     // calculate contact forces
@@ -1087,7 +1099,7 @@ void FEBiphasicSolver::ContactForces(FEGlobalVector& R)
 	for (int i = 0; i < fem.SurfacePairConstraints(); ++i)
 	{
 		FEContactInterface* pci = dynamic_cast<FEContactInterface*>(fem.SurfacePairConstraint(i));
-		if (pci->IsActive()) pci->LoadVector(R, tp);
+		if (pci->IsActive()) { PROFILE_SCOPE(pci); pci->LoadVector(R, tp); }
 	}
 }
 
@@ -1099,7 +1111,7 @@ void FEBiphasicSolver::ContactStiffness(FELinearSystem& LS)
 	for (int i = 0; i < fem.SurfacePairConstraints(); ++i)
 	{
 		FEContactInterface* pci = dynamic_cast<FEContactInterface*>(fem.SurfacePairConstraint(i));
-		if (pci->IsActive()) pci->StiffnessMatrix(LS, tp);
+		if (pci->IsActive()) { PROFILE_SCOPE(pci); pci->StiffnessMatrix(LS, tp); }
 	}
 }
 
@@ -1111,7 +1123,7 @@ void FEBiphasicSolver::NonLinearConstraintForces(FEGlobalVector& R, const FETime
 	for (int i = 0; i < N; ++i)
 	{
 		FENLConstraint* plc = fem.NonlinearConstraint(i);
-		if (plc->IsActive()) plc->LoadVector(R, tp);
+		if (plc->IsActive()) { PROFILE_SCOPE(plc); plc->LoadVector(R, tp); }
 	}
 }
 
@@ -1123,6 +1135,6 @@ void FEBiphasicSolver::NonLinearConstraintStiffness(FELinearSystem& LS, const FE
 	for (int i = 0; i < N; ++i)
 	{
 		FENLConstraint* plc = fem.NonlinearConstraint(i);
-		if (plc->IsActive()) plc->StiffnessMatrix(LS, tp);
+		if (plc->IsActive()) { PROFILE_SCOPE(plc); plc->StiffnessMatrix(LS, tp); }
 	}
 }
@@ -600,6 +600,84 @@ void FEMultiphasic::PartitionCoefficientFunctions(FEMaterialPoint& mp, vector<do
     }
 }
 
+//-----------------------------------------------------------------------------
+//! Evaluates the material functions that are needed by both the residual and
+//! the stiffness matrix (permeability, diffusivity, osmotic coefficient, solvent
+//! and reaction supplies, and their derivatives) and stores them in the
+//! solutes material point. This should be called after the state of the material
+//! point was updated.
+void FEMultiphasic::UpdateTransportData(FEMaterialPoint& mp)
+{
+	FESolutesMaterialPoint& spt = *mp.ExtractData<FESolutesMaterialPoint>();
+	const int nsol = (int)m_pSolute.size();
+	const int nreact = (int)m_pReact.size();
+
+	// porosity
+	double phiw = Porosity(mp);
+	spt.m_phiw = phiw;
+
+	// permeability
+	spt.m_K = m_pPerm->Permeability(mp);
+	spt.m_dKdE = m_pPerm->Tangent_Permeability_Strain(mp);
+
+	// osmotic coefficient
+	spt.m_osmc = m_pOsmC->OsmoticCoefficient(mp);
+
+	// solute transport properties
+	spt.m_dKdc.resize(nsol);
+	spt.m_D.resize(nsol);
+	spt.m_dDdE.resize(nsol);
+	spt.m_dDdc.assign(nsol, vector<mat3ds>(nsol));
+	spt.m_D0.resize(nsol);
+	spt.m_dD0dc.assign(nsol, vector<double>(nsol));
+	spt.m_dodc.resize(nsol);
+	for (int isol = 0; isol < nsol; ++isol)
+	{
+		FESolute* soli = m_pSolute[isol];
+
+		spt.m_dKdc[isol] = m_pPerm->Tangent_Permeability_Concentration(mp, isol);
+		spt.m_D[isol] = soli->m_pDiff->Diffusivity(mp);
+		spt.m_dDdE[isol] = soli->m_pDiff->Tangent_Diffusivity_Strain(mp);
+		spt.m_D0[isol] = soli->m_pDiff->Free_Diffusivity(mp);
+		spt.m_dodc[isol] = m_pOsmC->Tangent_OsmoticCoefficient_Concentration(mp, isol);
+
+		for (int jsol = 0; jsol < nsol; ++jsol)
+		{
+			spt.m_dDdc[isol][jsol] = soli->m_pDiff->Tangent_Diffusivity_Concentration(mp, jsol);
+			spt.m_dD0dc[isol][jsol] = soli->m_pDiff->Tangent_Free_Diffusivity_Concentration(mp, jsol);
+		}
+	}
+
+	// solvent supply
+	spt.m_phiwhat = 0;
+	spt.m_dphiwhatdp = 0;
+	spt.m_dphiwhatde.zero();
+	spt.m_dphiwhatdc.assign(nsol, 0.0);
+	if (m_pSupp)
+	{
+		spt.m_phiwhat = m_pSupp->Supply(mp);
+		spt.m_dphiwhatdp = m_pSupp->Tangent_Supply_Pressure(mp);
+		spt.m_dphiwhatde = m_pSupp->Tangent_Supply_Strain(mp);
+		for (int isol = 0; isol < nsol; ++isol)
+			spt.m_dphiwhatdc[isol] = m_pSupp->Tangent_Supply_Concentration(mp, isol);
+	}
+
+	// chemical reactions
+	spt.m_zhat.resize(nreact);
+	spt.m_dzhatde.resize(nreact);
+	spt.m_dzhatdc.assign(nreact, vector<double>(nsol));
+	for (int i = 0; i < nreact; ++i)
+	{
+		FEChemicalReaction* reacti = m_pReact[i];
+		spt.m_zhat[i] = reacti->ReactionSupply(mp);
+		spt.m_dzhatde[i] = reacti->Tangent_ReactionSupply_Strain(mp);
+		for (int isol = 0; isol < nsol; ++isol)
+			spt.m_dzhatdc[i][isol] = reacti->Tangent_ReactionSupply_Concentration(mp, isol);
+	}
+
+	spt.m_btd = true;
+}
+
 //-----------------------------------------------------------------------------
 //! actual concentration
 double FEMultiphasic::Concentration(FEMaterialPoint& pt, const int sol)
@@ -88,6 +88,9 @@ public:
                                        vector< vector<double> >& dkdr,
                                        vector< vector<double> >& dkdJr,
                                        vector< vector< vector<double> > >& dkdrc);
+
+	//! evaluate the transport and supply data (and their derivatives) and store them in the material point
+	void UpdateTransportData(FEMaterialPoint& mp);
 	
     //! return solid referential apparent density
     double GetReferentialSolidVolumeFraction(const FEMaterialPoint& mp) override;
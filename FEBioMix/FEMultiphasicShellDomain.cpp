@@ -185,6 +185,25 @@ void FEMultiphasicShellDomain::BuildMatrixProfile(FEGlobalMatrix& M)
     }
 }
 
+//-----------------------------------------------------------------------------
+bool FEMultiphasicShellDomain::UpdateMatrixProfile(FEGlobalMatrix& M, const std::vector<int>& elemList)
+{
+    vector<int> elm;
+    for (int i : elemList)
+    {
+        FEShellElement& el = dynamic_cast<FEShellElement&>(ElementRef(i));
+        UnpackLM(el, elm);
+        M.build_add(elm);
+        
+        // membrane reactions
+        if (m_pMat->MembraneReactions()) {
+            UnpackMembraneLM(el, elm);
+            M.build_add(elm);
+        }
+    }
+    return true;
+}
+
 //-----------------------------------------------------------------------------
 bool FEMultiphasicShellDomain::Init()
 {
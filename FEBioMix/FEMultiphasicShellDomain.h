@@ -94,6 +94,9 @@ public:
     //! build connectivity for matrix profile
     void BuildMatrixProfile(FEGlobalMatrix& M) override;
     
+    //! add only the listed elements to the matrix profile
+    bool UpdateMatrixProfile(FEGlobalMatrix& M, const std::vector<int>& elemList) override;
+    
 public:
     
     // internal work (overridden from FEElasticDomain)
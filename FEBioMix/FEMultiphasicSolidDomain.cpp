@@ -537,8 +537,9 @@ void FEMultiphasicSolidDomain::InternalForces(FEGlobalVector& R)
     int ndpn = 4+nsol;
     
 #pragma omp parallel for
-    for (int i=0; i<NE; ++i)
+    for (int ie=0; ie<NE; ++ie)
     {
+        int i = ElementOrder(ie);
         // element force vector
         vector<double> fe;
         vector<int> lm;
@@ -631,18 +632,20 @@ void FEMultiphasicSolidDomain::ElementInternalForce(FESolidElement& el, vector<d
             je += j[isol]*z[isol];
         }
         
+        // make sure the transport data is available
+        if (spt.m_btd == false) m_pMat->UpdateTransportData(mp);
+        
         // evaluate the porosity, its derivative w.r.t. J, and its gradient
-        double phiw = m_pMat->Porosity(mp);
+        double phiw = spt.m_phiw;
         vector<double> chat(nsol,0);
         
         // get the solvent supply
-        double phiwhat = 0;
-        if (m_pMat->GetSolventSupply()) phiwhat = m_pMat->GetSolventSupply()->Supply(mp);
+        double phiwhat = spt.m_phiwhat;
         
         // chemical reactions
         for (i=0; i<nreact; ++i) {
             FEChemicalReaction* pri = m_pMat->GetReaction(i);
-            double zhat = pri->ReactionSupply(mp);
+            double zhat = spt.m_zhat[i];
             phiwhat += phiw*pri->m_Vbar*zhat;
             for (isol=0; isol<nsol; ++isol)
                 chat[isol] += phiw*zhat*pri->m_v[isol];
@@ -683,8 +686,9 @@ void FEMultiphasicSolidDomain::InternalForcesSS(FEGlobalVector& R)
     int ndpn = 4+nsol;
     
 #pragma omp parallel for
-    for (int i=0; i<NE; ++i)
+    for (int ie=0; ie<NE; ++ie)
     {
+        int i = ElementOrder(ie);
         // element force vector
         vector<double> fe;
         vector<int> lm;
@@ -770,18 +774,20 @@ void FEMultiphasicSolidDomain::ElementInternalForceSS(FESolidElement& el, vector
             je += j[isol]*z[isol];
         }
         
+        // make sure the transport data is available
+        if (spt.m_btd == false) m_pMat->UpdateTransportData(mp);
+        
         // evaluate the porosity, its derivative w.r.t. J, and its gradient
-        double phiw = m_pMat->Porosity(mp);
+        double phiw = spt.m_phiw;
         vector<double> chat(nsol,0);
         
         // get the solvent supply
-        double phiwhat = 0;
-        if (m_pMat->GetSolventSupply()) phiwhat = m_pMat->GetSolventSupply()->Supply(mp);
+        double phiwhat = spt.m_phiwhat;
         
         // chemical reactions
         for (i=0; i<nreact; ++i) {
             FEChemicalReaction* pri = m_pMat->GetReaction(i);
-            double zhat = pri->ReactionSupply(mp);
+            double zhat = spt.m_zhat[i];
             phiwhat += phiw*pri->m_Vbar*zhat;
             for (isol=0; isol<nsol; ++isol)
                 chat[isol] += phiw*zhat*pri->m_v[isol];
@@ -822,8 +828,9 @@ void FEMultiphasicSolidDomain::StiffnessMatrix(FELinearSystem& LS, bool bsymm)
     int NE = (int)m_Elem.size();
     
 #pragma omp parallel for
-    for (int iel=0; iel<NE; ++iel)
+    for (int ie=0; ie<NE; ++ie)
     {
+		int iel = ElementOrder(ie);
 		FESolidElement& el = m_Elem[iel];
 
         // element stiffness matrix
@@ -857,8 +864,9 @@ void FEMultiphasicSolidDomain::StiffnessMatrixSS(FELinearSystem& LS, bool bsymm)
     int NE = (int)m_Elem.size();
     
 #pragma omp parallel for
-    for (int iel=0; iel<NE; ++iel)
+    for (int ie=0; ie<NE; ++ie)
     {
+		int iel = ElementOrder(ie);
 		FESolidElement& el = m_Elem[iel];
 
         // element stiffness matrix
@@ -920,6 +928,9 @@ bool FEMultiphasicSolidDomain::ElementMultiphasicStiffness(FESolidElement& el, m
         FEBiphasicMaterialPoint& ppt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
         FESolutesMaterialPoint&  spt = *(mp.ExtractData<FESolutesMaterialPoint >());
         
+        // make sure the transport data is available
+        if (spt.m_btd == false) m_pMat->UpdateTransportData(mp);
+        
         // calculate jacobian
         detJ = invjact(el, Ji, n)*gw[n];
         
@@ -966,56 +977,45 @@ bool FEMultiphasicSolidDomain::ElementMultiphasicStiffness(FESolidElement& el, m
         vector< vector<double> > dkdJr(spt.m_dkdJr);
         vector< vector< vector<double> > > dkdrc(spt.m_dkdrc);
         
-        // evaluate the porosity and its derivative
-        double phiw = m_pMat->Porosity(mp);
+        // get the porosity and its derivative
+        double phiw = spt.m_phiw;
         double phi0 = ppt.m_phi0t;
         double phis = 1. - phiw;
         double dpdJ = phis/J;
         
-        // evaluate the osmotic coefficient
-        double osmc = m_pMat->GetOsmoticCoefficient()->OsmoticCoefficient(mp);
-        
-        // evaluate the permeability
-        mat3ds K = m_pMat->GetPermeability()->Permeability(mp);
-        tens4dmm dKdE = m_pMat->GetPermeability()->Tangent_Permeability_Strain(mp);
-        
-        vector<mat3ds> dKdc(nsol);
-        vector<mat3ds> D(nsol);
-        vector<tens4dmm> dDdE(nsol);
-        vector< vector<mat3ds> > dDdc(nsol, vector<mat3ds>(nsol));
-        vector<double> D0(nsol);
-        vector< vector<double> > dD0dc(nsol, vector<double>(nsol));
-        vector<double> dodc(nsol);
+        // get the osmotic coefficient
+        double osmc = spt.m_osmc;
+        
+        // get the permeability
+        const mat3ds& K = spt.m_K;
+        const tens4dmm& dKdE = spt.m_dKdE;
+        
+        // get the solute transport properties and their derivatives
+        const vector<mat3ds>& dKdc = spt.m_dKdc;
+        const vector<mat3ds>& D = spt.m_D;
+        const vector<tens4dmm>& dDdE = spt.m_dDdE;
+        const vector< vector<mat3ds> >& dDdc = spt.m_dDdc;
+        const vector<double>& D0 = spt.m_D0;
+        const vector< vector<double> >& dD0dc = spt.m_dD0dc;
+        const vector<double>& dodc = spt.m_dodc;
         vector<mat3ds> dTdc(nsol);
         vector<mat3ds> ImD(nsol);
         mat3dd I(1);
         
-        // evaluate the solvent supply and its derivatives
-        mat3ds Phie; Phie.zero();
-        double Phip = 0;
-        vector<double> Phic(nsol,0);
+        // get the solvent supply derivatives
+        mat3ds Phie = spt.m_dphiwhatde;
+        double Phip = spt.m_dphiwhatdp;
+        vector<double> Phic(spt.m_dphiwhatdc);
         vector<mat3ds> dchatde(nsol);
-        if (m_pMat->GetSolventSupply()) {
-            Phie = m_pMat->GetSolventSupply()->Tangent_Supply_Strain(mp);
-            Phip = m_pMat->GetSolventSupply()->Tangent_Supply_Pressure(mp);
-        }
         
         // chemical reactions
-		vector<double> reactionSupply(nreact, 0.0);
-		vector<mat3ds> tangentReactionSupplyStrain(nreact);
-		vector< vector<double> > tangentReactionSupplyConcentration(nreact, vector<double>(nsol));
+		const vector<double>& reactionSupply = spt.m_zhat;
+		const vector<mat3ds>& tangentReactionSupplyStrain = spt.m_dzhatde;
+		const vector< vector<double> >& tangentReactionSupplyConcentration = spt.m_dzhatdc;
 		for (int i = 0; i < nreact; ++i)
 		{
 			FEChemicalReaction* reacti = m_pMat->GetReaction(i);
 
-			reactionSupply[i] = reacti->ReactionSupply(mp);
-			tangentReactionSupplyStrain[i] = reacti->Tangent_ReactionSupply_Strain(mp);
-
-			for (int isol = 0; isol < nsol; ++isol)
-			{
-				tangentReactionSupplyConcentration[i][isol] = reacti->Tangent_ReactionSupply_Concentration(mp, isol);
-			}
-
 			Phie += reacti->m_Vbar*(I*reactionSupply[i]
 				+ tangentReactionSupplyStrain [i]*(J*phiw));
 
@@ -1023,35 +1023,12 @@ bool FEMultiphasicSolidDomain::ElementMultiphasicStiffness(FESolidElement& el, m
         
         for (int isol=0; isol<nsol; ++isol) {
         
-			FESolute* soli = m_pMat->GetSolute(isol);
-
-			// evaluate the permeability derivatives
-            dKdc[isol] = m_pMat->GetPermeability()->Tangent_Permeability_Concentration(mp,isol);
-            
-            // evaluate the diffusivity tensor and its derivatives
-            D[isol] = soli->m_pDiff->Diffusivity(mp);
-            dDdE[isol] = soli->m_pDiff->Tangent_Diffusivity_Strain(mp);
-            
-            // evaluate the solute free diffusivity
-            D0[isol] = soli->m_pDiff->Free_Diffusivity(mp);
-            
-            // evaluate the derivative of the osmotic coefficient
-            dodc[isol] = m_pMat->GetOsmoticCoefficient()->Tangent_OsmoticCoefficient_Concentration(mp,isol);
-            
             // evaluate the stress tangent with concentration
             //			dTdc[isol] = pm->GetSolid()->Tangent_Concentration(mp,isol);
             dTdc[isol] = mat3ds(0,0,0,0,0,0);
             
             ImD[isol] = I-D[isol]/D0[isol];
             
-            for (int jsol=0; jsol<nsol; ++jsol) {
-                dDdc[isol][jsol] = soli->m_pDiff->Tangent_Diffusivity_Concentration(mp,jsol);
-                dD0dc[isol][jsol] = soli->m_pDiff->Tangent_Free_Diffusivity_Concentration(mp,jsol);
-            }
-            
-            // evaluate the solvent supply tangent with concentration
-            if (m_pMat->GetSolventSupply()) Phic[isol] = m_pMat->GetSolventSupply()->Tangent_Supply_Concentration(mp,isol);
-            
             // chemical reactions
             dchatde[isol].zero();
             for (int ireact=0; ireact<nreact; ++ireact) {
@@ -1322,6 +1299,9 @@ bool FEMultiphasicSolidDomain::ElementMultiphasicStiffnessSS(FESolidElement& el,
         FEBiphasicMaterialPoint& ppt = *(mp.ExtractData<FEBiphasicMaterialPoint>());
         FESolutesMaterialPoint&  spt = *(mp.ExtractData<FESolutesMaterialPoint >());
         
+        // make sure the transport data is available
+        if (spt.m_btd == false) m_pMat->UpdateTransportData(mp);
+        
         // calculate jacobian
         detJ = invjact(el, Ji, n)*gw[n];
         
@@ -1366,73 +1346,47 @@ bool FEMultiphasicSolidDomain::ElementMultiphasicStiffnessSS(FESolidElement& el,
         vector<double> dkdJ(spt.m_dkdJ);
         vector< vector<double> > dkdc(spt.m_dkdc);
         
-        // evaluate the porosity and its derivative
-        double phiw = m_pMat->Porosity(mp);
+        // get the porosity and its derivative
+        double phiw = spt.m_phiw;
         double phis = 1. - phiw;
         double dpdJ = phis/J;
         
-        // evaluate the osmotic coefficient
-        double osmc = m_pMat->GetOsmoticCoefficient()->OsmoticCoefficient(mp);
-        
-        // evaluate the permeability
-        mat3ds K = m_pMat->GetPermeability()->Permeability(mp);
-        tens4dmm dKdE = m_pMat->GetPermeability()->Tangent_Permeability_Strain(mp);
-        
-        vector<mat3ds> dKdc(nsol);
-        vector<mat3ds> D(nsol);
-        vector<tens4dmm> dDdE(nsol);
-        vector< vector<mat3ds> > dDdc(nsol, vector<mat3ds>(nsol));
-        vector<double> D0(nsol);
-        vector< vector<double> > dD0dc(nsol, vector<double>(nsol));
-        vector<double> dodc(nsol);
+        // get the osmotic coefficient
+        double osmc = spt.m_osmc;
+        
+        // get the permeability
+        const mat3ds& K = spt.m_K;
+        const tens4dmm& dKdE = spt.m_dKdE;
+        
+        // get the solute transport properties and their derivatives
+        const vector<mat3ds>& dKdc = spt.m_dKdc;
+        const vector<mat3ds>& D = spt.m_D;
+        const vector<tens4dmm>& dDdE = spt.m_dDdE;
+        const vector< vector<mat3ds> >& dDdc = spt.m_dDdc;
+        const vector<double>& D0 = spt.m_D0;
+        const vector< vector<double> >& dD0dc = spt.m_dD0dc;
+        const vector<double>& dodc = spt.m_dodc;
         vector<mat3ds> dTdc(nsol);
         vector<mat3ds> ImD(nsol);
         mat3dd I(1);
         
-        // evaluate the solvent supply and its derivatives
-        double phiwhat = 0;
-        mat3ds Phie; Phie.zero();
-        double Phip = 0;
-        vector<double> Phic(nsol,0);
-        if (m_pMat->GetSolventSupply()) {
-            phiwhat = m_pMat->GetSolventSupply()->Supply(mp);
-            Phie = m_pMat->GetSolventSupply()->Tangent_Supply_Strain(mp);
-            Phip = m_pMat->GetSolventSupply()->Tangent_Supply_Pressure(mp);
-        }
+        // get the solvent supply and its derivatives
+        double phiwhat = spt.m_phiwhat;
+        mat3ds Phie = spt.m_dphiwhatde;
+        double Phip = spt.m_dphiwhatdp;
+        vector<double> Phic(spt.m_dphiwhatdc);
         
         // chemical reactions
         for (i=0; i<nreact; ++i)
-            Phie += m_pMat->GetReaction(i)->m_Vbar*(I*m_pMat->GetReaction(i)->ReactionSupply(mp)
-                                                    +m_pMat->GetReaction(i)->Tangent_ReactionSupply_Strain(mp)*(J*phiw));
+            Phie += m_pMat->GetReaction(i)->m_Vbar*(I*spt.m_zhat[i]
+                                                    +spt.m_dzhatde[i]*(J*phiw));
         
         for (isol=0; isol<nsol; ++isol) {
-            // evaluate the permeability derivatives
-            dKdc[isol] = m_pMat->GetPermeability()->Tangent_Permeability_Concentration(mp,isol);
-            
-            // evaluate the diffusivity tensor and its derivatives
-            D[isol] = m_pMat->GetSolute(isol)->m_pDiff->Diffusivity(mp);
-            dDdE[isol] = m_pMat->GetSolute(isol)->m_pDiff->Tangent_Diffusivity_Strain(mp);
-            
-            // evaluate the solute free diffusivity
-            D0[isol] = m_pMat->GetSolute(isol)->m_pDiff->Free_Diffusivity(mp);
-            
-            // evaluate the derivative of the osmotic coefficient
-            dodc[isol] = m_pMat->GetOsmoticCoefficient()->Tangent_OsmoticCoefficient_Concentration(mp,isol);
-            
             // evaluate the stress tangent with concentration
             //			dTdc[isol] = pm->GetSolid()->Tangent_Concentration(mp,isol);
             dTdc[isol] = mat3ds(0,0,0,0,0,0);
             
             ImD[isol] = I-D[isol]/D0[isol];
-            
-            for (jsol=0; jsol<nsol; ++jsol) {
-                dDdc[isol][jsol] = m_pMat->GetSolute(isol)->m_pDiff->Tangent_Diffusivity_Concentration(mp,jsol);
-                dD0dc[isol][jsol] = m_pMat->GetSolute(isol)->m_pDiff->Tangent_Free_Diffusivity_Concentration(mp,jsol);
-            }
-            
-            // evaluate the solvent supply tangent with concentration
-            if (m_pMat->GetSolventSupply()) Phic[isol] = m_pMat->GetSolventSupply()->Tangent_Supply_Concentration(mp,isol);
-            
         }
         
         // Miscellaneous constants
@@ -1576,7 +1530,7 @@ bool FEMultiphasicSolidDomain::ElementMultiphasicStiffnessSS(FESolidElement& el,
                         dchatdc[isol][jsol] = 0;
                         for (ireact=0; ireact<nreact; ++ireact)
                             dchatdc[isol][jsol] += m_pMat->GetReaction(ireact)->m_v[isol]
-                            *m_pMat->GetReaction(ireact)->Tangent_ReactionSupply_Concentration(mp,jsol);
+                            *spt.m_dzhatdc[ireact][jsol];
                     }
                 }
                 
@@ -1612,8 +1566,9 @@ void FEMultiphasicSolidDomain::Update(const FETimeInfo& tp)
     int NE = (int) m_Elem.size();
     double dt = fem.GetTime().timeIncrement;
 #pragma omp parallel for shared(NE, berr)
-    for (int i=0; i<NE; ++i)
+    for (int n=0; n<NE; ++n)
     {
+        int i = ElementOrder(n);
         try
         {
             UpdateElementStress(i, dt);
@@ -1754,6 +1709,9 @@ void FEMultiphasicSolidDomain::UpdateElementStress(int iel, double dt)
         for (int j=0; j<m_pMat->Reactions(); ++j)
             pmb->GetReaction(j)->UpdateElementData(mp);
         
+        // evaluate the transport data for the residual and stiffness matrix
+        pmb->UpdateTransportData(mp);
+        
     }
     if (m_breset) m_breset = false;
 }
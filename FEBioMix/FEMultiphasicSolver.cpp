@@ -54,6 +54,7 @@ SOFTWARE.*/
 #include <FECore/FEBoundaryCondition.h>
 #include <FECore/FENLConstraint.h>
 #include <FECore/FELinearConstraintManager.h>
+#include <FECore/FEProfiler.h>
 #include "FEMultiphasicAnalysis.h"
 
 //-----------------------------------------------------------------------------
@@ -614,6 +615,9 @@ bool FEMultiphasicSolver::Quasin()
 
 			// something went wrong with the update, so we'll need to break
 			if (bret == false) break;
+
+			// update the Lagrange multipliers before the iterations have converged
+			DoInexactAugmentation(normR1, normRi);
 		}
 		else if (m_baugment)
 		{
@@ -670,6 +674,7 @@ bool FEMultiphasicSolver::Residual(vector<double>& R)
 	// internal stress work
 	for (i=0; i<mesh.Domains(); ++i)
 	{
+        PROFILE_SCOPE(&mesh.Domain(i));
         FEDomain& dom = mesh.Domain(i);
         FEElasticDomain* ped = dynamic_cast<FEElasticDomain*>(&dom);
         FEBiphasicDomain*  pbd = dynamic_cast<FEBiphasicDomain* >(&dom);
@@ -709,7 +714,7 @@ bool FEMultiphasicSolver::Residual(vector<double>& R)
 	for (i = 0; i < NML; ++i)
 	{
 		FEModelLoad& mli = *fem.ModelLoad(i);
-		if (mli.IsActive()) mli.LoadVector(RHS);
+		if (mli.IsActive()) { PROFILE_SCOPE(&mli); mli.LoadVector(RHS); }
 	}
 
 	// calculate contact forces
@@ -753,6 +758,7 @@ bool FEMultiphasicSolver::StiffnessMatrix()
 	FEMesh& mesh = fem.GetMesh();
 
 	FESolidLinearSystem LS(this, &m_rigidSolver, *m_pK, m_Fd, m_ui, (m_msymm == REAL_SYMMETRIC), m_alpha, m_nreq);
+	m_rigidSolver.BeginRigidAssembly(m_alpha);
 
 	// calculate the stiffness matrix for each domain
 	FEAnalysis* pstep = fem.GetCurrentStep();
@@ -761,6 +767,7 @@ bool FEMultiphasicSolver::StiffnessMatrix()
 	{
 		for (int i=0; i<mesh.Domains(); ++i) 
 		{
+			PROFILE_SCOPE(&mesh.Domain(i));
 			FEDomain& dom = mesh.Domain(i);
 			FEElasticDomain*        pde = dynamic_cast<FEElasticDomain*  >(&dom);
 			FEBiphasicDomain*       pbd = dynamic_cast<FEBiphasicDomain* >(&dom);
@@ -779,6 +786,7 @@ bool FEMultiphasicSolver::StiffnessMatrix()
 	{
 		for (int i = 0; i<mesh.Domains(); ++i)
 		{
+			PROFILE_SCOPE(&mesh.Domain(i));
 			FEDomain& dom = mesh.Domain(i);
 			FEElasticDomain*        pde = dynamic_cast<FEElasticDomain*  >(&dom);
 			FEBiphasicDomain*       pbd = dynamic_cast<FEBiphasicDomain* >(&dom);
@@ -802,7 +810,7 @@ bool FEMultiphasicSolver::StiffnessMatrix()
 	for (int i = 0; i<nsl; ++i)
 	{
 		FEModelLoad* pml = fem.ModelLoad(i);
-		if (pml->IsActive()) pml->StiffnessMatrix(LS);
+		if (pml->IsActive()) { PROFILE_SCOPE(pml); pml->StiffnessMatrix(LS); }
 	}
 
 	// calculate nonlinear constraint stiffness
@@ -810,6 +818,9 @@ bool FEMultiphasicSolver::StiffnessMatrix()
 	// constrainst enforced with augmented lagrangian
 	NonLinearConstraintStiffness(LS, tp);
 
+	// add the buffered rigid body coupling terms
+	m_rigidSolver.EndRigidAssembly(*m_pK, m_Fd);
+
 	// add contributions from rigid bodies
 	m_rigidSolver.StiffnessMatrix(*m_pK, tp);
 
@@ -1227,7 +1238,7 @@ void FEMultiphasicSolver::ContactForces(FEGlobalVector& R)
 	for (int i = 0; i < fem.SurfacePairConstraints(); ++i)
 	{
 		FEContactInterface* pci = dynamic_cast<FEContactInterface*>(fem.SurfacePairConstraint(i));
-		if (pci->IsActive()) pci->LoadVector(R, tp);
+		if (pci->IsActive()) { PROFILE_SCOPE(pci); pci->LoadVector(R, tp); }
 	}
 }
 
@@ -1239,7 +1250,7 @@ void FEMultiphasicSolver::ContactStiffness(FELinearSystem& LS)
 	for (int i = 0; i < fem.SurfacePairConstraints(); ++i)
 	{
 		FEContactInterface* pci = dynamic_cast<FEContactInterface*>(fem.SurfacePairConstraint(i));
-		if (pci->IsActive()) pci->StiffnessMatrix(LS, tp);
+		if (pci->IsActive()) { PROFILE_SCOPE(pci); pci->StiffnessMatrix(LS, tp); }
 	}
 }
 
@@ -1251,7 +1262,7 @@ void FEMultiphasicSolver::NonLinearConstraintForces(FEGlobalVector& R, const FET
 	for (int i = 0; i < N; ++i)
 	{
 		FENLConstraint* plc = fem.NonlinearConstraint(i);
-		if (plc->IsActive()) plc->LoadVector(R, tp);
+		if (plc->IsActive()) { PROFILE_SCOPE(plc); plc->LoadVector(R, tp); }
 	}
 }
 
@@ -1263,6 +1274,6 @@ void FEMultiphasicSolver::NonLinearConstraintStiffness(FELinearSystem& LS, const
 	for (int i = 0; i < N; ++i)
 	{
 		FENLConstraint* plc = fem.NonlinearConstraint(i);
-		if (plc->IsActive()) plc->StiffnessMatrix(LS, tp);
+		if (plc->IsActive()) { PROFILE_SCOPE(plc); plc->StiffnessMatrix(LS, tp); }
 	}
 }
@@ -46,6 +46,7 @@ FESolutesMaterialPoint::FESolutesMaterialPoint(FEMaterialPointData* ppt) : FEMat
 	m_rhor = 0;
 	m_strain = 0;
 	m_pe = m_pi = 0;
+	m_btd = false;
 }
 
 //-----------------------------------------------------------------------------
@@ -94,6 +95,7 @@ void FESolutesMaterialPoint::Init()
     m_ide.clear();
     m_idi.clear();
     m_bsb.clear();
+    m_btd = false;
     
 	// don't forget to initialize the base class
 	FEMaterialPointData::Init();
@@ -28,6 +28,7 @@ SOFTWARE.*/
 
 #pragma once
 #include <FECore/FEMaterialPoint.h>
+#include <FECore/tens4d.h>
 #include "febiomix_api.h"
 
 //-----------------------------------------------------------------------------
@@ -89,5 +90,28 @@ public:
     std::vector<int>     m_ide;      //!< solute IDs on external side
     std::vector<int>     m_idi;      //!< solute IDs on internal side
     std::vector<bool>   m_bsb;  //!< flag indicating that solute is solid-bound
+
+public:
+	// transport and supply data, evaluated once per update (see FEMultiphasic::UpdateTransportData)
+	// and reused by the residual and stiffness evaluations
+	bool			m_btd;		//!< flag indicating that the transport data is valid
+	double			m_phiw;		//!< porosity
+	double			m_osmc;		//!< osmotic coefficient
+	mat3ds			m_K;		//!< hydraulic permeability
+	tens4dmm		m_dKdE;		//!< derivative of m_K with strain
+	std::vector<mat3ds>		m_dKdc;		//!< derivative of m_K with effective concentration
+	std::vector<mat3ds>		m_D;		//!< solute diffusivity
+	std::vector<tens4dmm>	m_dDdE;		//!< derivative of m_D with strain
+	std::vector< std::vector<mat3ds> >	m_dDdc;	//!< derivative of m_D with effective concentration
+	std::vector<double>		m_D0;		//!< solute free diffusivity
+	std::vector< std::vector<double> >	m_dD0dc;	//!< derivative of m_D0 with effective concentration
+	std::vector<double>		m_dodc;		//!< derivative of m_osmc with effective concentration
+	double			m_phiwhat;	//!< solvent supply
+	double			m_dphiwhatdp;	//!< derivative of solvent supply with pressure
+	mat3ds			m_dphiwhatde;	//!< derivative of solvent supply with strain
+	std::vector<double>		m_dphiwhatdc;	//!< derivative of solvent supply with effective concentration
+	std::vector<double>		m_zhat;		//!< chemical reaction supplies
+	std::vector<mat3ds>		m_dzhatde;	//!< derivative of reaction supplies with strain
+	std::vector< std::vector<double> >	m_dzhatdc;	//!< derivative of reaction supplies with effective concentration
 };
 
@@ -303,8 +303,9 @@ void FETriphasicDomain::InternalForces(FEGlobalVector& R)
 {
 	size_t NE = m_Elem.size();
 	#pragma omp parallel for shared (NE)
-	for (int i=0; i<NE; ++i)
+	for (int ie=0; ie<NE; ++ie)
 	{
+		int i = ElementOrder(ie);
 		// element force vector
 		vector<double> fe;
 		vector<int> lm;
@@ -423,8 +424,9 @@ void FETriphasicDomain::InternalForcesSS(FEGlobalVector& R)
 {
     size_t NE = m_Elem.size();
 #pragma omp parallel for shared (NE)
-    for (int i=0; i<NE; ++i)
+    for (int ie=0; ie<NE; ++ie)
     {
+        int i = ElementOrder(ie);
         // element force vector
         vector<double> fe;
         vector<int> lm;
@@ -531,8 +533,9 @@ void FETriphasicDomain::StiffnessMatrix(FELinearSystem& LS, bool bsymm)
 	size_t NE = m_Elem.size();
     
 	#pragma omp parallel for shared(NE)
-	for (int iel=0; iel<NE; ++iel)
+	for (int ie=0; ie<NE; ++ie)
 	{
+		int iel = ElementOrder(ie);
 		FESolidElement& el = m_Elem[iel];
 
 		// element stiffness matrix
@@ -564,8 +567,9 @@ void FETriphasicDomain::StiffnessMatrixSS(FELinearSystem& LS, bool bsymm)
 	size_t NE = m_Elem.size();
     
     #pragma omp parallel for shared(NE)
-	for (int iel=0; iel<NE; ++iel)
+	for (int ie=0; ie<NE; ++ie)
 	{
+		int iel = ElementOrder(ie);
 		FESolidElement& el = m_Elem[iel];
 
 		// element stiffness matrix
@@ -1194,8 +1198,9 @@ void FETriphasicDomain::Update(const FETimeInfo& tp)
 	bool berr = false;
 	int NE = (int) m_Elem.size();
 	#pragma omp parallel for shared(NE, berr)
-	for (int i=0; i<NE; ++i)
+	for (int n=0; n<NE; ++n)
 	{
+		int i = ElementOrder(n);
 		try
 		{
 			UpdateElementStress(i);
@@ -36,6 +36,7 @@ SOFTWARE.*/
 #include <FECore/FEPlotDataStore.h>
 #include <FECore/log.h>
 #include <FECore/FEPIDController.h>
+#include <FECore/FEProfiler.h>
 #include <sstream>
 
 FEBioPlotFile::DICTIONARY_ITEM::DICTIONARY_ITEM()
@@ -1513,6 +1514,8 @@ void FEBioPlotFile::WriteObject(PlotObject* po)
 //-----------------------------------------------------------------------------
 bool FEBioPlotFile::Write(float ftime, int flag)
 {
+	PROFILE_SCOPE("PlotFile");
+
 	FEModel& fem = *GetFEModel();
 	PlotFile::Dictionary& dic = GetDictionary();
 
@@ -1684,6 +1687,8 @@ void FEBioPlotFile::WriteSurfaceData(FEModel& fem)
 //-----------------------------------------------------------------------------
 void FEBioPlotFile::WriteGlobalDataField(FEModel& fem, FEPlotData* pd)
 {
+	PROFILE_SCOPE(pd);
+
 	int ndata = pd->VarSize(pd->DataType());
 	FEDataStream a; a.reserve(ndata);
 	if (pd->Save(a))
@@ -1698,6 +1703,8 @@ void FEBioPlotFile::WriteGlobalDataField(FEModel& fem, FEPlotData* pd)
 //-----------------------------------------------------------------------------
 void FEBioPlotFile::WriteNodeDataField(FEModel &fem, FEPlotData* pd)
 {
+	PROFILE_SCOPE(pd);
+
 	// loop over all node sets
 	// right now there is only one, namely the node set of all mesh nodes
 	// so we just pass the mesh
@@ -1717,6 +1724,8 @@ void FEBioPlotFile::WriteNodeDataField(FEModel &fem, FEPlotData* pd)
 //-----------------------------------------------------------------------------
 void FEBioPlotFile::WriteSurfaceDataField(FEModel& fem, FEPlotData* pd)
 {
+	PROFILE_SCOPE(pd);
+
 	// get the domain name (if any)
 	string domName;
 	const char* szdom = pd->GetDomainName();
@@ -1799,6 +1808,8 @@ void FEBioPlotFile::WriteSurfaceDataField(FEModel& fem, FEPlotData* pd)
 //-----------------------------------------------------------------------------
 void FEBioPlotFile::WriteDomainDataField(FEModel &fem, FEPlotData* pd)
 {
+	PROFILE_SCOPE(pd);
+
 	FEMesh& m = fem.GetMesh();
 	int ND = m.Domains();
 
@@ -1017,8 +1017,9 @@ void FEElasticSolidDomain2O::StiffnessMatrix(FELinearSystem& LS)
 	FETimeInfo tp = GetFEModel()->GetTime();
 	
 	#pragma omp parallel for shared (NE)
-	for (int iel=0; iel<NE; ++iel)
+	for (int ie=0; ie<NE; ++ie)
 	{
+		int iel = ElementOrder(ie);
 		FESolidElement& el = m_Elem[iel];
 
 		// element stiffness matrix
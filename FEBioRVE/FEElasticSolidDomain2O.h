@@ -99,6 +99,9 @@ public:
 	//! (overridden from FEDomain)
 	void BuildMatrixProfile(FEGlobalMatrix& M) override;
 
+	//! the interface elements cannot be updated for individual elements
+	bool UpdateMatrixProfile(FEGlobalMatrix& M, const std::vector<int>& elemList) override { return false; }
+
 	//! overridden from FEElasticSolidDomain
 	void Update(const FETimeInfo& tp) override;
 
@@ -144,6 +144,18 @@ void FEBioOutputSection::ParseLogfile(XMLTag &tag)
 			else if (strcmp(szcomment, "off") == 0) bcomment = false;
 		}
 
+		// the file type can be "text" (default) or "binary"
+		bool bbinary = false;
+		const char* szfiletype = tag.AttributeValue("file_type", true);
+		if (szfiletype != 0)
+		{
+			if (strcmp(szfiletype, "binary") == 0) bbinary = true;
+			else if (strcmp(szfiletype, "text") != 0) throw XMLReader::InvalidAttributeValue(tag, "file_type", szfiletype);
+
+			// binary data can only be written to a separate file
+			if (bbinary && (szfile == 0)) throw XMLReader::InvalidAttributeValue(tag, "file_type", szfiletype);
+		}
+
 		// get the data attribute
 		const char* szdata = tag.AttributeValue("data");
 
@@ -275,6 +287,7 @@ void FEBioOutputSection::ParseLogfile(XMLTag &tag)
 		{
 			pdr->SetData(szdata);
 			if (szname != 0) pdr->SetName(szname); else pdr->SetName(szdata);
+			pdr->SetBinary(bbinary);
 			if (szfile) pdr->SetFileName(szfile);
 			if (szdelim != 0) pdr->SetDelim(szdelim);
 			if (szformat != 0) pdr->SetFormat(szformat);
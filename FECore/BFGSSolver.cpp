@@ -41,12 +41,14 @@ BEGIN_FECORE_CLASS(BFGSSolver, FENewtonStrategy)
 	ADD_PARAMETER(m_max_buf_size, FE_RANGE_GREATER_OR_EQUAL(0), "max_buffer_size"); 
 	ADD_PARAMETER(m_cycle_buffer, "cycle_buffer");
 	ADD_PARAMETER(m_cmax, FE_RANGE_GREATER_OR_EQUAL(0.0), "cmax");
+	ADD_PARAMETER(m_singlePrecision, "single_precision_ups");
 END_FECORE_CLASS();
 
 //-----------------------------------------------------------------------------
 BFGSSolver::BFGSSolver(FEModel* fem) : FENewtonStrategy(fem)
 {
 	m_neq = 0;
+	m_singlePrecision = false;
 
 	// pointer to linear solver
 	m_plinsolve = 0;
@@ -63,8 +65,7 @@ bool BFGSSolver::Init()
 	int neq = m_pns->m_neq;
 
 	// allocate storage for BFGS update vectors
-	m_V.resize(m_max_buf_size, neq);
-	m_W.resize(m_max_buf_size, neq);
+	m_VW.Create(m_max_buf_size, neq, m_singlePrecision);
 
 	m_D.resize(neq);
 	m_G.resize(neq);
@@ -134,14 +135,12 @@ bool BFGSSolver::Update(double s, vector<double>& ui, vector<double>& R0, vector
 	// do the update only when allowed
 	if ((m_nups < m_max_buf_size) || (m_cycle_buffer == true))
 	{
-		double* vn = m_V[n];
-		double* wn = m_W[n];
-
-		for (int i=0; i<neq; ++i)	
-		{
-			vn[i] = -m_H[i]*c - m_G[i];
-			wn[i] = m_D[i]*dgi;
-		}
+		// we no longer need G, so we use it to store V
+#pragma omp parallel for if (neq > 10000)
+		for (int i=0; i<neq; ++i) m_G[i] = -m_H[i]*c - m_G[i];
+
+		m_VW.SetVector(n, 0, m_G);
+		m_VW.SetVector(n, 1, m_D, dgi);
 	}
 
 	// increment update counter
@@ -178,13 +177,8 @@ void BFGSSolver::SolveEquations(vector<double>& x, vector<double>& b)
 	{
 		int n = (n0 + i) % m_max_buf_size;
 
-		double* vi = m_V[n];
-		double* wi = m_W[n];
-
-		double wr = 0;
-		for (int j = 0; j<m_neq; j++) wr += wi[j] * tmp[j];
-
-		for (int j = 0; j<m_neq; j++) tmp[j] += vi[j] * wr;
+		// tmp += V*(W.tmp)
+		m_VW.DotUpdate(n, 1, 1.0, 0.0, tmp);
 	}
 
 	// perform a backsubstitution
@@ -198,12 +192,7 @@ void BFGSSolver::SolveEquations(vector<double>& x, vector<double>& b)
 	{
 		int n = (n0 + i) % m_max_buf_size;
 
-		double* vi = m_V[n];
-		double* wi = m_W[n];
-
-		double vr = 0;
-		for (int j = 0; j<m_neq; ++j) vr += vi[j] * x[j];
-
-		for (int j = 0; j<m_neq; ++j) x[j] += wi[j] * vr;
+		// x += W*(V.x)
+		m_VW.DotUpdate(n, 0, 0.0, 1.0, x);
 	}
 }
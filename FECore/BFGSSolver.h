@@ -32,6 +32,7 @@ SOFTWARE.*/
 #include "vector.h"
 #include "LinearSolver.h"
 #include "FENewtonStrategy.h"
+#include "QNUpdateBuffer.h"
 
 //-----------------------------------------------------------------------------
 //! The BFGSSolver solves a nonlinear system of equations using the BFGS method.
@@ -57,9 +58,9 @@ public:
 	LinearSolver*	m_plinsolve;	//!< pointer to linear solver
 	int				m_neq;		//!< number of equations
 
-	// BFGS update vectors
-	matrix			m_V;		//!< BFGS update vector
-	matrix			m_W;		//!< BFGS update vector
+	// BFGS update vectors (V stored as vector 0, W as vector 1)
+	QNUpdateBuffer	m_VW;		//!< BFGS update vectors
+	bool			m_singlePrecision;	//!< store update vectors in single precision
 	vector<double>	m_D, m_G, m_H;	//!< temp vectors for calculating BFGS update vectors
 
 	vector<double>	tmp;
@@ -33,6 +33,7 @@ SOFTWARE.*/
 #include "FEAnalysis.h"
 #include "log.h"
 #include <sstream>
+#include <stdint.h>
 
 //-----------------------------------------------------------------------------
 UnknownDataField::UnknownDataField(const char* sz) : std::runtime_error(sz)
@@ -54,6 +55,9 @@ DataRecord::DataRecord(FEModel* pfem, int ntype) : FECoreBase(pfem), m_type(ntyp
 	m_fp = 0;
 	m_szfile[0] = 0;
 
+	m_bbinary = false;
+	m_bheader = false;
+	m_hdrCols = 0;
 }
 
 //-----------------------------------------------------------------------------
@@ -62,7 +66,8 @@ bool DataRecord::SetFileName(const char* szfile)
 	if (szfile == nullptr) return false;
 
 	strcpy(m_szfile, szfile);
-	m_fp = fopen(szfile, "wt");
+	m_fp = fopen(szfile, (m_bbinary ? "wb" : "wt"));
+	m_bheader = false;
 	if (m_fp == 0)
 	{
 		feLogError("FAILED CREATING DATA FILE %s\n\n", szfile);
@@ -210,8 +215,15 @@ bool DataRecord::Write()
 	feLog("Time = %.9lg\n", ftime);
 	feLog("Data = %s\n", m_szname);
 
-	// write some comments
+	// write the binary file
 	FILE* fp = m_fp;
+	if (fp && m_bbinary)
+	{
+		feLog("File = %s\n", m_szfile);
+		return writeBinaryStep(nstep, ftime);
+	}
+
+	// write some comments
 	if (fp && m_bcomm)
 	{
 		// we save the data in a seperate file
@@ -251,6 +263,97 @@ bool DataRecord::Write()
 	return true;
 }
 
+//-----------------------------------------------------------------------------
+bool DataRecord::writeBinaryHeader()
+{
+	FILE* fp = m_fp;
+
+	// get the column names from the data expression
+	std::vector<std::string> cols;
+	std::string data(m_szdata);
+	size_t l = 0;
+	do
+	{
+		size_t r = data.find(';', l);
+		cols.push_back(data.substr(l, (r == std::string::npos ? r : r - l)));
+		l = (r == std::string::npos ? r : r + 1);
+	} while (l != std::string::npos);
+	int ncols = Size();
+	cols.resize(ncols);
+
+	uint32_t nitems = (uint32_t)m_item.size();
+
+	// figure out the size of the header
+	uint64_t headerSize = 8 + 4 * sizeof(uint32_t) + 2 * sizeof(uint64_t) + nitems * sizeof(int32_t);
+	for (int i = 0; i < ncols; ++i) headerSize += 2 * sizeof(uint32_t) + cols[i].size();
+	uint64_t pad = (8 - headerSize % 8) % 8;
+	headerSize += pad;
+	uint64_t blockSize = 2 * sizeof(int32_t) + sizeof(double) + (uint64_t)ncols * nitems * sizeof(double);
+
+	char szmagic[8] = { 'F','E','B','L','O','G','B', 0 };
+	uint32_t hdr[4] = { 1, (uint32_t)m_type, nitems, (uint32_t)ncols };
+	fwrite(szmagic, 1, 8, fp);
+	fwrite(hdr, sizeof(uint32_t), 4, fp);
+	fwrite(&headerSize, sizeof(uint64_t), 1, fp);
+	fwrite(&blockSize, sizeof(uint64_t), 1, fp);
+
+	std::vector<int32_t> ids(m_item.begin(), m_item.end());
+	if (nitems > 0) fwrite(&ids[0], sizeof(int32_t), nitems, fp);
+
+	for (int i = 0; i < ncols; ++i)
+	{
+		uint32_t col[2] = { 0, (uint32_t)cols[i].size() };
+		fwrite(col, sizeof(uint32_t), 2, fp);
+		if (col[1] > 0) fwrite(cols[i].c_str(), 1, col[1], fp);
+	}
+
+	const char zero[8] = { 0 };
+	if (pad) fwrite(zero, 1, (size_t)pad, fp);
+
+	m_bheader = true;
+	m_hdrItem = m_item;
+	m_hdrCols = ncols;
+
+	return (ferror(fp) == 0);
+}
+
+//-----------------------------------------------------------------------------
+bool DataRecord::writeBinaryStep(int nstep, double ftime)
+{
+	FILE* fp = m_fp;
+
+	// The blocks that follow a header must all have the same layout, so if the items
+	// changed (e.g. after remeshing), we start a new segment with its own header.
+	int nitems = (int)m_item.size();
+	int ncols = Size();
+	if ((m_bheader == false) || (ncols != m_hdrCols) || (m_item != m_hdrItem))
+	{
+		if (writeBinaryHeader() == false) return false;
+	}
+
+	// evaluate all the data, one column at a time
+	m_buf.resize((size_t)nitems * ncols);
+	for (int j = 0; j < ncols; ++j)
+	{
+		double* col = m_buf.data() + (size_t)j * nitems;
+		for (int i = 0; i < nitems; ++i) col[i] = Evaluate(m_item[i], j);
+	}
+
+	int32_t n[2] = { nstep, nitems };
+	fwrite(n, sizeof(int32_t), 2, fp);
+	fwrite(&ftime, sizeof(double), 1, fp);
+	if (m_buf.empty() == false) fwrite(m_buf.data(), sizeof(double), m_buf.size(), fp);
+	fflush(fp);
+
+	if (ferror(fp))
+	{
+		feLogError("FAILED WRITING DATA FILE %s\n\n", m_szfile);
+		return false;
+	}
+
+	return true;
+}
+
 //-----------------------------------------------------------------------------
 
 void DataRecord::SetItemList(const std::vector<int>& items)
@@ -280,6 +383,10 @@ void DataRecord::Serialize(DumpStream &ar)
 	ar & m_item;
 	ar & m_szdata;
 
+	// the binary flag was added in version 7
+	if (ar.IsSaving() || (ar.Version() >= DUMP_VERSION_LOGBINARY)) ar & m_bbinary;
+	else m_bbinary = false;
+
 	// when we're loading we need to reinitialize the file
 	if (ar.IsLoading())
 	{
@@ -290,7 +397,10 @@ void DataRecord::Serialize(DumpStream &ar)
 		if (m_szfile[0] != 0)
 		{
 			// reopen data file for appending
-			m_fp = fopen(m_szfile, "a+");
+			m_fp = fopen(m_szfile, (m_bbinary ? "ab" : "a+"));
+
+			// the binary file continues with a new segment, which starts with a header
+			m_bheader = false;
 		}
 	}
 }
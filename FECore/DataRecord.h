@@ -61,7 +61,37 @@ public:
 };
 
 //-----------------------------------------------------------------------------
-
+// Data records can be written as text (default) or in a binary columnar format.
+// The binary file consists of one or more segments. Each segment starts with a header, 
+// followed by one block per time step that is appended each time the record is written.
+// A new segment is started when the item list changes and after a restart. All values
+// are in native byte order. See Documentation/Scripts/febio_logdata.py for a reader.
+//
+// header:
+//   char[8]    magic  ("FEBLOGB" followed by a zero byte)
+//   uint32     version
+//   uint32     record type (see FEDataRecordType)
+//   uint32     number of items (rows)
+//   uint32     number of data columns
+//   uint64     size of header in bytes (offset of first step block)
+//   uint64     size of a step block in bytes
+//   int32      item IDs[number of items]
+//   for each column:
+//     uint32   data type (0 = float64)
+//     uint32   length of column name
+//     char     column name[length]
+//   zero padding up to a multiple of 8 bytes
+//
+// step block:
+//   int32      time step number
+//   int32      number of items (same as in header)
+//   float64    time
+//   float64    values[number of columns][number of items]
+//
+// Since all blocks of a segment have the same size, the values of column j of step k
+// start at offset header_size + k*block_size + 16 + j*items*8 (relative to the start
+// of the segment), which allows direct access of a single column in a memory-mapped file.
+// A segment ends at the end of the file or where the next header's magic is found.
 class FECORE_API DataRecord : public FECoreBase
 {
 	FECORE_SUPER_CLASS(FEDATARECORD_ID)
@@ -85,6 +115,10 @@ public:
 	void SetFormat(const char* sz);
 	void SetComments(bool b) { m_bcomm = b; }
 
+	// Use the binary file format. Must be called before SetFileName.
+	void SetBinary(bool b) { m_bbinary = b; }
+	bool IsBinary() const { return m_bbinary; }
+
 public:
 	virtual bool Initialize();
 	virtual double Evaluate(int item, int ndata) = 0;
@@ -97,6 +131,9 @@ private:
 	std::string printToString(int i);
 	std::string printToFormatString(int i);
 
+	bool writeBinaryHeader();
+	bool writeBinaryStep(int nstep, double ftime);
+
 public:
 	int					m_nid;		//!< ID of data record
 	std::vector<int>	m_item;		//!< item list
@@ -112,6 +149,11 @@ protected:
 protected:
 	char	m_szfile[MAX_STRING];	//!< file name of data record
 	FILE*		m_fp;
+	bool	m_bbinary;				//!< write binary columnar file
+	bool	m_bheader;				//!< binary header was written
+	std::vector<int>	m_hdrItem;	//!< items of last binary header
+	int		m_hdrCols;				//!< columns of last binary header
+	std::vector<double>	m_buf;		//!< buffer for binary output
 };
 
 //=========================================================================
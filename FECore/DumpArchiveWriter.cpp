@@ -0,0 +1,261 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#include "stdafx.h"
+#include "DumpArchiveWriter.h"
+#include "DumpMemStream.h"
+#include <stdio.h>
+#include <vector>
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+#ifdef WIN32
+#include <windows.h>
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+//-----------------------------------------------------------------------------
+namespace {
+
+	// the name of the n-th archive that is kept. This inserts the index before 
+	// the extension, so that restart tasks still recognize the archive.
+	std::string archiveName(const std::string& fileName, int n)
+	{
+		if (n == 0) return fileName;
+		char szn[16]; snprintf(szn, sizeof(szn), ".%d", n);
+		size_t ext = fileName.rfind('.');
+		size_t sep = fileName.find_last_of("/\\");
+		if ((ext == std::string::npos) || ((sep != std::string::npos) && (ext < sep))) return fileName + szn;
+		return fileName.substr(0, ext) + szn + fileName.substr(ext);
+	}
+
+	// replaces the destination file (atomically where the OS supports it)
+	bool replaceFile(const std::string& src, const std::string& dst)
+	{
+#ifdef WIN32
+		return (MoveFileExA(src.c_str(), dst.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0);
+#else
+		return (rename(src.c_str(), dst.c_str()) == 0);
+#endif
+	}
+
+	// make sure the file's data is on disk before we rename it
+	bool syncFile(FILE* fp)
+	{
+		if (fflush(fp) != 0) return false;
+#ifdef WIN32
+		return (_commit(_fileno(fp)) == 0);
+#else
+		return (fsync(fileno(fp)) == 0);
+#endif
+	}
+
+	bool writeRaw(FILE* fp, const char* buf, size_t size)
+	{
+		return (fwrite(buf, 1, size, fp) == size);
+	}
+
+	// copies a file, going through a temporary file so that the destination is
+	// either the old or the new copy
+	bool copyFile(const std::string& src, const std::string& dst)
+	{
+		FILE* fi = fopen(src.c_str(), "rb");
+		if (fi == nullptr) return false;
+
+		std::string tmpFile = dst + ".tmp";
+		FILE* fo = fopen(tmpFile.c_str(), "wb");
+		if (fo == nullptr) { fclose(fi); return false; }
+
+		std::vector<char> buf(1 << 20);
+		bool bok = true;
+		size_t nread = 0;
+		while (bok && ((nread = fread(&buf[0], 1, buf.size(), fi)) > 0))
+		{
+			bok = writeRaw(fo, &buf[0], nread);
+		}
+		if (ferror(fi)) bok = false;
+		fclose(fi);
+
+		if (bok) bok = syncFile(fo);
+		fclose(fo);
+		if (bok) bok = replaceFile(tmpFile, dst);
+		if (bok == false) remove(tmpFile.c_str());
+		return bok;
+	}
+
+#ifdef HAVE_ZLIB
+	// write the buffer in gzip format
+	bool writeCompressed(FILE* fp, const char* buf, size_t size, int level)
+	{
+		z_stream strm;
+		strm.zalloc = Z_NULL;
+		strm.zfree = Z_NULL;
+		strm.opaque = Z_NULL;
+		// windowBits = 15 + 16 selects the gzip wrapper
+		if (deflateInit2(&strm, level, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) return false;
+
+		const size_t CHUNK = 1 << 20;
+		std::vector<unsigned char> out(CHUNK);
+		const size_t MAX_IN = (1u << 30);
+
+		bool bok = true;
+		size_t pos = 0;
+		int flush = Z_NO_FLUSH;
+		do
+		{
+			size_t nin = size - pos;
+			if (nin > MAX_IN) nin = MAX_IN;
+			strm.next_in = (Bytef*)(buf + pos);
+			strm.avail_in = (uInt)nin;
+			pos += nin;
+			flush = (pos >= size ? Z_FINISH : Z_NO_FLUSH);
+			do
+			{
+				strm.next_out = &out[0];
+				strm.avail_out = (uInt)CHUNK;
+				int ret = deflate(&strm, flush);
+				if (ret == Z_STREAM_ERROR) { bok = false; break; }
+				size_t nout = CHUNK - strm.avail_out;
+				if (fwrite(&out[0], 1, nout, fp) != nout) { bok = false; break; }
+			} 
+			while (strm.avail_out == 0);
+		}
+		while (bok && (flush != Z_FINISH));
+
+		deflateEnd(&strm);
+		return bok;
+	}
+#endif
+}
+
+//-----------------------------------------------------------------------------
+DumpArchiveWriter::DumpArchiveWriter()
+{
+	m_ar = nullptr;
+	m_compression = 0;
+	m_keep = 1;
+	m_bok = true;
+	m_done = false;
+}
+
+//-----------------------------------------------------------------------------
+DumpArchiveWriter::~DumpArchiveWriter()
+{
+	Flush();
+}
+
+//-----------------------------------------------------------------------------
+void DumpArchiveWriter::SetCompression(int level)
+{
+	if (level < 0) level = 0;
+	if (level > 9) level = 9;
+	m_compression = level;
+}
+
+//-----------------------------------------------------------------------------
+void DumpArchiveWriter::SetKeepCount(int n)
+{
+	m_keep = (n < 1 ? 1 : n);
+}
+
+//-----------------------------------------------------------------------------
+void DumpArchiveWriter::Write(const std::string& fileName, DumpMemStream* ar)
+{
+	// we only allow one pending write
+	Flush();
+
+	m_file = fileName;
+	m_ar = ar;
+	m_done = false;
+	m_thread = std::thread(&DumpArchiveWriter::WriteArchive, this);
+}
+
+//-----------------------------------------------------------------------------
+bool DumpArchiveWriter::Flush()
+{
+	if (m_thread.joinable()) m_thread.join();
+
+	// a failure is only reported once
+	bool bok = m_bok;
+	m_bok = true;
+	return bok;
+}
+
+//-----------------------------------------------------------------------------
+// This runs on the background thread.
+void DumpArchiveWriter::WriteArchive()
+{
+	m_bok = WriteFile();
+
+	// release the stream's memory as soon as we're done with it
+	delete m_ar;
+	m_ar = nullptr;
+
+	m_done = true;
+}
+
+//-----------------------------------------------------------------------------
+bool DumpArchiveWriter::WriteFile()
+{
+	// write the archive to a temporary file
+	std::string tmpFile = m_file + ".tmp";
+	FILE* fp = fopen(tmpFile.c_str(), "wb");
+	if (fp == nullptr) return false;
+
+	const char* buf = m_ar->data();
+	size_t size = m_ar->size();
+
+	bool bok = false;
+#ifdef HAVE_ZLIB
+	if (m_compression > 0) bok = writeCompressed(fp, buf, size, m_compression);
+	else
+#endif
+	bok = writeRaw(fp, buf, size);
+
+	if (bok) bok = syncFile(fp);
+	fclose(fp);
+	if (bok == false) { remove(tmpFile.c_str()); return false; }
+
+	// rotate the older archives. The current archive is copied, not renamed, so 
+	// that there is always an archive under the name the restart looks for.
+	if (m_keep > 1)
+	{
+		remove(archiveName(m_file, m_keep - 1).c_str());
+		for (int i = m_keep - 1; i > 1; --i)
+		{
+			std::string src = archiveName(m_file, i - 1);
+			FILE* fi = fopen(src.c_str(), "rb");
+			if (fi) { fclose(fi); replaceFile(src, archiveName(m_file, i)); }
+		}
+		copyFile(m_file, archiveName(m_file, 1));
+	}
+
+	// move the new archive in place
+	return replaceFile(tmpFile, m_file);
+}
@@ -0,0 +1,87 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#pragma once
+#include "fecore_api.h"
+#include <string>
+#include <thread>
+#include <atomic>
+
+class DumpMemStream;
+
+//-----------------------------------------------------------------------------
+//! This class writes restart archives from a memory buffer on a background thread.
+//! The archive is first written to a temporary file, which is then renamed to the
+//! archive name. Therefore, a crash while writing never destroys the previous archive.
+//! Optionally, the archive is compressed (gzip format, which DumpFile reads
+//! transparently) and older archives are kept as <name>.1.dmp, <name>.2.dmp, etc.
+class FECORE_API DumpArchiveWriter
+{
+public:
+	DumpArchiveWriter();
+	~DumpArchiveWriter();
+
+	//! Set the compression level (0 = no compression, 1-9 = zlib levels)
+	//! Compression requires zlib. Otherwise, archives are written uncompressed.
+	void SetCompression(int level);
+	int GetCompression() const { return m_compression; }
+
+	//! Set the number of archives to keep (must be at least one)
+	void SetKeepCount(int n);
+	int GetKeepCount() const { return m_keep; }
+
+	//! Start writing the stream to the file. Waits for a previous write to finish first,
+	//! so call Flush before to get the status of the previous write.
+	//! The writer takes ownership of the stream and deletes it when the write is done.
+	void Write(const std::string& fileName, DumpMemStream* ar);
+
+	//! Wait until the pending write (if any) is finished.
+	//! Returns false if the last write failed. A failure is only reported once.
+	bool Flush();
+
+	//! see if a write was started that was not flushed yet
+	bool IsPending() const { return m_thread.joinable(); }
+
+	//! see if the pending write is finished (so that Flush won't block)
+	bool IsDone() const { return IsPending() && m_done; }
+
+	//! name of the last archive that was attempted
+	const std::string& FileName() const { return m_file; }
+
+private:
+	void WriteArchive();
+	bool WriteFile();
+
+private:
+	std::thread		m_thread;
+	std::string		m_file;
+	DumpMemStream*	m_ar;		//!< the stream that is written
+	int				m_compression;
+	int				m_keep;
+	bool			m_bok;		//!< status of last write
+	std::atomic<bool>	m_done;	//!< set when the background thread is done
+};
@@ -28,10 +28,14 @@ SOFTWARE.*/
 
 #include "stdafx.h"
 #include "DumpFile.h"
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
 
 DumpFile::DumpFile(FEModel& fem) : DumpStream(fem)
 {
 	m_fp = 0;
+	m_gz = 0;
 	m_size = 0;
 }
 
@@ -42,8 +46,16 @@ DumpFile::~DumpFile()
 
 bool DumpFile::Open(const char* szfile)
 {
+#ifdef HAVE_ZLIB
+	// gzread passes uncompressed files through unchanged
+	gzFile gz = gzopen(szfile, "rb");
+	if (gz == 0) return false;
+	gzbuffer(gz, 1 << 20);
+	m_gz = gz;
+#else
 	m_fp = fopen(szfile, "rb");
 	if (m_fp == 0) return false;
+#endif
 
 	DumpStream::Open(false, false);
 
@@ -74,6 +86,10 @@ void DumpFile::Close()
 {
 	if (m_fp) fclose(m_fp); 
 	m_fp = 0;
+#ifdef HAVE_ZLIB
+	if (m_gz) gzclose((gzFile)m_gz);
+#endif
+	m_gz = 0;
 }
 
 //! write buffer to archive
@@ -89,11 +105,32 @@ size_t DumpFile::write(const void* pd, size_t size, size_t count)
 size_t DumpFile::read(void* pd, size_t size, size_t count)
 {
 	assert(IsLoading());
+#ifdef HAVE_ZLIB
+	if (m_gz)
+	{
+		// gzread takes at most an unsigned int, so we read large blocks in chunks
+		char* pc = (char*)pd;
+		size_t nsize = size * count;
+		size_t nread = 0;
+		while (nread < nsize)
+		{
+			size_t n = nsize - nread;
+			if (n > (1u << 30)) n = (1u << 30);
+			int m = gzread((gzFile)m_gz, pc + nread, (unsigned int)n);
+			if (m <= 0) break;
+			nread += (size_t)m;
+		}
+		return (size > 0 ? size * (nread / size) : 0);
+	}
+#endif
 	size_t elemsRead = fread(pd, size, count, m_fp);
 	return size * elemsRead;
 }
 
 bool DumpFile::EndOfStream() const
 {
+#ifdef HAVE_ZLIB
+	if (m_gz) return (gzeof((gzFile)m_gz) != 0);
+#endif
 	return (feof(m_fp) != 0);
 }
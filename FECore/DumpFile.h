@@ -53,6 +53,7 @@ public:
 	virtual ~DumpFile();
 
 	//! Open archive for reading
+	//! When built with zlib, compressed (gzip) archives are read transparently.
 	bool Open(const char* szfile);
 
 	//! Open archive for writing
@@ -65,14 +66,15 @@ public:
 	void Close();
 
 	//! See if the archive is valid
-	bool IsValid() { return (m_fp != 0); }
+	bool IsValid() { return ((m_fp != 0) || (m_gz != 0)); }
 
 	//! Flush the archive
-	void Flush() { fflush(m_fp); }
+	void Flush() { if (m_fp) fflush(m_fp); }
 
 	size_t Size() { return m_size; }
 
 protected:
 	FILE*		m_fp;		//!< The actual file pointer
+	void*		m_gz;		//!< zlib file handle (when reading with zlib)
 	size_t		m_size;
 };
@@ -46,6 +46,7 @@ public: // overloaded from base class
 	void Open(bool bsave, bool bshallow);
 
 	size_t size() const { return m_nsize; }
+	const char* data() const { return m_pb; }
 	size_t reserved() const { return m_nreserved; }
 	bool EndOfStream() const;
 
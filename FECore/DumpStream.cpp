@@ -36,6 +36,7 @@ DumpStream::DumpStream(FEModel& fem) : m_fem(fem)
 	m_bshallow = false;
 	m_bytes_serialized = 0;
 	m_ptr_lock = false;
+	m_version = DUMP_VERSION;
 
 #ifndef NDEBUG
 	m_btypeInfo = false;
@@ -85,6 +86,7 @@ void DumpStream::Open(bool bsave, bool bshallow)
 	m_bshallow = bshallow;
 	m_bytes_serialized = 0;
 	m_ptr_lock = false;
+	m_version = DUMP_VERSION;
 
 	// add the "null" pointer
 	if (bsave)
@@ -67,6 +67,15 @@ enum TypeID
 
 typedef unsigned char uchar;
 
+//-----------------------------------------------------------------------------
+// Versions of the serialized data format. Classes that add data to their serialization
+// should only read it from streams with a version at least as high as the version that
+// introduced it, so that older dump files can still be read.
+#define DUMP_VERSION_BASE		0x06	// oldest version that can be read
+#define DUMP_VERSION_LOGBINARY	0x07	// binary flag of data records
+#define DUMP_VERSION_RVECOMPACT	0x07	// compaction error of reactive viscoelastic points
+#define DUMP_VERSION			DUMP_VERSION_LOGBINARY	// current version
+
 //-----------------------------------------------------------------------------
 //! A dump stream is used to serialize data to and from a data stream.
 //! This is used in FEBio for running and cold restarts. 
@@ -149,6 +158,12 @@ public:
 	// return total nr of bytes that was serialized
 	size_t bytesSerialized() const { return m_bytes_serialized; }
 
+	// set the version of the data format (when loading older files)
+	void SetVersion(int n) { m_version = n; }
+
+	// get the version of the data format
+	int Version() const { return m_version; }
+
 public:
 	// read the next block
 	bool readBlock(DataBlock& d);
@@ -236,6 +251,7 @@ private:
 	FEModel&	m_fem;		//!< the FE Model that is being serialized
 
 	size_t	m_bytes_serialized;	//!< number or bytes serialized
+	int		m_version;			//!< version of the data format
 
 	bool					m_ptr_lock;
 	std::map<void*, int>	m_ptrOut;	// used for writing
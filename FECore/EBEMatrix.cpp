@@ -0,0 +1,256 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#include "stdafx.h"
+#include "EBEMatrix.h"
+#include "FENewtonSolver.h"
+#include "sys.h"
+
+EBEMatrix::EBEMatrix(FENewtonSolver* pns, SparseMatrix* K, bool bsymm) : m_pns(pns), m_K(K), m_bsymm(bsymm)
+{
+	m_nrow = m_ncol = pns->m_neq;
+	m_nsize = 0;
+}
+
+EBEMatrix::~EBEMatrix()
+{
+	delete m_K;
+}
+
+//! set all matrix elements to zero
+void EBEMatrix::Zero()
+{
+	m_D.assign(m_nrow, 0.0);
+	m_fix.assign(m_nrow, 0);
+
+	// Remove the element matrices of the last reformation. Note that the
+	// buffers keep their capacity, so they are not reallocated next time.
+	m_ke.resize(omp_get_max_threads());
+	for (ElementMatrices& e : m_ke)
+	{
+		e.val.clear();
+		e.ind.clear();
+		e.dim.clear();
+	}
+
+	if (m_K) m_K->Zero();
+}
+
+//! Create a sparse matrix from a sparse-matrix profile
+void EBEMatrix::Create(SparseMatrixProfile& MP)
+{
+	m_nrow = MP.Rows();
+	m_ncol = MP.Columns();
+	m_nsize = 0;
+	if (m_K)
+	{
+		m_K->Create(MP);
+		m_nsize = m_K->NonZeroes();
+	}
+	Zero();
+}
+
+//! release memory for storing data
+void EBEMatrix::Clear()
+{
+	if (m_K) m_K->Clear();
+	m_D.clear();
+	m_fix.clear();
+	m_ke.clear();
+}
+
+//! return the element matrix storage of the calling thread
+EBEMatrix::ElementMatrices& EBEMatrix::ThreadStorage()
+{
+	size_t n = (size_t)omp_get_thread_num();
+	assert(n < m_ke.size());
+	return m_ke[n < m_ke.size() ? n : 0];
+}
+
+//! assemble a matrix into the sparse matrix
+void EBEMatrix::Assemble(const matrix& ke, const std::vector<int>& lm)
+{
+	Assemble(ke, lm, lm);
+}
+
+//! assemble a matrix into the sparse matrix
+void EBEMatrix::Assemble(const matrix& ke, const std::vector<int>& lmi, const std::vector<int>& lmj)
+{
+	const int N = ke.rows();
+	const int M = ke.columns();
+
+	// store the rows and columns of the active equations
+	ElementMatrices& e = ThreadStorage();
+	size_t i0 = e.ind.size();
+	for (int i = 0; i < N; ++i) if (lmi[i] >= 0) e.ind.push_back(i);
+	size_t j0 = e.ind.size();
+	for (int j = 0; j < M; ++j) if (lmj[j] >= 0) e.ind.push_back(j);
+	size_t j1 = e.ind.size();
+
+	int nr = (int)(j0 - i0);
+	int nc = (int)(j1 - j0);
+	if ((nr == 0) || (nc == 0)) { e.ind.resize(i0); return; }
+
+	// For symmetric systems, the matrices of the elements (i.e. lmi == lmj) are 
+	// symmetric, so we only store the upper triangle and the row equations. 
+	// This is marked with a negative column count.
+	bool bpacked = m_bsymm && ((&lmi == &lmj) || (lmi == lmj));
+
+	for (size_t i = i0; i < j0; ++i)
+	{
+		const double* kei = ke[e.ind[i]];
+		size_t js = (bpacked ? j0 + (i - i0) : j0);
+		for (size_t j = js; j < j1; ++j) e.val.push_back(kei[e.ind[j]]);
+	}
+
+	// collect the diagonal
+	for (size_t i = i0; i < j0; ++i)
+	{
+		int I = lmi[e.ind[i]];
+		for (size_t j = j0; j < j1; ++j)
+		{
+			if (lmj[e.ind[j]] == I)
+			{
+#pragma omp atomic
+				m_D[I] += ke[e.ind[i]][e.ind[j]];
+			}
+		}
+	}
+
+	// convert local indices to equation numbers
+	for (size_t i = i0; i < j0; ++i) e.ind[i] = lmi[e.ind[i]];
+	for (size_t j = j0; j < j1; ++j) e.ind[j] = lmj[e.ind[j]];
+	if (bpacked) e.ind.resize(j0);
+	e.dim.push_back(nr);
+	e.dim.push_back(bpacked ? -nc : nc);
+
+	if (m_K) m_K->Assemble(ke, lmi, lmj);
+}
+
+//! set entry to value
+void EBEMatrix::set(int i, int j, double v)
+{
+	// Only the diagonal is set explicitly (e.g. for prescribed dofs). These rows do
+	// not receive any other contributions, so we remember them and apply them 
+	// after the element-by-element product.
+	assert(i == j);
+	if (i == j)
+	{
+#pragma omp critical (EBE_set)
+		{
+			m_D[i] = v;
+			m_fix[i] = 1;
+		}
+	}
+	if (m_K) m_K->set(i, j, v);
+}
+
+//! add value to entry
+void EBEMatrix::add(int i, int j, double v)
+{
+	// stored as a 1x1 element matrix
+	ElementMatrices& e = ThreadStorage();
+	e.val.push_back(v);
+	e.ind.push_back(i);
+	e.ind.push_back(j);
+	e.dim.push_back(1);
+	e.dim.push_back(1);
+
+	if (i == j)
+	{
+#pragma omp atomic
+		m_D[i] += v;
+	}
+	if (m_K) m_K->add(i, j, v);
+}
+
+//! multiply with vector by element-by-element evaluation of the tangent
+bool EBEMatrix::mult_vector(double* x, double* r)
+{
+	int neq = Rows();
+	for (int i = 0; i < neq; ++i) r[i] = 0.0;
+
+	// r += ke*x for all element matrices
+	int NT = (int)m_ke.size();
+#pragma omp parallel for
+	for (int n = 0; n < NT; ++n)
+	{
+		const ElementMatrices& e = m_ke[n];
+		const double* ke = e.val.data();
+		const int* lm = e.ind.data();
+		const int NE = (int)e.dim.size() / 2;
+		std::vector<double> y;
+		for (int k = 0; k < NE; ++k)
+		{
+			const int N = e.dim[2*k];
+			const int M = e.dim[2*k + 1];
+			if (M < 0)
+			{
+				// symmetric matrix, stored as upper triangle
+				y.assign(N, 0.0);
+				for (int i = 0; i < N; ++i)
+				{
+					const double xi = x[lm[i]];
+					double yi = ke[0] * xi;
+					for (int j = i + 1; j < N; ++j)
+					{
+						yi += ke[j - i] * x[lm[j]];
+						y[j] += ke[j - i] * xi;
+					}
+					y[i] += yi;
+					ke += N - i;
+				}
+				for (int i = 0; i < N; ++i)
+				{
+#pragma omp atomic
+					r[lm[i]] += y[i];
+				}
+				lm += N;
+				continue;
+			}
+
+			const int* lmi = lm;
+			const int* lmj = lm + N;
+			for (int i = 0; i < N; ++i, ke += M)
+			{
+				double ri = 0.0;
+				for (int j = 0; j < M; ++j) ri += ke[j] * x[lmj[j]];
+#pragma omp atomic
+				r[lmi[i]] += ri;
+			}
+			lm += N + M;
+		}
+	}
+
+	// apply the rows that were set explicitly
+	for (int i = 0; i < neq; ++i)
+	{
+		if (m_fix[i]) r[i] = m_D[i] * x[i];
+	}
+
+	return true;
+}
@@ -0,0 +1,112 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#pragma once
+#include "SparseMatrix.h"
+
+class FENewtonSolver;
+
+//-----------------------------------------------------------------------------
+// This class mimics a sparse matrix, but it never stores the global matrix.
+// Instead, the element matrices that are assembled during a stiffness reformation
+// are stored as they are (without the rows and columns of prescribed dofs), and 
+// the product with a vector is evaluated element-by-element from these matrices.
+// The class also collects the diagonal, which can be used by a diagonal preconditioner.
+// Optionally, the element matrices are also passed on to an assembled matrix that 
+// can be used by a preconditioner. It is only used by the matrix-free strategy.
+// Note that storing the element matrices takes more memory than an assembled sparse 
+// matrix, since the entries of shared nodes are stored once per element (e.g. a hex8
+// matrix is 24x24). For symmetric systems only the upper triangle of the element 
+// matrices is stored, which roughly halves this.
+class FECORE_API EBEMatrix : public SparseMatrix
+{
+	// the element matrices assembled by one thread
+	struct ElementMatrices
+	{
+		std::vector<double>	val;	// matrix values (row-major, or upper triangle if symmetric)
+		std::vector<int>	ind;	// row equations, followed by column equations (if not symmetric)
+		std::vector<int>	dim;	// rows and columns of each matrix (negative columns if symmetric)
+	};
+
+public:
+	EBEMatrix(FENewtonSolver* pns, SparseMatrix* K = 0, bool bsymm = false);
+	~EBEMatrix();
+
+	//! multiply with vector by element-by-element evaluation of the tangent
+	bool mult_vector(double* x, double* r) override;
+
+	//! return the assembled matrix (can be null)
+	SparseMatrix* GetPreconditionerMatrix() { return m_K; }
+
+public:
+	//! set all matrix elements to zero
+	void Zero() override;
+
+	//! Create a sparse matrix from a sparse-matrix profile
+	void Create(SparseMatrixProfile& MP) override;
+
+	//! a profile is only needed by the assembled matrix
+	bool NeedsProfile() const override { return (m_K != nullptr); }
+
+	//! assemble a matrix into the sparse matrix
+	void Assemble(const matrix& ke, const std::vector<int>& lm) override;
+
+	//! assemble a matrix into the sparse matrix
+	void Assemble(const matrix& ke, const std::vector<int>& lmi, const std::vector<int>& lmj) override;
+
+	//! check if an entry was allocated
+	bool check(int i, int j) override { return true; }
+
+	//! set entry to value
+	void set(int i, int j, double v) override;
+
+	//! add value to entry
+	void add(int i, int j, double v) override;
+
+	//! retrieve value (only the diagonal is available)
+	double get(int i, int j) override { return (i == j ? m_D[i] : 0.0); }
+
+	//! get the diagonal value
+	double diag(int i) override { return m_D[i]; }
+
+	//! release memory for storing data
+	void Clear() override;
+
+private:
+	//! return the element matrix storage of the calling thread
+	ElementMatrices& ThreadStorage();
+
+private:
+	FENewtonSolver*		m_pns;
+	SparseMatrix*		m_K;		// assembled matrix for preconditioning (can be null)
+	bool				m_bsymm;	// symmetric system, so only upper triangles are stored
+
+	std::vector<double>	m_D;		// diagonal of the matrix
+	std::vector<char>	m_fix;		// rows that were set explicitly (e.g. prescribed dofs)
+
+	std::vector<ElementMatrices>	m_ke;	// element matrices of last reformation (one list per thread)
+};
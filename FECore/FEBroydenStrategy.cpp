@@ -36,6 +36,7 @@ BEGIN_FECORE_CLASS(FEBroydenStrategy, FENewtonStrategy)
 	ADD_PARAMETER(m_max_buf_size, FE_RANGE_GREATER_OR_EQUAL(0), "max_buffer_size"); 
 	ADD_PARAMETER(m_cycle_buffer, "cycle_buffer");
 	ADD_PARAMETER(m_cmax, FE_RANGE_GREATER_OR_EQUAL(0.0), "cmax");
+	ADD_PARAMETER(m_singlePrecision, "single_precision_ups");
 END_FECORE_CLASS();
 
 //-----------------------------------------------------------------------------
@@ -44,6 +45,7 @@ FEBroydenStrategy::FEBroydenStrategy(FEModel* fem) : FENewtonStrategy(fem)
 {
 	m_neq = 0;
 	m_plinsolve = nullptr;
+	m_singlePrecision = false;
 }
 
 //-----------------------------------------------------------------------------
@@ -57,8 +59,8 @@ bool FEBroydenStrategy::Init()
 	int neq = m_pns->m_neq;
 
 	// allocate storage for Broyden update vectors
-	m_R.resize(m_max_buf_size, neq);
-	m_D.resize(m_max_buf_size, neq);
+	m_RD.Create(m_max_buf_size, neq, m_singlePrecision);
+	m_r.resize(neq);
 	m_rho.resize(m_max_buf_size);
 	m_q.resize(neq, 0.0);
 
@@ -112,24 +114,21 @@ bool FEBroydenStrategy::Update(double s, vector<double>& ui, vector<double>& R0,
 		{
 			int n = (n0 + j) % m_max_buf_size;
 
-			double w = 0.0;
-			for (int i = 0; i<m_neq; ++i) w += (m_D[n][i] * m_q[i]);
-
-			double g = m_rho[n] * w;
-			for (int i = 0; i<m_neq; ++i) m_q[i] += g*(m_D[n][i] - m_R[n][i]);
+			// q += rho*(D.q)*(D - R)
+			m_RD.DotUpdate(n, 1, -m_rho[n], m_rho[n], m_q);
 		}
 
 		// form and store the next update vector
 		double rhoi = 0.0;
-		for (int i = 0; i<m_neq; ++i)
+		int neq = m_neq;
+#pragma omp parallel for reduction(+:rhoi) if (neq > 10000)
+		for (int i = 0; i<neq; ++i)
 		{
-			double ri = m_q[i] - ui[i];
-			double di = -s*ui[i];
-			m_R[n1][i] = ri;
-			m_D[n1][i] = di;
-
-			rhoi += di*ri;
+			m_r[i] = m_q[i] - ui[i];
+			rhoi += -s*ui[i]*m_r[i];
 		}
+		m_RD.SetVector(n1, 0, m_r);
+		m_RD.SetVector(n1, 1, ui, -s);
 		m_rho[n1] = 1.0 / (rhoi);
 	}
 
@@ -174,25 +173,15 @@ void FEBroydenStrategy::SolveEquations(vector<double>& x, vector<double>& b)
 			{
 				int n = (n0 + j) % m_max_buf_size;
 
-				double w = 0.0;
-				for (int i = 0; i<m_neq; ++i) w += (m_D[n][i] * m_q[i]);
-
-				double g = m_rho[n] * w;
-				for (int i = 0; i<m_neq; ++i) m_q[i] += g*(m_D[n][i] - m_R[n][i]);
+				m_RD.DotUpdate(n, 1, -m_rho[n], m_rho[n], m_q);
 			}
 
 			m_bnewStep = false;
 		}
 
 		// calculate solution
-		double rho = 0.0;
-		for (int i = 0; i<m_neq; ++i) rho += m_D[n1][i] * m_q[i];
-		rho *= m_rho[n1];
-
-		for (int i = 0; i<m_neq; ++i)
-		{
-			x[i] = m_q[i] + rho*(m_D[n1][i] - m_R[n1][i]);
-		}
+		x = m_q;
+		m_RD.DotUpdate(n1, 1, -m_rho[n1], m_rho[n1], x);
 	}
 }
 
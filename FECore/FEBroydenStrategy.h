@@ -29,6 +29,7 @@ SOFTWARE.*/
 #pragma once
 #include "matrix.h"
 #include "FENewtonStrategy.h"
+#include "QNUpdateBuffer.h"
 
 //-----------------------------------------------------------------------------
 //! This class implements the Broyden quasi-newton strategy. 
@@ -57,9 +58,10 @@ private:
 
 	bool		m_bnewStep;
 
-	// Broyden update vectors
-	matrix			m_R;		//!< Broyden update vector "r"
-	matrix			m_D;		//!< Broydeb update vector "delta"
+	// Broyden update vectors ("r" stored as vector 0, "delta" as vector 1)
+	QNUpdateBuffer	m_RD;		//!< Broyden update vectors
+	bool			m_singlePrecision;	//!< store update vectors in single precision
+	vector<double>	m_r;		//!< temp storage for r
 	vector<double>	m_rho;		//!< temp vectors for calculating Broyden update vectors
 	vector<double>	m_q;		//!< temp storage for q
 
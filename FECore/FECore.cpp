@@ -50,6 +50,7 @@ SOFTWARE.*/
 #include "BFGSSolver.h"
 #include "FEBroydenStrategy.h"
 #include "JFNKStrategy.h"
+#include "FEMatrixFreeStrategy.h"
 #include "FENodeSet.h"
 #include "FEFacetSet.h"
 #include "FEElementSet.h"
@@ -177,6 +178,7 @@ REGISTER_FECORE_CLASS(FEBroydenStrategy, "Broyden");
 REGISTER_FECORE_CLASS(JFNKStrategy     , "JFNK");
 REGISTER_FECORE_CLASS(FEModifiedNewtonStrategy, "modified Newton");
 REGISTER_FECORE_CLASS(FEFullNewtonStrategy    , "full Newton");
+REGISTER_FECORE_CLASS(FEMatrixFreeStrategy    , "matrix-free");
 
 // preconditioners
 REGISTER_FECORE_CLASS(DiagonalPreconditioner, "diagonal");
@@ -35,7 +35,7 @@ SOFTWARE.*/
 #include "FESurfaceMap.h"
 
 //-----------------------------------------------------------------------------
-FEDataArray::FEDataArray(FEDataMapType mapType, FEDataType dataType) : m_mapType(mapType), m_dataType(dataType), m_dataCount(0)
+FEDataArray::FEDataArray(FEDataMapType mapType, FEDataType dataType) : m_mapType(mapType), m_dataType(dataType), m_dataCount(0), m_revision(0), m_modified(false)
 {
 	m_dataSize = fecore_data_size(dataType);
 }
@@ -46,12 +46,13 @@ FEDataArray::~FEDataArray()
 }
 
 //-----------------------------------------------------------------------------
-FEDataArray::FEDataArray(const FEDataArray& map)
+FEDataArray::FEDataArray(const FEDataArray& map) : m_modified(false)
 {
 	m_dataType = map.m_dataType;
 	m_dataSize = map.m_dataSize;
 	m_dataCount = map.m_dataCount;
 	m_val = map.m_val;
+	m_revision = 0;
 }
 
 //-----------------------------------------------------------------------------
@@ -61,15 +62,24 @@ FEDataArray& FEDataArray::operator = (const FEDataArray& map)
 	m_dataSize = map.m_dataSize;
 	m_dataCount = map.m_dataCount;
 	m_val = map.m_val;
+	m_revision++;
 	return *this;
 }
 
+//-----------------------------------------------------------------------------
+uint64_t FEDataArray::UpdateRevision()
+{
+	if (m_modified.exchange(false)) m_revision++;
+	return m_revision;
+}
+
 //-----------------------------------------------------------------------------
 bool FEDataArray::resize(int n, double val)
 {
 	if (n < 0) return false;
 	m_val.resize(n*DataSize(), val);
 	m_dataCount = n;
+	m_revision++;
 	return true;
 }
 
@@ -79,6 +89,7 @@ bool FEDataArray::realloc(int n)
 	if (n < 0) return false;
 	m_val.resize(n*DataSize());
 	m_dataCount = n;
+	m_revision++;
 	return true;
 }
 
@@ -91,6 +102,7 @@ void FEDataArray::SetDataSize(int dataSize)
 	{
 		m_val.resize(m_dataSize*m_dataCount);
 	}
+	m_revision++;
 }
 
 //-----------------------------------------------------------------------------
@@ -129,6 +141,7 @@ void FEDataArray::Serialize(DumpStream& ar)
 		ar >> m_val;
 
 		m_dataType = intToDataType(ntype);
+		m_revision++;
 		assert(m_val.size() == m_dataSize*m_dataCount);
 	}
 }
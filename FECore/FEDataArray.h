@@ -30,6 +30,8 @@ SOFTWARE.*/
 #include <vector>
 #include <assert.h>
 #include <string>
+#include <atomic>
+#include <stdint.h>
 #include "vec3d.h"
 #include "vec2d.h"
 #include "mat3d.h"
@@ -98,6 +100,16 @@ public:
 	//! return the buffer size (actual number of doubles)
 	int BufferSize() const { return (int) m_val.size(); }
 
+	//! return the data revision. This is incremented by each bulk modification (e.g. resizing or filling).
+	uint64_t Revision() const { return m_revision; }
+
+	//! returns true if values were modified through set(n, v) or push_back since the last call to UpdateRevision.
+	bool IsModified() const { return m_modified.load(std::memory_order_relaxed); }
+
+	//! increment the revision if values were modified since the last call and return the revision.
+	//! This should not be called while other threads are modifying the data.
+	uint64_t UpdateRevision();
+
 public:
 	//! serialization
 	virtual void Serialize(DumpStream& ar);
@@ -117,6 +129,8 @@ private:
 	FEDataType		m_dataType;	//!< the data type
 	int	m_dataSize;				//!< size of each data item
 	int	m_dataCount;			//!< number of data items
+	uint64_t	m_revision;			//!< data revision
+	std::atomic<bool>	m_modified;	//!< values were modified since the last revision update
 
 	std::vector<double>	m_val;	//!< data values
 };
@@ -159,6 +173,7 @@ template <> inline void FEDataArray::push_back<double>(const double& v)
 	assert(m_dataSize == fecoreType<double>::size());
 	m_val.push_back(v);
 	m_dataCount++;
+	m_modified.store(true, std::memory_order_relaxed);
 }
 
 template <> inline void FEDataArray::push_back<vec2d>(const vec2d& v)
@@ -167,6 +182,7 @@ template <> inline void FEDataArray::push_back<vec2d>(const vec2d& v)
 	m_val.push_back(v.x());
 	m_val.push_back(v.y());
 	m_dataCount++;
+	m_modified.store(true, std::memory_order_relaxed);
 }
 
 template <> inline void FEDataArray::push_back<vec3d>(const vec3d& v)
@@ -176,6 +192,7 @@ template <> inline void FEDataArray::push_back<vec3d>(const vec3d& v)
 	m_val.push_back(v.y);
 	m_val.push_back(v.z);
 	m_dataCount++;
+	m_modified.store(true, std::memory_order_relaxed);
 }
 
 template <> inline void FEDataArray::push_back<mat3d>(const mat3d& v)
@@ -185,6 +202,7 @@ template <> inline void FEDataArray::push_back<mat3d>(const mat3d& v)
 	m_val.push_back(v[1][0]); m_val.push_back(v[1][1]); m_val.push_back(v[1][2]);
 	m_val.push_back(v[2][0]); m_val.push_back(v[2][1]); m_val.push_back(v[2][2]);
 	m_dataCount++;
+	m_modified.store(true, std::memory_order_relaxed);
 }
 
 template <> inline void FEDataArray::push_back<mat3ds>(const mat3ds& v)
@@ -197,6 +215,7 @@ template <> inline void FEDataArray::push_back<mat3ds>(const mat3ds& v)
 	m_val.push_back(v.yz());
 	m_val.push_back(v.xz());
 	m_dataCount++;
+	m_modified.store(true, std::memory_order_relaxed);
 }
 
 //-----------------------------------------------------------------------------
@@ -204,6 +223,7 @@ template <> inline bool FEDataArray::set<double>(int n, const double& v)
 {
 	assert(m_dataSize == fecoreType<double>::size());
 	m_val[n] = v;
+	m_modified.store(true, std::memory_order_relaxed);
 	return true;
 }
 
@@ -213,6 +233,7 @@ template <> inline bool FEDataArray::set<vec2d>(int n, const vec2d& v)
 	assert(m_dataSize == fecoreType<vec2d>::size());
 	m_val[2 * n] = v.x();
 	m_val[2 * n + 1] = v.y();
+	m_modified.store(true, std::memory_order_relaxed);
 	return true;
 }
 
@@ -223,6 +244,7 @@ template <> inline bool FEDataArray::set<vec3d>(int n, const vec3d& v)
 	m_val[3 * n] = v.x;
 	m_val[3 * n + 1] = v.y;
 	m_val[3 * n + 2] = v.z;
+	m_modified.store(true, std::memory_order_relaxed);
 	return true;
 }
 
@@ -234,6 +256,7 @@ template <> inline bool FEDataArray::set<mat3d>(int n, const mat3d& v)
 	d[0] = v[0][0]; d[1] = v[0][1]; d[2] = v[0][2];
 	d[3] = v[1][0]; d[4] = v[1][1]; d[5] = v[1][2];
 	d[6] = v[2][0]; d[7] = v[2][1]; d[8] = v[2][2];
+	m_modified.store(true, std::memory_order_relaxed);
 	return true;
 }
 
@@ -248,6 +271,7 @@ template <> inline bool FEDataArray::set<mat3ds>(int n, const mat3ds& v)
 	d[3] = v.xy();
 	d[4] = v.yz();
 	d[5] = v.xz();
+	m_modified.store(true, std::memory_order_relaxed);
 	return true;
 }
 
@@ -256,6 +280,7 @@ template <> inline bool FEDataArray::set<double>(const double& v)
 {
 	assert(m_dataSize == fecoreType<double>::size());
 	for (int i = 0; i<(int)m_val.size(); ++i) m_val[i] = v;
+	m_revision++;
 	return true;
 }
 
@@ -268,6 +293,7 @@ template <> inline bool FEDataArray::set<vec2d>(const vec2d& v)
 		m_val[i] = v.x();
 		m_val[i + 1] = v.y();
 	}
+	m_revision++;
 	return true;
 }
 
@@ -281,6 +307,7 @@ template <> inline bool FEDataArray::set<vec3d>(const vec3d& v)
 		m_val[i + 1] = v.y;
 		m_val[i + 2] = v.z;
 	}
+	m_revision++;
 	return true;
 }
 
@@ -295,6 +322,7 @@ template <> inline bool FEDataArray::set<mat3d>(const mat3d& v)
 		d[3] = v[1][0]; d[4] = v[1][1]; d[5] = v[1][2];
 		d[6] = v[2][0]; d[7] = v[2][1]; d[8] = v[2][2];
 	}
+	m_revision++;
 	return true;
 }
 
@@ -312,5 +340,6 @@ template <> inline bool FEDataArray::set<mat3ds>(const mat3ds& v)
 		d[4] = v.yz();
 		d[5] = v.xz();
 	}
+	m_revision++;
 	return true;
 }
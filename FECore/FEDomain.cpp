@@ -192,6 +192,19 @@ void FEDomain::BuildMatrixProfile(FEGlobalMatrix& M)
 	}
 }
 
+//-----------------------------------------------------------------------------
+bool FEDomain::UpdateMatrixProfile(FEGlobalMatrix& M, const std::vector<int>& elemList)
+{
+	vector<int> elm;
+	for (int i : elemList)
+	{
+		FEElement& el = ElementRef(i);
+		UnpackLM(el, elm);
+		M.build_add(elm);
+	}
+	return true;
+}
+
 //-----------------------------------------------------------------------------
 void FEDomain::Activate(const FEDofList& dof)
 {
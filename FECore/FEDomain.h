@@ -75,6 +75,11 @@ public:
 	//! build the matrix profile
 	virtual void BuildMatrixProfile(FEGlobalMatrix& M);
 
+	//! Add only the listed elements to the matrix profile. This is used to update the
+	//! profile after the mesh was modified. Domains that add more than their elements to
+	//! the profile return false, and must then be added with BuildMatrixProfile.
+	virtual bool UpdateMatrixProfile(FEGlobalMatrix& M, const std::vector<int>& elemList);
+
 	//! Activate the domain
 	virtual void Activate();
 
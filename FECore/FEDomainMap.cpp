@@ -34,6 +34,8 @@ SOFTWARE.*/
 FEDomainMap::FEDomainMap() : FEDataMap(FE_DOMAIN_MAP)
 {
 	m_maxElemNodes = 0;
+	m_ipRev = 0;
+	m_ipValid = false;
 }
 
 //-----------------------------------------------------------------------------
@@ -41,6 +43,8 @@ FEDomainMap::FEDomainMap(FEDataType dataType, Storage_Fmt format) : FEDataMap(FE
 {
 	m_fmt = format;
 	m_maxElemNodes = 0;
+	m_ipRev = 0;
+	m_ipValid = false;
 }
 
 //-----------------------------------------------------------------------------
@@ -48,6 +52,8 @@ FEDomainMap::FEDomainMap(const FEDomainMap& map) : FEDataMap(map)
 {
 	m_name = map.m_name;
 	m_maxElemNodes = map.m_maxElemNodes;
+	m_ipRev = 0;
+	m_ipValid = false;
 }
 
 //-----------------------------------------------------------------------------
@@ -56,6 +62,8 @@ FEDomainMap& FEDomainMap::operator = (const FEDomainMap& map)
 	FEDataArray::operator=(map);
 	m_name = map.m_name;
 	m_maxElemNodes = map.m_maxElemNodes;
+	m_ipRev = 0;
+	m_ipValid = false;
 	return *this;
 }
 
@@ -260,6 +268,83 @@ void FEDomainMap::Serialize(DumpStream& ar)
 	ar & m_imin;
 }
 
+//-----------------------------------------------------------------------------
+void FEDomainMap::UpdateIntegrationPointCache()
+{
+	uint64_t rev = UpdateRevision();
+	if (m_ipValid && (m_ipRev == rev)) return;
+
+	m_ipValid = false;
+	m_ipVal.clear();
+	m_ipOff.clear();
+	if (m_elset == nullptr) return;
+
+	// Only the formats that are interpolated from nodal values benefit from this.
+	if ((m_fmt != FMT_MULT) && (m_fmt != FMT_NODE)) return;
+
+	FEDataType dataType = DataType();
+	if ((dataType != FE_DOUBLE) && (dataType != FE_VEC3D) && (dataType != FE_MAT3DS)) return;
+	int dataSize = DataSize();
+
+	int NE = m_elset->Elements();
+	m_ipOff.resize(NE + 1);
+	m_ipOff[0] = 0;
+	for (int i = 0; i < NE; ++i)
+	{
+		const FEElement& el = m_elset->Element(i);
+		m_ipOff[i + 1] = m_ipOff[i] + el.GaussPoints();
+	}
+	m_ipVal.resize(m_ipOff[NE] * dataSize);
+
+	// evaluate the map at all integration points
+	// (the cache is still disabled, so this evaluates the map data)
+#pragma omp parallel for
+	for (int i = 0; i < NE; ++i)
+	{
+		FEElement& el = m_elset->Element(i);
+		FEMaterialPoint mp;
+		mp.m_elem = &el;
+		int nint = el.GaussPoints();
+		for (int n = 0; n < nint; ++n)
+		{
+			mp.m_index = n;
+			double* v = &m_ipVal[(m_ipOff[i] + n)*dataSize];
+			switch (dataType)
+			{
+			case FE_DOUBLE: v[0] = value(mp); break;
+			case FE_VEC3D:
+			{
+				vec3d r = valueVec3d(mp);
+				v[0] = r.x; v[1] = r.y; v[2] = r.z;
+			}
+			break;
+			case FE_MAT3DS:
+			{
+				mat3ds Q = valueMat3ds(mp);
+				v[0] = Q.xx(); v[1] = Q.yy(); v[2] = Q.zz();
+				v[3] = Q.xy(); v[4] = Q.yz(); v[5] = Q.xz();
+			}
+			break;
+			default:
+				break;
+			}
+		}
+	}
+
+	m_ipRev = rev;
+	m_ipValid = true;
+}
+
+//-----------------------------------------------------------------------------
+const double* FEDomainMap::cachedValue(int lid, int n) const
+{
+	if (!m_ipValid || IsModified() || (m_ipRev != Revision())) return nullptr;
+	if ((lid < 0) || (lid + 1 >= (int)m_ipOff.size())) return nullptr;
+	int m = m_ipOff[lid] + n;
+	if ((n < 0) || (m >= m_ipOff[lid + 1])) return nullptr;
+	return &m_ipVal[m*DataSize()];
+}
+
 //-----------------------------------------------------------------------------
 //! get the value at a material point
 double FEDomainMap::value(const FEMaterialPoint& pt)
@@ -273,6 +358,10 @@ double FEDomainMap::value(const FEMaterialPoint& pt)
 	int lid = m_elset->GetLocalIndex(*pe);
 	assert((lid >= 0));
 
+	// use the integration point value, if available
+	const double* pv = cachedValue(lid, pt.m_index);
+	if (pv) return pv[0];
+
 	double v = 0.0;
 	if (m_fmt == FMT_MULT)
 	{
@@ -326,6 +415,9 @@ vec3d FEDomainMap::valueVec3d(const FEMaterialPoint& pt)
 	int lid = m_elset->GetLocalIndex(*pe);
 	assert((lid >= 0));
 
+	const double* pv = cachedValue(lid, pt.m_index);
+	if (pv) return vec3d(pv[0], pv[1], pv[2]);
+
 	vec3d v(0, 0, 0);
 	if (m_fmt == FMT_MULT)
 	{
@@ -388,6 +480,9 @@ mat3ds FEDomainMap::valueMat3ds(const FEMaterialPoint& pt)
 	int lid = m_elset->GetLocalIndex(*pe);
 	assert((lid >= 0));
 
+	const double* pv = cachedValue(lid, pt.m_index);
+	if (pv) return mat3ds(pv[0], pv[1], pv[2], pv[3], pv[4], pv[5]);
+
 	mat3ds Q;
 	if (m_fmt == FMT_ITEM)
 	{
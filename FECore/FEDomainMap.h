@@ -75,6 +75,11 @@ public:
 	// merge with another map
 	bool Merge(FEDomainMap& map);
 
+	//! Evaluate the map at all integration points of the element set and store
+	//! the results, so that the value functions no longer have to interpolate.
+	//! The stored values are only used as long as the map data is not modified.
+	void UpdateIntegrationPointCache();
+
 public:
 	template <typename T> T value(int nelem, int node)
 	{
@@ -101,6 +106,9 @@ public:
 private:
 	void Realloc(int newElemSize, int newMaxElemNodes);
 
+	// returns a pointer to the cached value of the integration point, or nullptr
+	const double* cachedValue(int lid, int n) const;
+
 private:
 	int					m_fmt;				//!< storage format
 	int					m_maxElemNodes;		//!< max number of nodes for each element
@@ -108,4 +116,9 @@ private:
 
 	vector<int>		m_NLT;		//!< node index lookup table for FMT_NODE
 	int				m_imin;		//!< min index for lookup for FMT_NODE
+
+	vector<double>	m_ipVal;	//!< values at integration points
+	vector<int>		m_ipOff;	//!< offset in m_ipVal of each element's first integration point
+	uint64_t		m_ipRev;	//!< data revision of integration point values
+	bool			m_ipValid;	//!< are the integration point values valid
 };
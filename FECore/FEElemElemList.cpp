@@ -32,6 +32,7 @@ SOFTWARE.*/
 #include "FESolidDomain.h"
 #include "FESurface.h"
 #include "FEMesh.h"
+#include <algorithm>
 
 //-----------------------------------------------------------------------------
 FEElemElemList::FEElemElemList(void)
@@ -184,6 +185,38 @@ bool FEElemElemList::Create(FEMesh* pmesh)
 	return true;
 }
 
+//-----------------------------------------------------------------------------
+int FEElemElemList::Neighbors(int n) const
+{
+	int n1 = (n + 1 < (int)m_ref.size() ? m_ref[n + 1] : (int)m_pel.size());
+	return n1 - m_ref[n];
+}
+
+//-----------------------------------------------------------------------------
+void FEElemElemList::GetNeighborhood(FEElement* pe, int rings, std::vector<FEElement*>& list)
+{
+	list.clear();
+	if (pe == nullptr) return;
+	list.push_back(pe);
+
+	size_t first = 0;
+	for (int k = 0; k < rings; ++k)
+	{
+		size_t last = list.size();
+		for (size_t i = first; i < last; ++i)
+		{
+			int n = list[i]->GetLocalID();
+			int nn = Neighbors(n);
+			for (int j = 0; j < nn; ++j)
+			{
+				FEElement* pj = Neighbor(n, j);
+				if (pj && (std::find(list.begin(), list.end(), pj) == list.end())) list.push_back(pj);
+			}
+		}
+		first = last;
+	}
+}
+
 //-----------------------------------------------------------------------------
 //! Find the element neighbors for a surface. In this case, the elements are
 //! surface elements (i.e. FESurfaceElement).
@@ -66,6 +66,16 @@ public:
 	//! Return the size of the neighbor vector
 	int NeighborSize() { return (int)(m_pel.size()/m_ref.size()); }
 
+	//! Collect the element pe and all elements that can be reached from it by crossing
+	//! at most the given number of element edges. The element pe is always the first
+	//! entry. This requires that the local ID of an element is its index in the list, 
+	//! which is the case for lists created for a surface.
+	void GetNeighborhood(FEElement* pe, int rings, std::vector<FEElement*>& list);
+
+protected:
+	//! number of neighbors of element n
+	int Neighbors(int n) const;
+
 protected:
 	//! Initialization
 	void Init();
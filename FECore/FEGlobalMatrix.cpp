@@ -138,24 +138,29 @@ void FEGlobalMatrix::build_add(vector<int>& lm)
 	}
 }
 
+//-----------------------------------------------------------------------------
+//! Add the entries of another matrix profile, for instance the profile of the
+//! matrix before the equations were renumbered. The eqMap array stores for each
+//! equation of mp the new equation number, or -1 if the equation was removed.
+void FEGlobalMatrix::build_merge(const SparseMatrixProfile& mp, const std::vector<int>& eqMap)
+{
+	m_pMP->Merge(mp, eqMap);
+}
+
 //-----------------------------------------------------------------------------
 //! Flush the LM array. The LM array stores a buffer of elements that have to be
 //! added to the profile. When this buffer is full it needs to be flushed. This
 //! flushin operation causes the actual update of the matrix profile.
 void FEGlobalMatrix::build_flush()
 {
-	int i, j, n, *lm;
-
 	// Since prescribed dofs have an equation number of < -1 we need to modify that
 	// otherwise no storage will be allocated for these dofs (even not diagonal elements!).
-	for (i=0; i<m_nlm; ++i)
+#pragma omp parallel for
+	for (int i=0; i<m_nlm; ++i)
 	{
-		n = (int)m_LM[i].size();
-		if (n > 0)
-		{
-			lm = &(m_LM[i])[0];
-			for (j=0; j<n; ++j) if (lm[j] < -1) lm[j] = -lm[j]-2;
-		}
+		vector<int>& lm = m_LM[i];
+		int n = (int)lm.size();
+		for (int j=0; j<n; ++j) if (lm[j] < -1) lm[j] = -lm[j]-2;
 	}
 
 	m_pMP->UpdateProfile(m_LM, m_nlm);
@@ -182,6 +187,15 @@ bool FEGlobalMatrix::Create(FEModel* pfem, int neq, bool breset)
 	// reconstructing it every time we come here saves us a lot of time. The 
 	// static profile is stored in the variable m_MPs.
 
+	// Matrices that don't use the profile are created from a diagonal profile, so we
+	// don't need to build the full profile.
+	if (m_pA->NeedsProfile() == false)
+	{
+		build_begin(neq);
+		m_pA->Create(*m_pMP);
+		return true;
+	}
+
 	// begin building the profile
 	build_begin(neq);
 	{
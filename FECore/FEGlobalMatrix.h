@@ -153,9 +153,13 @@ public:
 	//! get the sparse matrix profile
 	SparseMatrixProfile* GetSparseMatrixProfile() { return m_pMP; }
 
+	//! get the "static" part of the matrix profile
+	const SparseMatrixProfile& GetStaticProfile() const { return m_MPs; }
+
 public:
 	void build_begin(int neq);
 	void build_add(std::vector<int>& lm);
+	void build_merge(const SparseMatrixProfile& mp, const std::vector<int>& eqMap);
 	void build_end();
 	void build_flush();
 
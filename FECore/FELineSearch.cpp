@@ -38,6 +38,8 @@ FELineSearch::FELineSearch(FENewtonSolver* pns) : m_pns(pns)
 	m_LSmin = 0.01;
 	m_LStol = 0.9;
 	m_LSiter = 5;
+	m_LSreuse = false;
+	m_slast = 0.0;
 }
 
 // serialization
@@ -47,6 +49,61 @@ void FELineSearch::Serialize(DumpStream& ar)
 	ar & m_LSmin & m_LStol & m_LSiter;
 }
 
+//! update the model to the step s and evaluate the residual
+void FELineSearch::Evaluate(vector<double>& ul, double s)
+{
+	vcopys(ul, m_pns->m_ui, s);
+	m_pns->Update(ul);
+	m_pns->m_qnstrategy->Residual(m_pns->m_R1, false);
+	m_slast = s;
+}
+
+//! Estimate the next line search step from the initial energy r0 and the last two
+//! trials (s1, r1) and (s2, r2). The energy is approximated by a quadratic
+//! through these three points, and its smallest positive root is returned. Unlike
+//! the Bonet & Wood estimate, this does not assume that the initial slope of the
+//! energy is -r0, which is only true for a full Newton step. 
+//! The step is limited to [0.1, 2] times the last trial, since the fit cannot be
+//! trusted far away from the trials.
+//! Returns a negative value if no suitable root is found.
+double FELineSearch::QuadraticStep(double r0, double s1, double r1, double s2, double r2)
+{
+	// r(s) = r0 + b*s + c*s^2
+	double det = s1*s2*(s2 - s1);
+	if (fabs(det) < 1e-12) return -1.0;
+
+	double g1 = r1 - r0;
+	double g2 = r2 - r0;
+	double b = (g1*s2*s2 - g2*s1*s1) / det;
+	double c = (g2*s1 - g1*s2) / det;
+
+	double s = -1.0;
+	if (fabs(c) < 1e-12*fabs(b))
+	{
+		// (nearly) linear
+		if (b != 0.0) s = -r0 / b;
+	}
+	else
+	{
+		double D = b*b - 4.0*c*r0;
+		if (D >= 0.0)
+		{
+			double q = -0.5*(b + (b < 0 ? -sqrt(D) : sqrt(D)));
+			double t1 = q / c;
+			double t2 = (q != 0.0 ? r0 / q : -1.0);
+			if (t1 > t2) { double t = t1; t1 = t2; t2 = t; }
+			s = (t1 > 0.0 ? t1 : t2);
+		}
+	}
+
+	if (s > 0.0)
+	{
+		if (s < 0.1*s2) s = 0.1*s2;
+		if (s > 2.0*s2) s = 2.0*s2;
+	}
+	return s;
+}
+
 //! Performs a linesearch on a NR iteration
 //! The description of this method can be found in:
 //!    "Nonlinear Continuum Mechanics for Finite Element Analysis", 	Bonet & Wood.
@@ -63,6 +120,9 @@ double FELineSearch::DoLineSearch(double s)
 	double a, A, B, D;
 	double r0, r1, r;
 
+	// previous trial (only used when reusing trials)
+	double sprev = 0.0, rprev = 0.0;
+
 	// max nr of line search iterations
 	int nmax = m_LSiter;
 	int n = 0;
@@ -71,26 +131,19 @@ double FELineSearch::DoLineSearch(double s)
 	vector<double>& ui = m_pns->m_ui;
 	vector<double>& R0 = m_pns->m_R0;
 	vector<double>& R1 = m_pns->m_R1;
+	m_slast = -1.0;
 
 	// initial energy
 	r0 = ui*R0;
 
 	double rmin = fabs(r0);
 
-	FENewtonStrategy* ns = m_pns->m_qnstrategy;
-
 	// ul = ls*ui
 	vector<double> ul(ui.size());
 	do
 	{
-		// Update geometry
-		vcopys(ul, ui, s);
-		m_pns->Update(ul);
-
-		// calculate residual at this point
-		ns->Residual(R1, false);
-
 		// make sure we are still in a valid range
+		// (There is no need to evaluate the model at this step first.)
 		if (s < m_LSmin)
 		{
 			// it appears that we are not converging
@@ -99,17 +152,17 @@ double FELineSearch::DoLineSearch(double s)
 			// so let's try it here too
 			s = 0.5;
 
-			// reupdate  
-			vcopys(ul, ui, s);
-			m_pns->Update(ul);
-
-			// recalculate residual at this point
-			ns->Residual(R1, false);
+			// update and calculate residual at this point
+			// (unless we already are there)
+			if (s != m_slast) Evaluate(ul, s);
 
 			// return and hope for the best
 			break;
 		}
 
+		// Update geometry and calculate residual at this point
+		Evaluate(ul, s);
+
 		// calculate energies
 		r1 = ui*R1;
 
@@ -126,23 +179,33 @@ double FELineSearch::DoLineSearch(double s)
 
 		if (r > m_LStol)
 		{
-			// calculate the line search step
-			a = r0 / r1;
+			// try to estimate the step from the previous trials
+			double snew = -1.0;
+			if (m_LSreuse && (n > 0)) snew = QuadraticStep(r0, sprev, rprev, s, r1);
+			sprev = s;
+			rprev = r1;
 
-			A = 1 + a*(s - 1);
-			B = a*(s*s);
-			D = B*B - 4 * A*B;
-
-			// update the line step
-			if (D >= 0)
-			{
-				s = (B + sqrt(D)) / (2 * A);
-				if (s < 0) s = (B - sqrt(D)) / (2 * A);
-				if (s < 0) s = 0;
-			}
+			if (snew > 0.0) s = snew;
 			else
 			{
-				s = 0.5*B / A;
+				// calculate the line search step
+				a = r0 / r1;
+
+				A = 1 + a*(s - 1);
+				B = a*(s*s);
+				D = B*B - 4 * A*B;
+
+				// update the line step
+				if (D >= 0)
+				{
+					s = (B + sqrt(D)) / (2 * A);
+					if (s < 0) s = (B - sqrt(D)) / (2 * A);
+					if (s < 0) s = 0;
+				}
+				else
+				{
+					s = 0.5*B / A;
+				}
 			}
 
 			++n;
@@ -153,10 +216,9 @@ double FELineSearch::DoLineSearch(double s)
 	{
 		// max nr of iterations reached.
 		// we choose the line step that reached the smallest energy
+		// (The model only needs to be reevaluated if this was not the last trial.)
 		s = smin;
-		vcopys(ul, ui, s);
-		m_pns->Update(ul);
-		ns->Residual(R1, false);
+		if (s != m_slast) Evaluate(ul, s);
 	}
 	return s;
 }
@@ -27,6 +27,7 @@ SOFTWARE.*/
 
 
 #pragma once
+#include <vector>
 
 class FENewtonSolver;
 class DumpStream;
@@ -47,7 +48,16 @@ public:
 	double	m_LSmin;		//!< minimum line search step
 	double	m_LStol;		//!< line search tolerance
 	int		m_LSiter;		//!< max nr of line search iterations
+	bool	m_LSreuse;		//!< reuse previous trial residuals to estimate the next step
+
+private:
+	// estimate the next step from the initial energy and the last two trials
+	double QuadraticStep(double r0, double s1, double r1, double s2, double r2);
+
+	// update the model to the step s and evaluate the residual
+	void Evaluate(std::vector<double>& ul, double s);
 
 private:
 	FENewtonSolver*	m_pns;
+	double			m_slast;	//!< step at which the model was last evaluated
 };
@@ -56,6 +56,9 @@ FELinearSolver::FELinearSolver(FEModel* pfem) : FESolver(pfem)
 //-----------------------------------------------------------------------------
 void FELinearSolver::Clean()
 {
+	// keep the static profile if the mesh was modified, so it can be updated
+	if (m_pK && m_meshUpdate.pending && (m_meshUpdate.elemOrigin.empty() == false)) m_meshUpdate.profile = m_pK->GetStaticProfile();
+
 	if (m_pls) m_pls->Destroy();
 }
 
@@ -30,6 +30,7 @@ SOFTWARE.*/
 #include "FELinearSystem.h"
 #include "FELinearConstraintManager.h"
 #include "FEModel.h"
+#include "FEProfiler.h"
 
 //-----------------------------------------------------------------------------
 FELinearSystem::FELinearSystem(FESolver* solver, FEGlobalMatrix& K, vector<double>& F, vector<double>& u, bool bsymm) : m_K(K), m_F(F), m_u(u), m_solver(solver)
@@ -65,6 +66,7 @@ void FELinearSystem::Assemble(const FEElementMatrix& ke)
 
 	// assemble into the global stiffness
 	m_K.Assemble(ke);
+	PROFILE_COUNT(AssembledEntries, (long long)ke.rows()*ke.columns());
 
 	// check the prescribed contributions
 	SparseMatrix& K = m_K;
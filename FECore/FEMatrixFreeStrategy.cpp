@@ -0,0 +1,122 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#include "stdafx.h"
+#include "FEMatrixFreeStrategy.h"
+#include "FENewtonSolver.h"
+#include "EBEMatrix.h"
+#include "Preconditioner.h"
+#include "FEException.h"
+#include "LinearSolver.h"
+#include "log.h"
+
+BEGIN_FECORE_CLASS(FEMatrixFreeStrategy, FENewtonStrategy)
+	ADD_PARAMETER(m_maxups, FE_RANGE_GREATER_OR_EQUAL(0), "max_ups");
+END_FECORE_CLASS();
+
+FEMatrixFreeStrategy::FEMatrixFreeStrategy(FEModel* fem) : FENewtonStrategy(fem)
+{
+	m_plinsolve = nullptr;
+	m_A = nullptr;
+	m_maxups = 0;
+}
+
+//! New initialization method
+bool FEMatrixFreeStrategy::Init()
+{
+	if (m_pns == nullptr) return false;
+	m_plinsolve = m_pns->GetLinearSolver();
+	return true;
+}
+
+SparseMatrix* FEMatrixFreeStrategy::CreateSparseMatrix(Matrix_Type mtype)
+{
+	// Note that the previous matrix is owned (and deleted) by the solver's global matrix.
+	m_A = nullptr;
+
+	// this strategy only works with iterative linear solvers
+	IterativeLinearSolver* ls = dynamic_cast<IterativeLinearSolver*>(m_pns->m_plinsolve);
+	if (ls == nullptr)
+	{
+		feLogError("The matrix-free strategy requires an iterative linear solver.");
+		return nullptr;
+	}
+
+	// Diagonal preconditioners only need the diagonal, which is collected element-by-element.
+	// All other preconditioners need an assembled matrix.
+	LinearSolver* PL = ls->GetLeftPreconditioner();
+	LinearSolver* PR = ls->GetRightPreconditioner();
+	bool bassemble = ((PL && (dynamic_cast<DiagonalPreconditioner*>(PL) == nullptr)) ||
+		              (PR && (dynamic_cast<DiagonalPreconditioner*>(PR) == nullptr)));
+
+	SparseMatrix* K = nullptr;
+	if (bassemble)
+	{
+		K = ls->CreateSparseMatrix(mtype);
+		if (K == nullptr) return nullptr;
+	}
+
+	// override the matrix used by the linear solver
+	// (for symmetric systems, only the upper triangle of the element matrices is stored)
+	m_A = new EBEMatrix(m_pns, K, (mtype == REAL_SYMMETRIC));
+	ls->SetSparseMatrix(m_A);
+
+	// set the preconditioner's matrix
+	SparseMatrix* P = (K ? K : m_A);
+	if (PL) PL->SetSparseMatrix(P);
+	if (PR) PR->SetSparseMatrix(P);
+
+	return m_A;
+}
+
+//! perform a Newton udpate
+bool FEMatrixFreeStrategy::Update(double s, vector<double>& ui, vector<double>& R0, vector<double>& R1)
+{
+	// for full-Newton, the element matrices are evaluated at every iteration
+	if (m_maxups == 0) return false;
+
+	// Otherwise, the element matrices (and the preconditioner) of the last
+	// reformation are reused, as in a modified Newton method.
+	if (m_nups >= m_maxups - 1)
+	{
+		feLogWarning("Max nr of iterations reached.\nStiffness matrix will now be reformed.");
+		return false;
+	}
+
+	m_nups++;
+
+	return true;
+}
+
+//! solve the equations
+void FEMatrixFreeStrategy::SolveEquations(vector<double>& x, vector<double>& b)
+{
+	if (m_plinsolve->BackSolve(x, b) == false)
+	{
+		throw LinearSolverFailed();
+	}
+}
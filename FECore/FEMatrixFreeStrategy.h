@@ -0,0 +1,72 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#pragma once
+#include "FENewtonStrategy.h"
+#include "SparseMatrix.h"
+
+class EBEMatrix;
+
+//-----------------------------------------------------------------------------
+// Implements a matrix-free Newton-Krylov strategy. Unlike the JFNK strategy, the
+// product of the tangent with a vector is not approximated by differencing the
+// residual, but evaluated exactly by applying the element stiffness matrices of 
+// the last reformation one element at a time (see EBEMatrix). The global stiffness
+// matrix is never stored. This requires an iterative linear solver. If the solver
+// uses a diagonal preconditioner, it is built from the diagonal that is collected
+// during the reformation, and no matrix profile is built. Other preconditioners
+// require an assembled matrix. By default, the element matrices are reformed at 
+// every iteration (full Newton). With max_ups > 0 they are reused for up to max_ups
+// iterations (modified Newton).
+// Note that the element matrices of the last reformation are kept in memory, which
+// takes more memory than an assembled sparse matrix (for symmetric systems only the
+// upper triangles are stored, which halves this). In return, no matrix profile is built.
+class FECORE_API FEMatrixFreeStrategy : public FENewtonStrategy
+{
+public:
+	FEMatrixFreeStrategy(FEModel* fem);
+
+	//! New initialization method
+	bool Init() override;
+
+	//! initialize the linear system
+	SparseMatrix* CreateSparseMatrix(Matrix_Type mtype) override;
+
+	//! perform a Newton udpate
+	bool Update(double s, vector<double>& ui, vector<double>& R0, vector<double>& R1) override;
+
+	//! solve the equations
+	void SolveEquations(vector<double>& x, vector<double>& b) override;
+
+public:
+	// keep a pointer to the linear solver
+	LinearSolver*	m_plinsolve;	//!< pointer to linear solver
+
+	EBEMatrix*		m_A;
+
+	DECLARE_FECORE_CLASS();
+};
@@ -28,6 +28,7 @@ SOFTWARE.*/
 
 #include "stdafx.h"
 #include "FEMesh.h"
+#include "FEProfiler.h"
 #include "FEException.h"
 #include "FEDiscreteDomain.h"
 #include "FETrussDomain.h"
@@ -1041,7 +1042,7 @@ void FEMesh::Update(const FETimeInfo& tp)
 	for (int i = 0; i<Domains(); ++i)
 	{
 		FEDomain& dom = Domain(i);
-		if (dom.IsActive()) dom.Update(tp);
+		if (dom.IsActive()) { PROFILE_SCOPE(&dom); dom.Update(tp); }
 	}
 }
 
@@ -63,6 +63,7 @@ SOFTWARE.*/
 #include "FEDomain2D.h"
 #include "FEDiscreteDomain.h"
 #include "FEDataGenerator.h"
+#include "FEDomainMap.h"
 #include "FEModule.h"
 #include <stdarg.h>
 #include <sstream>
@@ -540,6 +541,9 @@ bool FEModel::Init()
 	// Do this last in case any model components redefined their load curves.
 	if (EvaluateLoadParameters() == false) return false;
 
+	// evaluate mapped data at integration points
+	UpdateDomainMapCaches();
+
 	// activate all permanent dofs
 	Activate();
 
@@ -1787,6 +1791,23 @@ void FEModel::EvaluateLoadControllers(double time)
 void FEModel::EvaluateDataGenerators(double time)
 {
 	for (int i = 0; i < MeshDataGenerators(); ++i) GetMeshDataGenerator(i)->Evaluate(time);
+
+	// the generated data may have changed
+	UpdateDomainMapCaches();
+}
+
+//-----------------------------------------------------------------------------
+//! Evaluates the domain maps at all integration points, so that mapped
+//! parameters don't need to interpolate the map data each time they are evaluated.
+//! Maps whose data did not change since the last call are skipped.
+void FEModel::UpdateDomainMapCaches()
+{
+	FEMesh& mesh = GetMesh();
+	for (int i = 0; i < mesh.DataMaps(); ++i)
+	{
+		FEDomainMap* map = dynamic_cast<FEDomainMap*>(mesh.GetDataMap(i));
+		if (map) map->UpdateIntegrationPointCache();
+	}
 }
 
 //-----------------------------------------------------------------------------
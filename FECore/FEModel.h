@@ -338,6 +338,9 @@ public: // --- parameter functions ---
 	// evaluate all mesh data
 	void EvaluateDataGenerators(double time);
 
+	//! resolve the domain maps at the integration points
+	void UpdateDomainMapCaches();
+
 	//! evaluate all load parameters
 	virtual bool EvaluateLoadParameters();
 
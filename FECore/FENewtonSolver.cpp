@@ -47,6 +47,7 @@ BEGIN_FECORE_CLASS(FENewtonSolver, FESolver)
 		ADD_PARAMETER(m_lineSearch->m_LStol , FE_RANGE_GREATER_OR_EQUAL(0.0), "lstol"   );
 		ADD_PARAMETER(m_lineSearch->m_LSmin , FE_RANGE_GREATER_OR_EQUAL(0.0), "lsmin"   );
 		ADD_PARAMETER(m_lineSearch->m_LSiter, FE_RANGE_GREATER_OR_EQUAL(0), "lsiter"  );
+		ADD_PARAMETER(m_lineSearch->m_LSreuse, "lsreuse");
 	END_PARAM_GROUP();
 
 	BEGIN_PARAM_GROUP("Nonlinear solver");
@@ -56,6 +57,8 @@ BEGIN_FECORE_CLASS(FENewtonSolver, FESolver)
 		ADD_PARAMETER(m_force_partition     , "force_partition");
 		ADD_PARAMETER(m_breformtimestep     , "reform_each_time_step");
 		ADD_PARAMETER(m_breformAugment      , "reform_augment");
+		ADD_PARAMETER(m_inexactAugment      , "inexact_augment");
+		ADD_PARAMETER(m_augRtol, FE_RANGE_GREATER(0.0), "augment_rtol");
 		ADD_PARAMETER(m_bdivreform          , "diverge_reform");
 //		ADD_PARAMETER(m_bdoreforms          , "do_reforms"  );
 		ADD_PARAMETER(m_Rmin, FE_RANGE_GREATER_OR_EQUAL(0.0), "min_residual");
@@ -99,6 +102,10 @@ FENewtonSolver::FENewtonSolver(FEModel* pfem) : FESolver(pfem)
 	m_force_partition = 0;
 	m_breformtimestep = true;
 	m_breformAugment = false;
+	m_inexactAugment = false;
+	m_augRtol = 0.1;
+	m_augRref = 0.0;
+	m_ninexact = 0;
 }
 
 //-----------------------------------------------------------------------------
@@ -449,6 +456,9 @@ bool FENewtonSolver::Init()
 //! Clean
 void FENewtonSolver::Clean()
 {
+	// keep the static profile if the mesh was modified, so it can be updated
+	if (m_pK && m_meshUpdate.pending && (m_meshUpdate.elemOrigin.empty() == false)) m_meshUpdate.profile = m_pK->GetStaticProfile();
+
 	if (m_pK) delete m_pK; m_pK = nullptr;
 	if (m_qnstrategy) m_qnstrategy->Reset();
 	m_Var.clear();
@@ -501,6 +511,8 @@ bool FENewtonSolver::SolveStep()
 	m_nref = 0;		// nr of stiffness reformations
 	m_ntotref = 0;
 	m_naug = 0;		// nr of augmentations
+	m_ninexact = 0;	// nr of inexact augmentations
+	m_augRref = 0.0;
 
 	try
 	{
@@ -611,6 +623,9 @@ bool FENewtonSolver::Quasin()
 
 			// Oh, oh, something went wrong
 			if (bret == false) break;
+
+			// update the Lagrange multipliers before the iterations have converged
+			DoInexactAugmentation(m_residuNorm.norm, m_residuNorm.norm0);
 		}
 		else if (m_baugment)
 		{
@@ -971,33 +986,73 @@ bool FENewtonSolver::DoAugmentations()
 	m_nref = 0;
 
 	// If we havn't converged we prepare for the next iteration
-	if (!bconv)
+	if (!bconv) UpdateAfterAugmentation();
+
+	return bconv;
+}
+
+//-----------------------------------------------------------------------------
+//! Prepare the next iteration after the Lagrange multipliers were updated.
+void FENewtonSolver::UpdateAfterAugmentation()
+{
+	// Since the Lagrange multipliers have changed, we can't just copy
+	// the last residual but have to recalculate the residual
+	// we also recalculate the stresses in case we are doing augmentations
+	// for incompressible materials
+	UpdateModel();
 	{
-		// Since the Lagrange multipliers have changed, we can't just copy
-		// the last residual but have to recalculate the residual
-		// we also recalculate the stresses in case we are doing augmentations
-		// for incompressible materials
-		UpdateModel();
-		{
-			// TODO: Why is this not calling strategy->Residual? 
-			TRACK_TIME(TimerID::Timer_Residual);
-			Residual(m_R0);
-		}
+		// TODO: Why is this not calling strategy->Residual? 
+		TRACK_TIME(TimerID::Timer_Residual);
+		Residual(m_R0);
+	}
 
-		m_qnstrategy->PreSolveUpdate();
+	m_qnstrategy->PreSolveUpdate();
 
-		// reform the matrix if we are using full-Newton or
-		// force reform after augmentations
-		if ((m_qnstrategy->m_maxups == 0) || (m_breformAugment))
-		{
-			// TODO: Note sure how to handle a false return from ReformStiffness. 
-			//       I think this is pretty rare so I'm ignoring it for now.
-//			if (ReformStiffness() == false) break;
-			m_qnstrategy->ReformStiffness();
-		}
+	// reform the matrix if we are using full-Newton or
+	// force reform after augmentations
+	if ((m_qnstrategy->m_maxups == 0) || (m_breformAugment))
+	{
+		// TODO: Note sure how to handle a false return from ReformStiffness. 
+		//       I think this is pretty rare so I'm ignoring it for now.
+//		if (ReformStiffness() == false) break;
+		m_qnstrategy->ReformStiffness();
 	}
+}
 
-	return bconv;
+//-----------------------------------------------------------------------------
+//! Do an augmentation while the Newton iterations have not converged yet. This
+//! is done when the residual norm has dropped below augment_rtol times the residual
+//! norm right after the last augmentation (or the initial residual norm). The 
+//! Lagrange multipliers then converge together with the Newton iterations, which 
+//! avoids a full Newton solve per augmentation. The final augmentation check is 
+//! still done by DoAugmentations after the iterations converged.
+//! The arguments are squared norms (as used by the convergence checks), but
+//! augment_rtol is a ratio of the norms themselves.
+//! Returns true if an augmentation was done. 
+bool FENewtonSolver::DoInexactAugmentation(double normR, double normR0)
+{
+	if ((m_baugment == false) || (m_inexactAugment == false)) return false;
+
+	// see if the residual was reduced sufficiently
+	double normRef = (m_augRref > 0.0 ? m_augRref : normR0);
+	if (sqrt(normR) > m_augRtol*sqrt(normRef)) return false;
+
+	FEModel& fem = *GetFEModel();
+	feLog("\n........................ inexact augmentation # %d\n", m_ninexact + 1);
+
+	// do callback
+	fem.DoCallback(CB_AUGMENT);
+
+	// update the Lagrange multipliers
+	// (we don't care about convergence here. That is checked once the iterations converged)
+	// (m_naug is not incremented since it counts the converged augmentations)
+	Augment();
+	++m_ninexact;
+
+	UpdateAfterAugmentation();
+	m_augRref = m_R0*m_R0;	// squared norm, like the arguments
+
+	return true;
 }
 
 //! Update the state of the model
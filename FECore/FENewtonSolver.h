@@ -159,6 +159,12 @@ public:
 	//! do augmentations
 	bool DoAugmentations();
 
+	//! Do an augmentation inside the Newton loop (if requested)
+	bool DoInexactAugmentation(double normR, double normR0);
+
+	//! Update the residual (and stiffness) after the Lagrange multipliers changed
+	void UpdateAfterAugmentation();
+
 	//! solve the equations
 	void SolveEquations(std::vector<double>& u, std::vector<double>& R);
 
@@ -233,6 +239,10 @@ public:
 	FENewtonStrategy*	m_qnstrategy;		//!< class handling the specific stiffness update logic
 	bool				m_breformtimestep;	//!< reform at start of time step
 	bool				m_breformAugment;	//!< reform after each (failed) augmentations
+	bool				m_inexactAugment;	//!< do augmentations inside the Newton loop
+	double				m_augRtol;			//!< reduction of the residual norm that triggers an inexact augmentation
+	double				m_augRref;			//!< reference residual for inexact augmentations (squared norm)
+	int					m_ninexact;			//!< nr of inexact augmentations
 	bool				m_bforceReform;		//!< forces a reform in QNInit
 	bool				m_bdivreform;		//!< reform when diverging
 	bool				m_bdoreforms;		//!< do reformations
@@ -55,18 +55,28 @@ FESurfaceElement* FENormalProjection::Project(vec3d r, vec3d n, double rs[2])
 	// let's find all the candidate surface elements
 	set<int>selist;
 	m_OT.FindCandidateSurfaceElements(r, n, selist, m_rad);
-	
-	// now that we found candidate surface elements, lets see if we can find 
-	// those that intersect the ray, then pick the closest intersection
-	set<int>::iterator it;
+
+	vector<FEElement*> candidates;
+	candidates.reserve(selist.size());
+	for (set<int>::iterator it = selist.begin(); it != selist.end(); ++it) candidates.push_back(&m_surf.Element(*it));
+
+	return Project(r, n, rs, candidates);
+}
+
+//-----------------------------------------------------------------------------
+//! This function applies the same rule as Project(r, n, rs) to a given list of
+//! candidate elements, i.e. it returns the intersection with the smallest gap
+//! larger than minus the search radius.
+//!
+FESurfaceElement* FENormalProjection::Project(const vec3d& r, const vec3d& n, double rs[2], const std::vector<FEElement*>& candidates)
+{
+	// lets see if we can find candidates that intersect the ray, then pick the closest intersection
 	bool found = false;
-	double rsl[2], gl, g = 0;
+	double rsl[2] = {0, 0}, gl, g = 0;
 	FESurfaceElement* pei = 0;
-	for (it=selist.begin(); it!=selist.end(); ++it) {
-		// get the surface element
-		int j = *it;
+	for (size_t i = 0; i < candidates.size(); ++i) {
 		// project the node on the element
-		FESurfaceElement* pe = &m_surf.Element(j);
+		FESurfaceElement* pe = static_cast<FESurfaceElement*>(candidates[i]);
 		if (m_surf.Intersect(*pe, r, n, rsl, gl, m_tol)) {
 			if ((!found) && (gl > -m_rad)) {
 				found = true;
@@ -48,6 +48,10 @@ public:
 public:
 	//! find the intersection of a ray with the surface
 	FESurfaceElement* Project(vec3d r, vec3d n, double rs[2]);
+
+	//! same as Project, but only considers the elements in the candidate list (no octree search)
+	FESurfaceElement* Project(const vec3d& r, const vec3d& n, double rs[2], const std::vector<FEElement*>& candidates);
+
 	FESurfaceElement* Project2(vec3d r, vec3d n, double rs[2]);
 	FESurfaceElement* Project3(const vec3d& r, const vec3d& n, double rs[2], int* pei = 0);
 
@@ -0,0 +1,340 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#include "stdafx.h"
+#include "FEProfiler.h"
+#include "FECoreBase.h"
+#include "Timer.h"
+#include "log.h"
+#include "sys.h"
+#include <vector>
+#include <string>
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+using namespace std;
+
+namespace {
+
+	// a node in the scope tree
+	struct ScopeNode
+	{
+		int			name;	// index into the thread's name table
+		int			parent;
+		vector<int>	children;
+		long long	calls;
+		double		time;	// total time (in seconds)
+	};
+
+	// a completed scope, stored in the ring buffer
+	struct ScopeEvent
+	{
+		int			name;	// index into the thread's name table
+		double		t0, t1;	// begin and end time (in seconds)
+	};
+
+	// the profile data of a thread
+	// (padded so that the data of different threads never share a cache line)
+	struct ThreadData
+	{
+		enum { RING_SIZE = 65536, CACHE_LINE = 64 };
+
+		vector<string>		names;		// copies of the scope names
+		vector<ScopeNode>	nodes;		// scope tree (node 0 is the root)
+		vector<int>			stack;		// open scopes
+		vector<double>		start;		// start times of open scopes
+		vector<ScopeEvent>	ring;		// ring buffer of most recent events
+		size_t				head;		// next position in ring buffer
+		bool				wrapped;	// did the ring buffer wrap around
+		long long			counter[FEProfiler::MAX_COUNTERS];
+		char				pad[CACHE_LINE];
+
+		void clear()
+		{
+			names.assign(1, "root");
+			nodes.clear();
+			ScopeNode root = { 0, -1, vector<int>(), 0, 0.0 };
+			nodes.push_back(root);
+			stack.assign(1, 0);
+			start.assign(1, 0.0);
+			ring.assign(RING_SIZE, ScopeEvent());
+			head = 0;
+			wrapped = false;
+			for (int i = 0; i < FEProfiler::MAX_COUNTERS; ++i) counter[i] = 0;
+		}
+
+		// returns the index of the name in the name table, adding it if necessary. 
+		// Names are copied since the strings they come from (e.g. component names) 
+		// may change or be deleted before the profile data is written.
+		int intern(const char* szname)
+		{
+			for (size_t i = 0; i < names.size(); ++i)
+			{
+				if (names[i] == szname) return (int)i;
+			}
+			names.push_back(szname);
+			return (int)names.size() - 1;
+		}
+	};
+
+	bool				s_benabled = false;
+	vector<ThreadData>	s_thread;
+	chrono::steady_clock::time_point	s_t0;
+
+	double now()
+	{
+		return chrono::duration<double>(chrono::steady_clock::now() - s_t0).count();
+	}
+
+	ThreadData* threadData()
+	{
+		size_t n = (size_t)omp_get_thread_num();
+		return (n < s_thread.size() ? &s_thread[n] : nullptr);
+	}
+
+	// combined scope tree (summed over all threads)
+	struct SummaryNode
+	{
+		string	name;
+		long long	calls;
+		double		time;
+		vector<SummaryNode>	children;
+	};
+
+	void merge(SummaryNode& dst, const ThreadData& td, int n)
+	{
+		const ScopeNode& sn = td.nodes[n];
+		for (size_t i = 0; i < sn.children.size(); ++i)
+		{
+			const ScopeNode& c = td.nodes[sn.children[i]];
+			const string& name = td.names[c.name];
+			SummaryNode* pd = nullptr;
+			for (size_t j = 0; j < dst.children.size(); ++j)
+			{
+				if (dst.children[j].name == name) { pd = &dst.children[j]; break; }
+			}
+			if (pd == nullptr)
+			{
+				SummaryNode s = { name, 0, 0.0 };
+				dst.children.push_back(s);
+				pd = &dst.children.back();
+			}
+			pd->calls += c.calls;
+			pd->time += c.time;
+			merge(*pd, td, sn.children[i]);
+		}
+	}
+
+	void printNode(FEModel* fem, const SummaryNode& n, int depth, double parentTime)
+	{
+		for (size_t i = 0; i < n.children.size(); ++i)
+		{
+			const SummaryNode& c = n.children[i];
+			char szname[64] = { 0 };
+			int l = 2 * depth;
+			if (l > 40) l = 40;
+			for (int j = 0; j < l; ++j) szname[j] = ' ';
+			snprintf(szname + l, sizeof(szname) - l, "%s", c.name.c_str());
+			double pct = (parentTime > 0 ? 100.0 * c.time / parentTime : 100.0);
+			feLogEx(fem, "\t%-40s %10lld %12.4lf %7.1lf%%\n", szname, c.calls, c.time, pct);
+			printNode(fem, c, depth + 1, c.time);
+		}
+	}
+
+	void writeEscaped(FILE* fp, const char* sz)
+	{
+		for (; *sz; ++sz)
+		{
+			if ((*sz == '"') || (*sz == '\\')) fputc('\\', fp);
+			if ((unsigned char)*sz >= 32) fputc(*sz, fp);
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+void FEProfiler::Enable(bool b)
+{
+	s_benabled = false;
+	if (b)
+	{
+		s_thread.resize(omp_get_max_threads());
+		Reset();
+	}
+	s_benabled = b;
+}
+
+//-----------------------------------------------------------------------------
+bool FEProfiler::IsEnabled()
+{
+	return s_benabled;
+}
+
+//-----------------------------------------------------------------------------
+void FEProfiler::Reset()
+{
+	for (size_t i = 0; i < s_thread.size(); ++i) s_thread[i].clear();
+	s_t0 = chrono::steady_clock::now();
+}
+
+//-----------------------------------------------------------------------------
+void FEProfiler::BeginScope(const char* szname)
+{
+	ThreadData* td = threadData();
+	if (td == nullptr) return;
+
+	// find the child of the current scope with this name
+	int parent = td->stack.back();
+	int n = -1;
+	vector<int>& children = td->nodes[parent].children;
+	for (size_t i = 0; i < children.size(); ++i)
+	{
+		const string& namei = td->names[td->nodes[children[i]].name];
+		if (namei == szname) { n = children[i]; break; }
+	}
+
+	// add it if it's new
+	if (n == -1)
+	{
+		n = (int)td->nodes.size();
+		ScopeNode node = { td->intern(szname), parent, vector<int>(), 0, 0.0 };
+		td->nodes.push_back(node);
+		td->nodes[parent].children.push_back(n);
+	}
+
+	td->stack.push_back(n);
+	td->start.push_back(now());
+}
+
+//-----------------------------------------------------------------------------
+void FEProfiler::EndScope()
+{
+	ThreadData* td = threadData();
+	if ((td == nullptr) || (td->stack.size() <= 1)) return;
+
+	double t1 = now();
+	double t0 = td->start.back();
+	int n = td->stack.back();
+	td->stack.pop_back();
+	td->start.pop_back();
+
+	ScopeNode& node = td->nodes[n];
+	node.calls++;
+	node.time += t1 - t0;
+
+	// store the event
+	ScopeEvent& ev = td->ring[td->head];
+	ev.name = node.name;
+	ev.t0 = t0;
+	ev.t1 = t1;
+	td->head++;
+	if (td->head == td->ring.size()) { td->head = 0; td->wrapped = true; }
+}
+
+//-----------------------------------------------------------------------------
+void FEProfiler::AddCount(int counter, long long n)
+{
+	ThreadData* td = threadData();
+	if (td) td->counter[counter] += n;
+}
+
+//-----------------------------------------------------------------------------
+void FEProfiler::PrintSummary(FEModel* fem)
+{
+	if (s_thread.empty()) return;
+
+	SummaryNode root = { "root", 0, 0.0 };
+	for (size_t i = 0; i < s_thread.size(); ++i) merge(root, s_thread[i], 0);
+
+	feLogEx(fem, "\n P R O F I L E   S U M M A R Y\n\n");
+	feLogEx(fem, "\t%-40s %10s %12s %8s\n", "scope", "calls", "time (sec)", "parent");
+	feLogEx(fem, "\t----------------------------------------------------------------------------\n");
+	double total = 0.0;
+	for (size_t i = 0; i < root.children.size(); ++i) total += root.children[i].time;
+	printNode(fem, root, 0, total);
+
+	long long counter[MAX_COUNTERS] = { 0 };
+	for (size_t i = 0; i < s_thread.size(); ++i)
+		for (int j = 0; j < MAX_COUNTERS; ++j) counter[j] += s_thread[i].counter[j];
+
+	feLogEx(fem, "\n\tintegration point evaluations ......... : %lld\n", counter[GaussPoints]);
+	feLogEx(fem, "\tassembled matrix entries .............. : %lld\n\n", counter[AssembledEntries]);
+}
+
+//-----------------------------------------------------------------------------
+bool FEProfiler::WriteTrace(const char* szfile)
+{
+	FILE* fp = fopen(szfile, "wt");
+	if (fp == nullptr) return false;
+
+	fprintf(fp, "{\"traceEvents\":[\n");
+	bool bfirst = true;
+	for (size_t i = 0; i < s_thread.size(); ++i)
+	{
+		const ThreadData& td = s_thread[i];
+		size_t N = (td.wrapped ? td.ring.size() : td.head);
+		size_t n0 = (td.wrapped ? td.head : 0);
+		for (size_t j = 0; j < N; ++j)
+		{
+			const ScopeEvent& ev = td.ring[(n0 + j) % td.ring.size()];
+			if (bfirst == false) fprintf(fp, ",\n");
+			fprintf(fp, "{\"name\":\"");
+			writeEscaped(fp, td.names[ev.name].c_str());
+			fprintf(fp, "\",\"cat\":\"febio\",\"ph\":\"X\",\"ts\":%.3lf,\"dur\":%.3lf,\"pid\":1,\"tid\":%d}", ev.t0*1e6, (ev.t1 - ev.t0)*1e6, (int)i);
+			bfirst = false;
+		}
+	}
+	fprintf(fp, "\n],\"displayTimeUnit\":\"ms\"}\n");
+	fclose(fp);
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+const char* FEProfiler::ComponentName(FECoreBase* pc)
+{
+	if (pc == nullptr) return "(null)";
+	const string& name = pc->GetName();
+	if (name.empty() == false) return name.c_str();
+	const char* sztype = pc->GetTypeStr();
+	return (sztype ? sztype : "(unknown)");
+}
+
+//-----------------------------------------------------------------------------
+const char* FEProfiler::TimerName(int timerId)
+{
+	switch (timerId)
+	{
+	case TimerID::Timer_Update    : return "Update";
+	case TimerID::Timer_LinSolve  : return "LinSolve";
+	case TimerID::Timer_Reform    : return "Reform";
+	case TimerID::Timer_Residual  : return "Residual";
+	case TimerID::Timer_Stiffness : return "Stiffness";
+	case TimerID::Timer_QNUpdate  : return "QNUpdate";
+	case TimerID::Timer_ModelSolve: return "ModelSolve";
+	}
+	return "Timer";
+}
@@ -0,0 +1,110 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#pragma once
+#include "fecore_api.h"
+
+class FEModel;
+class FECoreBase;
+
+//-----------------------------------------------------------------------------
+//! Light-weight hierarchical profiler. 
+//! Scopes are opened and closed with the FEProfileScope helper class (or the
+//! PROFILE_SCOPE macro) and are nested per thread, so the same component can 
+//! show up under different parents (e.g. a domain under Residual and Stiffness).
+//! Each thread keeps its own scope tree and a ring buffer with the most recent
+//! scope events, so that no locking is needed while profiling. 
+//! The profiler is disabled by default, in which case a scope costs one test.
+class FECORE_API FEProfiler
+{
+public:
+	// counters
+	enum Counter {
+		GaussPoints,		// nr of integration point evaluations
+		AssembledEntries,	// nr of element matrix entries assembled
+		MAX_COUNTERS
+	};
+
+public:
+	//! enable or disable the profiler. Enabling resets all data.
+	static void Enable(bool b);
+
+	//! see if the profiler is enabled
+	static bool IsEnabled();
+
+	//! clear all profile data
+	static void Reset();
+
+	//! open a new scope on the calling thread
+	//! (the profiler keeps a copy of the name)
+	static void BeginScope(const char* szname);
+
+	//! close the last scope on the calling thread
+	static void EndScope();
+
+	//! add to a counter
+	static void AddCount(int counter, long long n);
+
+	//! print the summary table to the log
+	static void PrintSummary(FEModel* fem);
+
+	//! write a Chrome/Perfetto trace file (JSON)
+	static bool WriteTrace(const char* szfile);
+
+	//! the name used for a component's scopes
+	static const char* ComponentName(FECoreBase* pc);
+
+	//! the name used for a timer's scopes
+	static const char* TimerName(int timerId);
+};
+
+//-----------------------------------------------------------------------------
+//! This class opens a profiler scope and closes it when it goes out of scope.
+class FECORE_API FEProfileScope
+{
+public:
+	FEProfileScope(const char* szname) : m_bactive(FEProfiler::IsEnabled())
+	{
+		if (m_bactive) FEProfiler::BeginScope(szname);
+	}
+
+	FEProfileScope(FECoreBase* pc) : m_bactive(FEProfiler::IsEnabled())
+	{
+		if (m_bactive) FEProfiler::BeginScope(FEProfiler::ComponentName(pc));
+	}
+
+	~FEProfileScope()
+	{
+		if (m_bactive) FEProfiler::EndScope();
+	}
+
+private:
+	bool	m_bactive;
+};
+
+#define PROFILE_SCOPE(name) FEProfileScope _profileScope(name);
+#define PROFILE_COUNT(counter, n) do { if (FEProfiler::IsEnabled()) FEProfiler::AddCount(FEProfiler::counter, n); } while (0)
@@ -32,6 +32,7 @@ SOFTWARE.*/
 #include "tools.h"
 #include "log.h"
 #include "FEModel.h"
+#include <algorithm>
 
 BEGIN_FECORE_CLASS(FESolidDomain, FEDomain)
 	ADD_PROPERTY(m_matAxis, "mat_axis", FEProperty::Optional);
@@ -56,6 +57,7 @@ bool FESolidDomain::Create(int nsize, FE_Element_Spec espec)
 {
 	// allocate elements
     m_Elem.resize(nsize);
+	m_elemOrder.clear();
 	for (int i = 0; i < nsize; ++i)
 	{
 		FESolidElement& el = m_Elem[i];
@@ -72,6 +74,98 @@ bool FESolidDomain::Create(int nsize, FE_Element_Spec espec)
 	return true;
 }
 
+//-----------------------------------------------------------------------------
+// spread the lower 21 bits of n so that there are two zero bits between each bit
+static unsigned long long morton_spread(unsigned long long n)
+{
+	n &= 0x1fffff;
+	n = (n | (n << 32)) & 0x1f00000000ffffull;
+	n = (n | (n << 16)) & 0x1f0000ff0000ffull;
+	n = (n | (n <<  8)) & 0x100f00f00f00f00full;
+	n = (n | (n <<  4)) & 0x10c30c30c30c30c3ull;
+	n = (n | (n <<  2)) & 0x1249249249249249ull;
+	return n;
+}
+
+//-----------------------------------------------------------------------------
+void FESolidDomain::CreateElementOrder()
+{
+	int NE = Elements();
+	m_elemOrder.clear();
+	if (NE == 0) return;
+
+	// calculate the element centroids in the reference configuration
+	FEMesh& mesh = *GetMesh();
+	vector<vec3d> c(NE);
+	for (int i = 0; i < NE; ++i)
+	{
+		FESolidElement& el = m_Elem[i];
+		int neln = el.Nodes();
+		vec3d ci(0, 0, 0);
+		for (int j = 0; j < neln; ++j) ci += mesh.Node(el.m_node[j]).m_r0;
+		c[i] = ci / (double)neln;
+	}
+
+	// bounding box
+	vec3d r0 = c[0], r1 = c[0];
+	for (int i = 1; i < NE; ++i)
+	{
+		if (c[i].x < r0.x) r0.x = c[i].x;
+		if (c[i].x > r1.x) r1.x = c[i].x;
+		if (c[i].y < r0.y) r0.y = c[i].y;
+		if (c[i].y > r1.y) r1.y = c[i].y;
+		if (c[i].z < r0.z) r0.z = c[i].z;
+		if (c[i].z > r1.z) r1.z = c[i].z;
+	}
+	double L = r1.x - r0.x;
+	if (r1.y - r0.y > L) L = r1.y - r0.y;
+	if (r1.z - r0.z > L) L = r1.z - r0.z;
+	double s = (L > 0 ? 2097151.0 / L : 0.0);
+
+	// calculate the Morton keys
+	vector< pair<unsigned long long, int> > key(NE);
+	for (int i = 0; i < NE; ++i)
+	{
+		unsigned long long x = (unsigned long long)((c[i].x - r0.x)*s);
+		unsigned long long y = (unsigned long long)((c[i].y - r0.y)*s);
+		unsigned long long z = (unsigned long long)((c[i].z - r0.z)*s);
+		key[i].first = morton_spread(x) | (morton_spread(y) << 1) | (morton_spread(z) << 2);
+		key[i].second = i;
+	}
+	sort(key.begin(), key.end());
+
+	m_elemOrder.resize(NE);
+	for (int i = 0; i < NE; ++i) m_elemOrder[i] = key[i].second;
+}
+
+//-----------------------------------------------------------------------------
+double FESolidDomain::GatherSpan(int blockSize) const
+{
+	int NE = Elements();
+	if ((NE == 0) || (blockSize <= 0)) return 0.0;
+
+	double sum = 0.0;
+	int blocks = 0;
+	for (int n = 0; n < NE; n += blockSize)
+	{
+		int nmin = -1, nmax = -1;
+		for (int i = n; (i < n + blockSize) && (i < NE); ++i)
+		{
+			const FESolidElement& el = m_Elem[ElementOrder(i)];
+			for (int j = 0; j < el.Nodes(); ++j)
+			{
+				int nj = el.m_node[j];
+				if ((nmin < 0) || (nj < nmin)) nmin = nj;
+				if (nj > nmax) nmax = nj;
+			}
+		}
+		sum += (double)(nmax - nmin);
+		blocks++;
+	}
+
+	return sum / blocks;
+}
+
 //-----------------------------------------------------------------------------
 FE_Element_Spec FESolidDomain::GetElementSpec() const
 {
@@ -268,6 +268,21 @@ public:
 	//! return the degrees of freedom of an element for this domain
 	virtual int GetElementDofs(FESolidElement& el);
 
+public:
+	//! Sort the element traversal order along a Morton (Z-order) curve of the 
+	//! element centroids. This does not move the element data.
+	void CreateElementOrder();
+
+	//! return the index of the i-th element in traversal order
+	int ElementOrder(int i) const { return (m_elemOrder.empty() ? i : m_elemOrder[i]); }
+
+	//! see if the traversal order was created (it is reset when the elements are reallocated)
+	bool HasElementOrder() const { return (m_elemOrder.empty() == false); }
+
+	//! Measure the locality of the node gathers in traversal order. This returns
+	//! the average span of node indices over blocks of consecutive elements.
+	double GatherSpan(int blockSize = 64) const;
+
 public:
 	// Evaluate an integral over the domain and assemble into global load vector
 	virtual void LoadVector(
@@ -287,6 +302,7 @@ public:
 protected:
     vector<FESolidElement>	m_Elem;		//!< array of elements
 	FE_Element_Spec			m_elemSpec;	//!< the element spec
+	vector<int>				m_elemOrder;	//!< element traversal order (empty for file order)
 
 	FEDofList	m_dofU;
 	FEDofList	m_dofSU;
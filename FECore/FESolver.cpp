@@ -37,6 +37,11 @@ SOFTWARE.*/
 #include "FELinearConstraintManager.h"
 #include "FENodalLoad.h"
 #include "LinearSolver.h"
+#include "SkylineSolver.h"
+#include "FECoreKernel.h"
+#include "FESolidDomain.h"
+#include "log.h"
+#include <algorithm>
 
 BEGIN_FECORE_CLASS(FESolver, FECoreBase)
 	BEGIN_PARAM_GROUP("linear system");
@@ -44,6 +49,7 @@ BEGIN_FECORE_CLASS(FESolver, FECoreBase)
 		ADD_PARAMETER(m_eq_scheme, "equation_scheme", 0, "staggered\0block\0");
 		ADD_PARAMETER(m_eq_order , "equation_order", 0, "default\0reverse\0febio2\0");
 		ADD_PARAMETER(m_bwopt    , "optimize_bw");
+		ADD_PARAMETER(m_bopt_locality, "optimize_locality");
 	END_PARAM_GROUP();
 END_FECORE_CLASS();
 
@@ -61,6 +67,7 @@ FESolver::FESolver(FEModel* fem) : FECoreBase(fem)
 	m_neq = 0;
 
 	m_bwopt = false;
+	m_bopt_locality = false;
 
 	m_eq_scheme = EQUATION_SCHEME::STAGGERED;
 	m_eq_order = EQUATION_ORDER::NORMAL_ORDER;
@@ -256,17 +263,63 @@ void FESolver::BuildMatrixProfile(FEGlobalMatrix& G, bool breset)
 	// (otherwise we only build the "dynamic" profile)
 	if (breset)
 	{
+		// After a mesh update we start from the old profile, and only add the elements 
+		// that were not in the old mesh. The entries of the elements that were removed 
+		// remain in the profile as structural zeroes.
+		bool bupdate = m_meshUpdate.active;
+		vector<bool> newEq;
+		if (bupdate)
+		{
+			G.build_merge(m_meshUpdate.profile, m_meshUpdate.eqMap);
+
+			// find the equations that are not in the old profile
+			newEq.assign(m_neq, true);
+			for (int n : m_meshUpdate.eqMap) if (n >= 0) newEq[n] = false;
+		}
+
 		// Add all elements to the profile
 		// Loop over all active domains
+		vector<int> elemList;
 		for (int nd = 0; nd<mesh.Domains(); ++nd)
 		{
 			FEDomain& d = mesh.Domain(nd);
-			d.BuildMatrixProfile(G);
+			const int NE = d.Elements();
+			if (bupdate && (nd < (int)m_meshUpdate.elemOrigin.size()) && ((int)m_meshUpdate.elemOrigin[nd].size() == NE))
+			{
+				// A copied element only needs to be added if one of its nodes
+				// has equations that were not in the old profile.
+				const vector<int>& elemOrigin = m_meshUpdate.elemOrigin[nd];
+				elemList.clear();
+				for (int i = 0; i < NE; ++i)
+				{
+					bool badd = (elemOrigin[i] < 0);
+					if (badd == false)
+					{
+						FEElement& el = d.ElementRef(i);
+						for (int j = 0; (j < el.Nodes()) && (badd == false); ++j)
+						{
+							const vector<int>& id = mesh.Node(el.m_node[j]).m_ID;
+							for (int k = 0; k < (int)id.size(); ++k)
+							{
+								int n = (id[k] < -1 ? -id[k] - 2 : id[k]);
+								if ((n >= 0) && newEq[n]) { badd = true; break; }
+							}
+						}
+					}
+					if (badd) elemList.push_back(i);
+				}
+
+				if (d.UpdateMatrixProfile(G, elemList) == false) d.BuildMatrixProfile(G);
+			}
+			else d.BuildMatrixProfile(G);
 		}
 
 		// linear constraints
 		FELinearConstraintManager& LCM = fem.GetLinearConstraintManager();
 		LCM.BuildMatrixProfile(G);
+
+		// we no longer need the mesh update data
+		if (bupdate) m_meshUpdate = MeshUpdate();
 	}
 	else
 	{
@@ -319,6 +372,51 @@ bool FESolver::InitStep(double time)
 	return true;
 }
 
+//-----------------------------------------------------------------------------
+//! The bandwidth reduction is done when requested explicitly. When the locality
+//! optimization is on, it is also done for the solvers that benefit from it,
+//! i.e. the skyline and iterative solvers. The sparse direct solvers do their 
+//! own fill-reducing ordering, so the numbering is left alone for those.
+bool FESolver::UseBandwidthReduction()
+{
+	if (m_bwopt) return true;
+	if (m_bopt_locality == false) return false;
+
+	// If a linear solver was defined for this step, it is already allocated.
+	LinearSolver* ls = GetLinearSolver();
+	if (ls) return (ls->IsIterative() || (dynamic_cast<SkylineSolver*>(ls) != nullptr));
+
+	// Otherwise, the kernel's default solver will be allocated after the equations
+	// are initialized, so we check its type (the skyline and the iterative solvers).
+	const char* sztype = FECoreKernel::GetInstance().GetLinearSolverType();
+	const char* szreduce[] = { "skyline", "fgmres", "cg", "bicgstab", "block" };
+	for (const char* sz : szreduce)
+	{
+		if (strcmp(sztype, sz) == 0) return true;
+	}
+	return false;
+}
+
+//-----------------------------------------------------------------------------
+//! Sort the element loops of the solid domains along a space-filling curve so 
+//! that consecutive elements (and the threads that process them) access nearby nodes.
+//! The order only depends on the reference geometry, so it is only created once per domain.
+void FESolver::OptimizeElementOrder()
+{
+	FEMesh& mesh = GetFEModel()->GetMesh();
+	for (int i = 0; i < mesh.Domains(); ++i)
+	{
+		FESolidDomain* dom = dynamic_cast<FESolidDomain*>(&mesh.Domain(i));
+		if (dom && (dom->Elements() > 0) && (dom->HasElementOrder() == false))
+		{
+			double s0 = dom->GatherSpan();
+			dom->CreateElementOrder();
+			double s1 = dom->GatherSpan();
+			feLogInfo("Element order of domain %s: average node span per element block %lg -> %lg", dom->GetName().c_str(), s0, s1);
+		}
+	}
+}
+
 //-----------------------------------------------------------------------------
 //!	This function initializes the equation system.
 //! It is assumed that all free dofs up until now have been given an ID >= 0
@@ -343,17 +441,29 @@ bool FESolver::InitEquations()
     // clear partitions
 	m_part.clear();
 
+	// see if the mesh was modified
+	bool bupdate = m_meshUpdate.pending;
+	int neq0 = m_neq;
+	m_meshUpdate.pending = false;
+	m_meshUpdate.active = false;
+
 	// reorder the node numbers
 	int NN = mesh.Nodes();
 	vector<int> P(NN);
     
     // see if we need to optimize the bandwidth
-	if (m_bwopt)
+	// (After a mesh update we try to keep the previous order.)
+	if (m_bopt_locality) OptimizeElementOrder();
+	if (UseBandwidthReduction())
 	{
-		FENodeReorder mod;
-		mod.Apply(mesh, P);
+		if ((bupdate == false) || (UpdateNodeOrder(P) == false))
+		{
+			FENodeReorder mod;
+			mod.Apply(mesh, P);
+		}
 	}
 	else for (int i = 0; i < NN; ++i) P[i] = i;
+	m_nodeOrder = P;
 
 	for (int i = 0; i < mesh.Nodes(); ++i)
 	{
@@ -529,11 +639,178 @@ bool FESolver::InitEquations()
     m_neq = neq;
 
 	assert(m_dofMap.size() == m_neq);
+
+	// map the old equations to the new ones
+	if (bupdate) MapEquations(neq0);
     
     // All initialization is done
     return true;
 }
 
+//-----------------------------------------------------------------------------
+void FESolver::SetMeshUpdate(const FEMesh& oldMesh, const std::vector<int>& nodeOrigin, const std::vector< std::vector<int> >& elemOrigin)
+{
+	FEMesh& mesh = GetFEModel()->GetMesh();
+	int NN = mesh.Nodes();
+
+	// If the solver did not process the previous update yet, the old equation
+	// numbers no longer match the old mesh, so we have to start from scratch.
+	bool bvalid = ((m_meshUpdate.pending == false) && ((int)nodeOrigin.size() == NN));
+	m_meshUpdate = MeshUpdate();
+	if (bvalid == false) return;
+
+	// store the old equation numbers of the nodes
+	int MAX_DOFS = GetFEModel()->GetDOFS().GetTotalDOFS();
+	m_meshUpdate.nodeEq.assign(NN*MAX_DOFS, -1);
+	for (int i = 0; i < NN; ++i)
+	{
+		int n = nodeOrigin[i];
+		if (n >= 0)
+		{
+			const vector<int>& id = oldMesh.Node(n).m_ID;
+			for (int j = 0; (j < (int)id.size()) && (j < MAX_DOFS); ++j) m_meshUpdate.nodeEq[i*MAX_DOFS + j] = id[j];
+		}
+	}
+
+	m_meshUpdate.pending = true;
+	m_meshUpdate.oldNodes = oldMesh.Nodes();
+	m_meshUpdate.nodeOrigin = nodeOrigin;
+
+	// The old profile is only worth keeping if some elements were copied. Otherwise, 
+	// it would only add couplings that no longer exist.
+	bool bcopied = false;
+	for (const vector<int>& eo : elemOrigin)
+	{
+		for (int n : eo) if (n >= 0) { bcopied = true; break; }
+		if (bcopied) break;
+	}
+	if (bcopied) m_meshUpdate.elemOrigin = elemOrigin;
+}
+
+//-----------------------------------------------------------------------------
+//! This keeps the previous order of the old nodes and places each new node right 
+//! after the old node it is connected to that comes first in that order. New nodes
+//! that are only connected to other new nodes are placed after those. This avoids
+//! reordering the entire mesh, while the new nodes still end up near their neighbors.
+//! Returns false if the previous order cannot be used.
+bool FESolver::UpdateNodeOrder(vector<int>& P)
+{
+	FEMesh& mesh = GetFEModel()->GetMesh();
+	const vector<int>& nodeOrigin = m_meshUpdate.nodeOrigin;
+	int NN = mesh.Nodes();
+	int N0 = m_meshUpdate.oldNodes;
+	if (((int)nodeOrigin.size() != NN) || ((int)m_nodeOrder.size() != N0)) return false;
+
+	// position of the old nodes in the previous order
+	vector<int> pos(N0, -1);
+	for (int i = 0; i < N0; ++i) pos[m_nodeOrder[i]] = i;
+
+	// the old nodes keep their position, and new nodes get the smallest position of their neighbors
+	vector<int> anchor(NN, -1);
+	for (int i = 0; i < NN; ++i) if (nodeOrigin[i] >= 0) anchor[i] = pos[nodeOrigin[i]];
+
+	bool bchanged = true;
+	while (bchanged)
+	{
+		bchanged = false;
+		vector<int> next(anchor);
+		for (int nd = 0; nd < mesh.Domains(); ++nd)
+		{
+			FEDomain& dom = mesh.Domain(nd);
+			const vector<int>* elemOrigin = (nd < (int)m_meshUpdate.elemOrigin.size() ? &m_meshUpdate.elemOrigin[nd] : nullptr);
+			if (elemOrigin && ((int)elemOrigin->size() != dom.Elements())) elemOrigin = nullptr;
+
+			for (int i = 0; i < dom.Elements(); ++i)
+			{
+				// copied elements only connect old nodes
+				if (elemOrigin && ((*elemOrigin)[i] >= 0)) continue;
+
+				FEElement& el = dom.ElementRef(i);
+				int amin = -1;
+				for (int j = 0; j < el.Nodes(); ++j)
+				{
+					int a = anchor[el.m_node[j]];
+					if ((a >= 0) && ((amin < 0) || (a < amin))) amin = a;
+				}
+
+				if (amin >= 0)
+				{
+					for (int j = 0; j < el.Nodes(); ++j)
+					{
+						int n = el.m_node[j];
+						if ((anchor[n] < 0) && ((next[n] < 0) || (amin < next[n]))) { next[n] = amin; bchanged = true; }
+					}
+				}
+			}
+		}
+		anchor.swap(next);
+	}
+
+	// sort the new nodes by their position
+	// (nodes that are not connected to anything go at the end)
+	vector<int> newNodes;
+	for (int i = 0; i < NN; ++i)
+	{
+		if (nodeOrigin[i] < 0)
+		{
+			if (anchor[i] < 0) anchor[i] = N0;
+			newNodes.push_back(i);
+		}
+	}
+	std::stable_sort(newNodes.begin(), newNodes.end(), [&](int a, int b) { return anchor[a] < anchor[b]; });
+
+	// new node index of the old nodes
+	vector<int> newIndex(N0, -1);
+	for (int i = 0; i < NN; ++i) if (nodeOrigin[i] >= 0) newIndex[nodeOrigin[i]] = i;
+
+	// merge the old and new nodes
+	int n = 0, k = 0;
+	const int NNEW = (int)newNodes.size();
+	for (int i = 0; i < N0; ++i)
+	{
+		int m = newIndex[m_nodeOrder[i]];
+		if (m >= 0) P[n++] = m;
+		while ((k < NNEW) && (anchor[newNodes[k]] == i)) P[n++] = newNodes[k++];
+	}
+	while (k < NNEW) P[n++] = newNodes[k++];
+	assert(n == NN);
+
+	return (n == NN);
+}
+
+//-----------------------------------------------------------------------------
+//! Build the map from the old equation numbers to the new ones. Equations that are
+//! not attached to a node that was copied from the old mesh (e.g. rigid body or
+//! Lagrange multiplier equations) are not mapped.
+void FESolver::MapEquations(int oldEquations)
+{
+	FEMesh& mesh = GetFEModel()->GetMesh();
+	int NN = mesh.Nodes();
+	int MAX_DOFS = GetFEModel()->GetDOFS().GetTotalDOFS();
+	const vector<int>& nodeEq = m_meshUpdate.nodeEq;
+	if ((int)nodeEq.size() != NN*MAX_DOFS) return;
+
+	vector<int>& eqMap = m_meshUpdate.eqMap;
+	eqMap.assign(oldEquations, -1);
+	for (int i = 0; i < NN; ++i)
+	{
+		const vector<int>& id = mesh.Node(i).m_ID;
+		for (int j = 0; (j < (int)id.size()) && (j < MAX_DOFS); ++j)
+		{
+			// prescribed dofs are stored as -n-2
+			int n0 = nodeEq[i*MAX_DOFS + j];
+			int n1 = id[j];
+			if (n0 < -1) n0 = -n0 - 2;
+			if (n1 < -1) n1 = -n1 - 2;
+			if ((n0 >= 0) && (n0 < oldEquations) && (n1 >= 0)) eqMap[n0] = n1;
+		}
+	}
+
+	// the old profile can only be used if it belongs to the old equations
+	m_meshUpdate.nodeEq.clear();
+	m_meshUpdate.active = ((m_meshUpdate.elemOrigin.empty() == false) && (m_meshUpdate.profile.Columns() == oldEquations));
+}
+
 //-----------------------------------------------------------------------------
 bool FESolver::InitEquations2()
 {
@@ -549,7 +826,8 @@ bool FESolver::InitEquations2()
 	vector<int> P(NN);
 
 	// see if we need to optimize the bandwidth
-	if (m_bwopt)
+	if (m_bopt_locality) OptimizeElementOrder();
+	if (UseBandwidthReduction())
 	{
 		FENodeReorder mod;
 		mod.Apply(mesh, P);
@@ -33,6 +33,7 @@ SOFTWARE.*/
 #include "vector.h"
 #include "FEDofList.h"
 #include "FETimeInfo.h"
+#include "MatrixProfile.h"
 
 //-----------------------------------------------------------------------------
 // Scheme for assigning equation numbers
@@ -82,6 +83,7 @@ struct FECORE_API FENodalDofInfo
 
 //-----------------------------------------------------------------------------
 class FEModel;
+class FEMesh;
 class FEGlobalMatrix;
 class LinearSolver;
 class FEGlobalVector;
@@ -179,6 +181,26 @@ public:
 	// return the node (mesh index) from an equation number
 	FENodalDofInfo GetDOFInfoFromEquation(int ieq);
 
+	//! Mesh adaptors call this after they modified the mesh. The oldMesh is a copy of the
+	//! mesh before it was modified. The nodeOrigin array stores for each node the index of
+	//! the old node it was copied from (or -1 for new nodes) and elemOrigin stores the same
+	//! for the elements of each domain. The next InitEquations and BuildMatrixProfile then
+	//! update the equation numbers and the matrix profile, instead of redoing them.
+	void SetMeshUpdate(const FEMesh& oldMesh, const std::vector<int>& nodeOrigin, const std::vector< std::vector<int> >& elemOrigin);
+
+protected:
+	// see if the node numbering should be reordered to reduce the bandwidth
+	bool UseBandwidthReduction();
+
+	// update the previous node order after a mesh update
+	bool UpdateNodeOrder(std::vector<int>& P);
+
+	// map the old equation numbers to the new ones after a mesh update
+	void MapEquations(int oldEquations);
+
+	// reorder the element traversal of the solid domains for data locality
+	void OptimizeElementOrder();
+
 public:
 	// extract the (square) norm of a solution vector
 	double ExtractSolutionNorm(const vector<double>& v, const FEDofList& dofs) const;
@@ -188,6 +210,7 @@ public:
 
 public: //TODO Move these parameters elsewhere
 	bool				m_bwopt;	    //!< bandwidth optimization flag
+	bool				m_bopt_locality;	//!< optimize element traversal and equation order for data locality
 	int					m_msymm;		//!< matrix symmetry flag for linear solver allocation
 	int					m_eq_scheme;	//!< equation number scheme (used in InitEquations)
 	int					m_eq_order;		//!< normal or reverse ordering
@@ -209,5 +232,23 @@ protected:
 	// list of solution variables
 	vector<FESolutionVariable>	m_Var;
 
+	// The node order that was used to assign the equation numbers
+	std::vector<int>	m_nodeOrder;
+
+	// Data that is needed to update the equations and matrix profile after the
+	// mesh was modified (see SetMeshUpdate).
+	struct MeshUpdate
+	{
+		bool				pending = false;	//!< InitEquations still needs to process the update
+		bool				active = false;		//!< BuildMatrixProfile can update the old profile
+		int					oldNodes = 0;		//!< nr of nodes before the update
+		std::vector<int>	nodeOrigin;			//!< old node index of each node (or -1)
+		std::vector<int>	nodeEq;				//!< old equation numbers of each node
+		std::vector< std::vector<int> >	elemOrigin;	//!< old element index of the elements of each domain (empty if none were copied)
+		std::vector<int>	eqMap;				//!< new equation number for each old equation (or -1)
+		SparseMatrixProfile	profile;			//!< the static matrix profile before the update
+	};
+	MeshUpdate	m_meshUpdate;
+
 	DECLARE_FECORE_CLASS();
 };
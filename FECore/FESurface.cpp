@@ -2454,100 +2454,7 @@ void FESurface::LoadVector(FEGlobalVector& R, const FEDofList& dofList, bool bre
 //-----------------------------------------------------------------------------
 void FESurface::LoadStiffness(FELinearSystem& LS, const FEDofList& dofList_a, const FEDofList& dofList_b, FESurfaceMatrixIntegrand f)
 {
-	FEElementMatrix ke;
-
-	int dofPerNode_a = dofList_a.Size();
-	int dofPerNode_b = dofList_b.Size();
-
-	int order_a = (dofPerNode_a == 1 ? dofList_a.InterpolationOrder(0) : -1);
-	int order_b = (dofPerNode_b == 1 ? dofList_b.InterpolationOrder(0) : -1);
-
-	vec3d rt[FEElement::MAX_NODES];
-
-	matrix kab(dofPerNode_a, dofPerNode_b);
-	FESurfaceDofShape dof_a, dof_b;
-
-	int NE = Elements();
-	for (int m = 0; m<NE; ++m)
-	{
-		// get the surface element
-		FESurfaceElement& el = Element(m);
-
-		ke.SetNodes(el.m_node);
-
-		// shape functions
-		int neln = el.Nodes();
-		int nn_a = el.ShapeFunctions(dofPerNode_a);
-		int nn_b = el.ShapeFunctions(dofPerNode_b);
-
-		// get the element stiffness matrix
-		int ndof_a = dofPerNode_a * nn_a;
-		int ndof_b = dofPerNode_b * nn_b;
-		ke.resize(ndof_a, ndof_b);
-
-		// calculate element stiffness
-		int nint = el.GaussPoints();
-
-		// gauss weights
-		double* w = el.GaussWeights();
-
-		// nodal coordinates
-		GetNodalCoordinates(el, rt);
-
-		// repeat over integration points
-		ke.zero();
-		for (int n = 0; n<nint; ++n)
-		{
-			FESurfaceMaterialPoint& pt = static_cast<FESurfaceMaterialPoint&>(*el.GetMaterialPoint(n));
-
-			double* Gr = el.Gr(n);
-			double* Gs = el.Gs(n);
-
-			// tangents at integration point
-			pt.dxr = vec3d(0, 0, 0);
-			pt.dxs = vec3d(0, 0, 0);
-			for (int i = 0; i<neln; ++i)
-			{
-				pt.dxr += rt[i] * Gr[i];
-				pt.dxs += rt[i] * Gs[i];
-			}
-
-			// calculate stiffness component
-			for (int i = 0; i < nn_a; ++i)
-			{
-				// shape function values
-				dof_a.index = i;
-				dof_a.shape = el.H(order_a, n)[i];
-				dof_a.shape_deriv_r = el.Gr(order_a, n)[i];
-				dof_a.shape_deriv_s = el.Gs(order_a, n)[i];
-
-				for (int j = 0; j < nn_b; ++j)
-				{
-					// shape function values
-					dof_b.index = j;
-					dof_b.shape = el.H(order_b, n)[j];
-					dof_b.shape_deriv_r = el.Gr(order_b, n)[j];
-					dof_b.shape_deriv_s = el.Gs(order_b, n)[j];
-
-					// evaluate integrand
-					kab.zero();
-					f(pt, dof_a, dof_b, kab);
-
-					// add it to the local element matrix
-					ke.adds(dofPerNode_a * i, dofPerNode_b * j, kab, w[n]);
-				}
-			}
-		}
-
-		// get the element's LM vector
-		std::vector<int>& lma = ke.RowIndices();
-		std::vector<int>& lmb = ke.ColumnsIndices();
-		UnpackLM(el, dofList_a, lma);
-		UnpackLM(el, dofList_b, lmb);
-
-		// assemble element matrix in global stiffness matrix
-		LS.Assemble(ke);
-	}
+	LoadStiffnessT(LS, dofList_a, dofList_b, f);
 }
 
 //-----------------------------------------------------------------------------
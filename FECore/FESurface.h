@@ -35,6 +35,7 @@ SOFTWARE.*/
 #include "FEDofList.h"
 #include "FESurfaceElement.h"
 #include "FENode.h"
+#include "FELinearSystem.h"
 
 //-----------------------------------------------------------------------------
 class FEMesh;
@@ -315,6 +316,16 @@ public:
 		FESurfaceMatrixIntegrand f	// the matrix function to evaluate
 	);
 
+	//! Same as LoadStiffness, but the integrand can be any callable with the signature
+	//! of FESurfaceMatrixIntegrand. Since its type is known at compile time, the integrand
+	//! can be inlined into the integration loop.
+	template <class Integrand> void LoadStiffnessT(
+		FELinearSystem& LS,			// The linear system does the assembling
+		const FEDofList& dofList_a,	// The degree of freedom list of node a
+		const FEDofList& dofList_b,	// The degree of freedom list of node b
+		Integrand f					// the matrix function to evaluate
+	);
+
 public:
 	void CreateMaterialPointData();
     
@@ -327,5 +338,117 @@ protected:
 	bool						m_bshellb;	//!< true if this surface is the bottom of a shell domain
 };
 
+//-----------------------------------------------------------------------------
+// The elements are integrated in parallel, so the integrand must not modify any
+// data shared between elements.
+template <class Integrand> void FESurface::LoadStiffnessT(FELinearSystem& LS, const FEDofList& dofList_a, const FEDofList& dofList_b, Integrand f)
+{
+	int dofPerNode_a = dofList_a.Size();
+	int dofPerNode_b = dofList_b.Size();
+
+	int order_a = (dofPerNode_a == 1 ? dofList_a.InterpolationOrder(0) : -1);
+	int order_b = (dofPerNode_b == 1 ? dofList_b.InterpolationOrder(0) : -1);
+
+	int NE = Elements();
+	#pragma omp parallel
+	{
+		FEElementMatrix ke;
+		vec3d rt[FEElement::MAX_NODES];
+
+		matrix kab(dofPerNode_a, dofPerNode_b);
+		FESurfaceDofShape dof_a, dof_b;
+
+		#pragma omp for
+		for (int m = 0; m < NE; ++m)
+		{
+			// get the surface element
+			FESurfaceElement& el = Element(m);
+
+			ke.SetNodes(el.m_node);
+
+			// shape functions
+			int neln = el.Nodes();
+			int nn_a = el.ShapeFunctions(dofPerNode_a);
+			int nn_b = el.ShapeFunctions(dofPerNode_b);
+
+			// get the element stiffness matrix
+			int ndof_a = dofPerNode_a * nn_a;
+			int ndof_b = dofPerNode_b * nn_b;
+			ke.resize(ndof_a, ndof_b);
+
+			// calculate element stiffness
+			int nint = el.GaussPoints();
+
+			// gauss weights
+			double* w = el.GaussWeights();
+
+			// nodal coordinates
+			GetNodalCoordinates(el, rt);
+
+			// repeat over integration points
+			ke.zero();
+			for (int n = 0; n < nint; ++n)
+			{
+				FESurfaceMaterialPoint& pt = static_cast<FESurfaceMaterialPoint&>(*el.GetMaterialPoint(n));
+
+				double* Gr = el.Gr(n);
+				double* Gs = el.Gs(n);
+
+				// tangents at integration point
+				pt.dxr = vec3d(0, 0, 0);
+				pt.dxs = vec3d(0, 0, 0);
+				for (int i = 0; i < neln; ++i)
+				{
+					pt.dxr += rt[i] * Gr[i];
+					pt.dxs += rt[i] * Gs[i];
+				}
+
+				double* Ha = el.H(order_a, n);
+				double* Gra = el.Gr(order_a, n);
+				double* Gsa = el.Gs(order_a, n);
+
+				double* Hb = el.H(order_b, n);
+				double* Grb = el.Gr(order_b, n);
+				double* Gsb = el.Gs(order_b, n);
+
+				// calculate stiffness component
+				for (int i = 0; i < nn_a; ++i)
+				{
+					// shape function values
+					dof_a.index = i;
+					dof_a.shape = Ha[i];
+					dof_a.shape_deriv_r = Gra[i];
+					dof_a.shape_deriv_s = Gsa[i];
+
+					for (int j = 0; j < nn_b; ++j)
+					{
+						// shape function values
+						dof_b.index = j;
+						dof_b.shape = Hb[j];
+						dof_b.shape_deriv_r = Grb[j];
+						dof_b.shape_deriv_s = Gsb[j];
+
+						// evaluate integrand
+						kab.zero();
+						f(pt, dof_a, dof_b, kab);
+
+						// add it to the local element matrix
+						ke.adds(dofPerNode_a * i, dofPerNode_b * j, kab, w[n]);
+					}
+				}
+			}
+
+			// get the element's LM vector
+			std::vector<int>& lma = ke.RowIndices();
+			std::vector<int>& lmb = ke.ColumnsIndices();
+			UnpackLM(el, dofList_a, lma);
+			UnpackLM(el, dofList_b, lmb);
+
+			// assemble element matrix in global stiffness matrix
+			LS.Assemble(ke);
+		}
+	}
+}
+
 // Calculates the volume inside a (closed) surface. 
 FECORE_API double CalculateSurfaceVolume(FESurface& s);
@@ -267,3 +267,175 @@ bool MSimpleExpression::Create(const std::string& expr, bool autoVars)
 	if (mob.Create(this, expr, false) == false) return false;
 	return true;
 }
+
+//=============================================================================
+bool MFusedExpression::Instruction::operator < (const Instruction& i) const
+{
+	if (op != i.op) return (op < i.op);
+	if (a != i.a) return (a < i.a);
+	if (b != i.b) return (b < i.b);
+	if (c != i.c) return (c < i.c);
+	if (f1 != i.f1) return std::less<FUNCPTR>()(f1, i.f1);
+	return std::less<FUNC2PTR>()(f2, i.f2);
+}
+
+//-----------------------------------------------------------------------------
+void MFusedExpression::Clear()
+{
+	m_code.clear();
+	m_lookup.clear();
+	m_out.clear();
+	m_end.clear();
+	m_fallback.clear();
+}
+
+//-----------------------------------------------------------------------------
+int MFusedExpression::AddExpression(const MSimpleExpression& e)
+{
+	int n = compile(e.GetExpression().ItemPtr());
+	if (n < 0)
+	{
+		m_fallback.push_back(e);
+		n = -(int)m_fallback.size();
+	}
+	m_out.push_back(n);
+	m_end.push_back((int)m_code.size());
+
+#ifndef NDEBUG
+	// check that the compiled expression gives the same value as the expression
+	// (at an arbitrary point where all variables are a bit larger than one)
+	std::vector<double> var(e.Variables());
+	for (size_t i = 0; i < var.size(); ++i) var[i] = 1.0 + 0.1*(i + 1);
+	std::vector<double> val(m_out.size());
+	value_s(var, &val[0]);
+	double v0 = e.value_s(var);
+	double v1 = val.back();
+	assert((v0 == v1) || ((v0 != v0) && (v1 != v1)) || (fabs(v1 - v0) <= 1e-12*(fabs(v0) + 1.0)));
+#endif
+
+	return (int)m_out.size() - 1;
+}
+
+//-----------------------------------------------------------------------------
+// adds the instruction, unless it already exists, and returns its register
+int MFusedExpression::emit(const Instruction& i)
+{
+	// fold constants
+	Instruction ins = i;
+	if ((ins.op != OP_CONST) && (ins.op != OP_VAR))
+	{
+		bool unary = ((ins.op == OP_NEG) || (ins.op == OP_F1D));
+		bool aconst = (m_code[ins.a].op == OP_CONST);
+		bool bconst = (unary || (m_code[ins.b].op == OP_CONST));
+		if (aconst && bconst)
+		{
+			double a = m_code[ins.a].c;
+			double b = (unary ? 0.0 : m_code[ins.b].c);
+			double c = 0.0;
+			switch (ins.op)
+			{
+			case OP_NEG: c = -a; break;
+			case OP_ADD: c = a + b; break;
+			case OP_SUB: c = a - b; break;
+			case OP_MUL: c = a * b; break;
+			case OP_DIV: c = a / b; break;
+			case OP_POW: c = pow(a, b); break;
+			case OP_F1D: c = ins.f1(a); break;
+			case OP_F2D: c = ins.f2(a, b); break;
+			}
+			ins = Instruction{ OP_CONST, 0, 0, c, nullptr, nullptr };
+		}
+	}
+
+	// the order of operands does not matter for these
+	if (((ins.op == OP_ADD) || (ins.op == OP_MUL)) && (ins.b < ins.a)) std::swap(ins.a, ins.b);
+
+	std::map<Instruction, int>::iterator it = m_lookup.find(ins);
+	if (it != m_lookup.end()) return it->second;
+
+	int n = (int)m_code.size();
+	m_code.push_back(ins);
+	m_lookup[ins] = n;
+	return n;
+}
+
+//-----------------------------------------------------------------------------
+// compiles the item and returns the register that holds its value (or -1 on failure)
+int MFusedExpression::compile(const MItem* pi)
+{
+	Instruction ins{ OP_CONST, 0, 0, 0.0, nullptr, nullptr };
+	switch (pi->Type())
+	{
+	case MCONST:
+	case MFRAC :
+	case MNAMED: ins.c = mnumber(pi)->value(); break;
+	case MVAR  : ins.op = OP_VAR; ins.a = mvar(pi)->index(); break;
+	case MNEG  :
+	case MF1D  :
+	{
+		ins.a = compile(munary(pi)->Item());
+		if (ins.a < 0) return -1;
+		if (pi->Type() == MNEG) ins.op = OP_NEG;
+		else { ins.op = OP_F1D; ins.f1 = mfnc1d(pi)->funcptr(); }
+	}
+	break;
+	case MADD: ins.op = OP_ADD; break;
+	case MSUB: ins.op = OP_SUB; break;
+	case MMUL: ins.op = OP_MUL; break;
+	case MDIV: ins.op = OP_DIV; break;
+	case MPOW: ins.op = OP_POW; break;
+	case MF2D: ins.op = OP_F2D; ins.f2 = mfnc2d(pi)->funcptr(); break;
+	case MSFNC: return compile(msfncnd(pi)->Value());
+	default:
+		return -1;
+	}
+
+	if (is_binary(pi))
+	{
+		ins.a = compile(mbinary(pi)->LeftItem());
+		if (ins.a < 0) return -1;
+		ins.b = compile(mbinary(pi)->RightItem());
+		if (ins.b < 0) return -1;
+	}
+
+	return emit(ins);
+}
+
+//-----------------------------------------------------------------------------
+void MFusedExpression::value_s(const std::vector<double>& var, double* val, int n) const
+{
+	if ((n < 0) || (n > Expressions())) n = Expressions();
+	if (n == 0) return;
+
+	// registers (each thread keeps its own buffer, so we don't allocate on each call)
+	static thread_local std::vector<double> reg;
+	int ninstr = m_end[n - 1];
+	if ((int)reg.size() < ninstr) reg.resize(ninstr);
+	double* r = reg.data();
+
+	for (int i = 0; i < ninstr; ++i)
+	{
+		const Instruction& c = m_code[i];
+		switch (c.op)
+		{
+		case OP_CONST: r[i] = c.c; break;
+		case OP_VAR  : r[i] = var[c.a]; break;
+		case OP_NEG  : r[i] = -r[c.a]; break;
+		case OP_ADD  : r[i] = r[c.a] + r[c.b]; break;
+		case OP_SUB  : r[i] = r[c.a] - r[c.b]; break;
+		case OP_MUL  : r[i] = r[c.a] * r[c.b]; break;
+		case OP_DIV  : r[i] = r[c.a] / r[c.b]; break;
+		case OP_POW  : r[i] = pow(r[c.a], r[c.b]); break;
+		case OP_F1D  : r[i] = c.f1(r[c.a]); break;
+		case OP_F2D  : r[i] = c.f2(r[c.a], r[c.b]); break;
+		default:
+			assert(false);
+		}
+	}
+
+	for (int i = 0; i < n; ++i)
+	{
+		int k = m_out[i];
+		val[i] = (k >= 0 ? r[k] : m_fallback[-k - 1].value_s(var));
+	}
+}
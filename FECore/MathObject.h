@@ -29,6 +29,7 @@ SOFTWARE.*/
 #pragma once
 #include "MItem.h"
 #include <vector>
+#include <map>
 #include "fecore_api.h"
 
 //-----------------------------------------------------------------------------
@@ -115,3 +116,54 @@ protected:
 protected:
 	MITEM	m_item;
 };
+
+//-----------------------------------------------------------------------------
+// This class compiles a set of simple expressions that share the same variable
+// list into a single instruction list that evaluates all of them in one pass.
+// Subexpressions that appear multiple times (within or across expressions) are
+// evaluated only once and constant subexpressions are folded. This is intended
+// for sets of derivatives of the same function, which share most of their terms.
+class FECORE_API MFusedExpression
+{
+	enum OpCode { OP_CONST, OP_VAR, OP_NEG, OP_ADD, OP_SUB, OP_MUL, OP_DIV, OP_POW, OP_F1D, OP_F2D };
+
+	struct Instruction
+	{
+		int			op;
+		int			a, b;	// operand registers (or variable index)
+		double		c;		// constant value
+		FUNCPTR		f1;
+		FUNC2PTR	f2;
+
+		bool operator < (const Instruction& i) const;
+	};
+
+public:
+	MFusedExpression() {}
+
+	void Clear();
+
+	// Add an expression and return its index in the output array.
+	// Expressions that cannot be compiled are evaluated with MSimpleExpression::value_s.
+	int AddExpression(const MSimpleExpression& e);
+
+	int Expressions() const { return (int)m_out.size(); }
+
+	// number of instructions that are evaluated for all expressions
+	int Instructions() const { return (int)m_code.size(); }
+
+	// Evaluate the first n expressions (all if n < 0) and store the results in val.
+	// This is thread safe, like MSimpleExpression::value_s.
+	void value_s(const std::vector<double>& var, double* val, int n = -1) const;
+
+private:
+	int compile(const MItem* pi);
+	int emit(const Instruction& i);
+
+private:
+	std::vector<Instruction>		m_code;		// instruction list (instruction i writes register i)
+	std::map<Instruction, int>		m_lookup;	// to find existing instructions
+	std::vector<int>				m_out;		// register of each expression (or -1-k for fallback k)
+	std::vector<int>				m_end;		// instructions needed to evaluate expressions 0..i
+	std::vector<MSimpleExpression>	m_fallback;	// expressions that could not be compiled
+};
@@ -29,6 +29,7 @@ SOFTWARE.*/
 #include "stdafx.h"
 #include "MatrixProfile.h"
 #include <assert.h>
+#include <algorithm>
 using namespace std;
 
 SparseMatrixProfile::ColumnProfile::ColumnProfile(const SparseMatrixProfile::ColumnProfile& a)
@@ -153,6 +154,33 @@ void SparseMatrixProfile::ColumnProfile::insertRow(int row)
 	}
 }
 
+//-----------------------------------------------------------------------------
+//! Merges a sorted list of unique row indices into the column profile. This does
+//! a single linear pass over the existing intervals and the new rows, which is
+//! much cheaper than inserting the rows one at a time.
+void SparseMatrixProfile::ColumnProfile::mergeRows(const std::vector<int>& rows)
+{
+	if (rows.empty()) return;
+
+	vector<RowEntry> data;
+	data.reserve(m_data.size() + 1);
+
+	size_t i = 0, k = 0;
+	size_t N = m_data.size(), M = rows.size();
+	while ((i < N) || (k < M))
+	{
+		RowEntry re;
+		if ((k == M) || ((i < N) && (m_data[i].start <= rows[k]))) re = m_data[i++];
+		else { re.start = re.end = rows[k++]; }
+
+		// append, merging with the last interval if they overlap or touch
+		if (data.empty() || (re.start > data.back().end + 1)) data.push_back(re);
+		else if (re.end > data.back().end) data.back().end = re.end;
+	}
+
+	m_data.swap(data);
+}
+
 //-----------------------------------------------------------------------------
 //! MatrixProfile constructor. Takes the nr of equations as input argument.
 //! If n is larger than zero a default profile is constructor for a diagonal
@@ -246,66 +274,127 @@ void SparseMatrixProfile::UpdateProfile(vector< vector<int> >& LM, int M)
 
 	// fill the valence array
 	int Ntot = 0;
+#pragma omp parallel for reduction(+:Ntot)
 	for (int i = 0; i<M; ++i)
 	{
-		int* lm = &(LM[i])[0];
-		int N = (int)LM[i].size();
+		const vector<int>& lm = LM[i];
+		int N = (int)lm.size();
 		Ntot += N;
 		for (int j = 0; j<N; ++j)
 		{
-			if (lm[j] >= 0) pval[lm[j]]++;
+			if (lm[j] >= 0)
+			{
+#pragma omp atomic
+				pval[lm[j]]++;
+			}
 		}
 	}
 
 	// create a "compact" 2D array that stores for each column the element
 	// numbers that contribute to that column. The compact array consists
 	// of two arrays. The first one (pelc) contains all element numbers, sorted
-	// by column. The second array stores for each column a pointer to the first
+	// by column. The second array stores for each column the offset of the first
 	// element in the pelc array that contributes to that column.
 	vector<int> pelc(Ntot);
-	vector<int*> ppelc(nc);
-
-	// set the column pointers
-	ppelc[0] = &pelc[0];
-	for (int i = 1; i<nc; ++i) ppelc[i] = ppelc[i - 1] + pval[i - 1];
+	vector<int> ppelc(nc + 1);
+	ppelc[0] = 0;
+	for (int i = 0; i<nc; ++i) ppelc[i + 1] = ppelc[i] + pval[i];
 
 	// fill the pelc array
+	// (The order of the elements within a column does not matter.)
+	vector<int> pos(ppelc.begin(), ppelc.end() - 1);
+#pragma omp parallel for
 	for (int i = 0; i<M; ++i)
 	{
-		int* lm = &(LM[i])[0];
-		int N = (int)LM[i].size();
+		const vector<int>& lm = LM[i];
+		int N = (int)lm.size();
 		for (int j = 0; j<N; ++j)
 		{
-			if (lm[j] >= 0) *(ppelc[lm[j]])++ = i;
+			if (lm[j] >= 0)
+			{
+				int n;
+#pragma omp atomic capture
+				n = pos[lm[j]]++;
+				pelc[n] = i;
+			}
 		}
 	}
 
-	// reset pelc pointers
-	ppelc[0] = &pelc[0];
-	for (int i = 1; i<nc; ++i) ppelc[i] = ppelc[i - 1] + pval[i - 1];
-
-	// loop over all columns
-#pragma omp parallel for schedule(dynamic)
-	for (int i = 0; i<nc; ++i)
+	// Loop over all columns. For each column, we collect the row indices of 
+	// all contributing elements, sort them, and merge them into the column profile.
+#pragma omp parallel
 	{
-		if (pval[i] > 0)
+		vector<int> rows;
+
+#pragma omp for schedule(dynamic, 64)
+		for (int i = 0; i<nc; ++i)
 		{
-			// get the column
-			ColumnProfile& a = m_prof[i];
+			if (pval[i] > 0)
+			{
+				rows.clear();
 
-			// loop over all elements in the plec
-			for (int j = 0; j<pval[i]; ++j)
+				// loop over all elements in the plec
+				for (int j = ppelc[i]; j<ppelc[i + 1]; ++j)
+				{
+					const vector<int>& lm = LM[pelc[j]];
+					int N = (int)lm.size();
+					for (int k = 0; k<N; ++k)
+					{
+						if (lm[k] >= 0) rows.push_back(lm[k]);
+					}
+				}
+
+				sort(rows.begin(), rows.end());
+				rows.erase(unique(rows.begin(), rows.end()), rows.end());
+
+				m_prof[i].mergeRows(rows);
+			}
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+//! Merges the profile mp into this profile. The map array stores for each row (and
+//! column) of mp its index in this profile, or -1 if that row was removed. No two 
+//! rows can be mapped to the same index. If the map preserves the order of the rows,
+//! the remapped rows of a column are already sorted and can be merged directly.
+void SparseMatrixProfile::Merge(const SparseMatrixProfile& mp, const std::vector<int>& map)
+{
+	assert((int)map.size() >= mp.m_nrow);
+	assert((int)map.size() >= mp.m_ncol);
+
+	int nc = mp.m_ncol;
+#pragma omp parallel
+	{
+		vector<int> rows;
+
+#pragma omp for schedule(dynamic, 64)
+		for (int j = 0; j < nc; ++j)
+		{
+			int jn = map[j];
+			if (jn >= 0)
 			{
-				int iel = (ppelc[i])[j];
-				int* lm = &(LM[iel])[0];
-				int N = (int)LM[iel].size();
-				for (int k = 0; k<N; ++k)
+				rows.clear();
+				bool sorted = true;
+
+				const ColumnProfile& cj = mp.m_prof[j];
+				for (int k = 0; k < cj.size(); ++k)
 				{
-					if (lm[k] >= 0)
-					{ 
-						a.insertRow(lm[k]);
+					const RowEntry& re = cj[k];
+					for (int i = re.start; i <= re.end; ++i)
+					{
+						int in = map[i];
+						if (in >= 0)
+						{
+							if (!rows.empty() && (in < rows.back())) sorted = false;
+							rows.push_back(in);
+						}
 					}
 				}
+
+				if (sorted == false) sort(rows.begin(), rows.end());
+
+				m_prof[jn].mergeRows(rows);
 			}
 		}
 	}
@@ -85,6 +85,9 @@ public:
 		// add row index to column profile
 		void insertRow(int row);
 
+		// merge a sorted list of unique row indices into the column profile
+		void mergeRows(const std::vector<int>& rows);
+
 	private:
 		std::vector<RowEntry>	m_data;	// the column profile data
 	};
@@ -111,6 +114,9 @@ public:
 	//! updates the profile for an array of elements
 	void UpdateProfile(std::vector< std::vector<int> >& LM, int N);
 
+	//! merges another profile into this one after renumbering its rows and columns
+	void Merge(const SparseMatrixProfile& mp, const std::vector<int>& map);
+
 	//! inserts an entry into the profile (This is an expensive operation!)
 	void Insert(int i, int j);
 
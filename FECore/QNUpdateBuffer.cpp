@@ -0,0 +1,176 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#include "stdafx.h"
+#include "QNUpdateBuffer.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include <assert.h>
+#include <new>
+
+//-----------------------------------------------------------------------------
+namespace {
+
+	// alignment (in bytes) of each vector
+	const size_t ALIGNMENT = 64;
+
+	// below this size we don't bother with threads
+	const int MIN_PARALLEL_SIZE = 10000;
+
+	template <typename T> void setVector(T* y, const double* v, double s, int neq)
+	{
+#pragma omp parallel for if (neq > MIN_PARALLEL_SIZE)
+		for (int i = 0; i < neq; ++i) y[i] = (T)(s*v[i]);
+	}
+
+	template <typename T> double dot(const T* y, const double* x, int neq)
+	{
+		double r = 0.0;
+#pragma omp parallel for reduction(+:r) if (neq > MIN_PARALLEL_SIZE)
+		for (int i = 0; i < neq; ++i) r += y[i] * x[i];
+		return r;
+	}
+
+	template <typename T> double dotUpdate(const T* yk, const T* y0, const T* y1, double a0, double a1, double* x, int neq)
+	{
+		double r = 0.0;
+#pragma omp parallel if (neq > MIN_PARALLEL_SIZE)
+		{
+#pragma omp for reduction(+:r)
+			for (int i = 0; i < neq; ++i) r += yk[i] * x[i];
+
+			// the reduction implies a barrier, so r is complete here
+			const double b0 = r*a0;
+			const double b1 = r*a1;
+			if (b1 == 0.0)
+			{
+#pragma omp for
+				for (int i = 0; i < neq; ++i) x[i] += b0*y0[i];
+			}
+			else if (b0 == 0.0)
+			{
+#pragma omp for
+				for (int i = 0; i < neq; ++i) x[i] += b1*y1[i];
+			}
+			else
+			{
+#pragma omp for
+				for (int i = 0; i < neq; ++i) x[i] += b0*y0[i] + b1*y1[i];
+			}
+		}
+		return r;
+	}
+}
+
+//-----------------------------------------------------------------------------
+QNUpdateBuffer::QNUpdateBuffer()
+{
+	m_buf = nullptr;
+	m_data = nullptr;
+	m_stride = 0;
+	m_nups = 0;
+	m_neq = 0;
+	m_single = false;
+}
+
+//-----------------------------------------------------------------------------
+QNUpdateBuffer::~QNUpdateBuffer()
+{
+	Clear();
+}
+
+//-----------------------------------------------------------------------------
+void QNUpdateBuffer::Clear()
+{
+	free(m_buf);
+	m_buf = nullptr;
+	m_data = nullptr;
+	m_stride = 0;
+	m_nups = 0;
+	m_neq = 0;
+}
+
+//-----------------------------------------------------------------------------
+void QNUpdateBuffer::Create(int updates, int neq, bool singlePrecision)
+{
+	Clear();
+	if ((updates <= 0) || (neq <= 0)) return;
+
+	m_nups = updates;
+	m_neq = neq;
+	m_single = singlePrecision;
+
+	// pad each vector to a multiple of the alignment
+	size_t valueSize = (m_single ? sizeof(float) : sizeof(double));
+	size_t perLine = ALIGNMENT / valueSize;
+	m_stride = ((size_t)neq + perLine - 1) / perLine * perLine;
+
+	size_t bytes = 2 * (size_t)updates * m_stride * valueSize;
+	m_buf = malloc(bytes + ALIGNMENT);
+	if (m_buf == nullptr) throw std::bad_alloc();
+
+	uintptr_t p = (uintptr_t)m_buf;
+	p = (p + ALIGNMENT - 1) & ~(uintptr_t)(ALIGNMENT - 1);
+	m_data = (void*)p;
+}
+
+//-----------------------------------------------------------------------------
+void QNUpdateBuffer::SetVector(int n, int k, const std::vector<double>& v, double scale)
+{
+	assert((n >= 0) && (n < m_nups) && (k >= 0) && (k < 2));
+	size_t offset = (2 * (size_t)n + k)*m_stride;
+	if (m_single) setVector((float* )m_data + offset, &v[0], scale, m_neq);
+	else          setVector((double*)m_data + offset, &v[0], scale, m_neq);
+}
+
+//-----------------------------------------------------------------------------
+double QNUpdateBuffer::Dot(int n, int k, const std::vector<double>& x) const
+{
+	assert((n >= 0) && (n < m_nups) && (k >= 0) && (k < 2));
+	size_t offset = (2 * (size_t)n + k)*m_stride;
+	if (m_single) return dot((const float* )m_data + offset, &x[0], m_neq);
+	else          return dot((const double*)m_data + offset, &x[0], m_neq);
+}
+
+//-----------------------------------------------------------------------------
+double QNUpdateBuffer::DotUpdate(int n, int k, double a0, double a1, std::vector<double>& x) const
+{
+	assert((n >= 0) && (n < m_nups) && (k >= 0) && (k < 2));
+	size_t offset = 2 * (size_t)n*m_stride;
+	if (m_single)
+	{
+		const float* y0 = (const float*)m_data + offset;
+		const float* y1 = y0 + m_stride;
+		return dotUpdate((k == 0 ? y0 : y1), y0, y1, a0, a1, &x[0], m_neq);
+	}
+	else
+	{
+		const double* y0 = (const double*)m_data + offset;
+		const double* y1 = y0 + m_stride;
+		return dotUpdate((k == 0 ? y0 : y1), y0, y1, a0, a1, &x[0], m_neq);
+	}
+}
@@ -0,0 +1,80 @@
+/*This file is part of the FEBio source code and is licensed under the MIT license
+listed below.
+
+See Copyright-FEBio.txt for details.
+
+Copyright (c) 2021 University of Utah, The Trustees of Columbia University in
+the City of New York, and others.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.*/
+
+
+#pragma once
+#include "fecore_api.h"
+#include <vector>
+#include <stddef.h>
+
+//-----------------------------------------------------------------------------
+//! This class stores the update vectors of the quasi-Newton strategies.
+//! Each update n consists of two vectors y0(n) and y1(n), which are stored in one
+//! contiguous, cache-line aligned block. Optionally, the vectors are stored in
+//! single precision, which halves the memory footprint (and memory traffic) so
+//! that more updates can be kept. All operations are done in double precision.
+class FECORE_API QNUpdateBuffer
+{
+public:
+	QNUpdateBuffer();
+	~QNUpdateBuffer();
+
+	//! allocate storage for the given number of updates
+	void Create(int updates, int neq, bool singlePrecision = false);
+
+	//! release all storage
+	void Clear();
+
+	//! number of updates that can be stored
+	int Updates() const { return m_nups; }
+
+	//! length of the vectors
+	int Equations() const { return m_neq; }
+
+	bool IsSinglePrecision() const { return m_single; }
+
+	//! Set vector k (0 or 1) of update n to scale*v
+	void SetVector(int n, int k, const std::vector<double>& v, double scale = 1.0);
+
+	//! returns the dot product of vector k of update n with x
+	double Dot(int n, int k, const std::vector<double>& x) const;
+
+	//! Calculates r = yk(n)*x and then x += r*(a0*y0(n) + a1*y1(n)). Returns r.
+	//! This is the basic operation of the quasi-Newton updates, and is done in
+	//! one parallel region.
+	double DotUpdate(int n, int k, double a0, double a1, std::vector<double>& x) const;
+
+private:
+	void*	m_buf;		//!< raw allocation
+	void*	m_data;		//!< aligned start of data
+	size_t	m_stride;	//!< stride (in values) between consecutive vectors
+	int		m_nups;		//!< number of updates
+	int		m_neq;		//!< vector length
+	bool	m_single;	//!< single precision storage
+
+	QNUpdateBuffer(const QNUpdateBuffer&) = delete;
+	void operator = (const QNUpdateBuffer&) = delete;
+};
@@ -95,6 +95,9 @@ public: // functions to be overwritten in derived classes
 	//! scale matrix
 	virtual void scale(const std::vector<double>& L, const std::vector<double>& R);
 
+	//! return false if the matrix does not use the sparsity profile (see FEGlobalMatrix::Create)
+	virtual bool NeedsProfile() const { return true; }
+
 public:
 	//! multiply with vector
 	bool mult_vector(double* x, double* r) override { assert(false); return false; }
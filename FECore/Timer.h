@@ -25,6 +25,7 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.*/
 #pragma once
 #include "fecore_api.h"
+#include "FEProfiler.h"
 
 class FEModel;
 
@@ -109,4 +110,16 @@ private:
 	Timer*	m_timer;
 };
 
-#define TRACK_TIME(timerId) TimerTracker _trackTimer(GetFEModel(), timerId);
+//-----------------------------------------------------------------------------
+// Tracks a timer and opens a profiler scope with the timer's name. 
+class FECORE_API TimedScope
+{
+public:
+	TimedScope(FEModel* fem, int timerId) : m_timer(fem, timerId), m_scope(FEProfiler::TimerName(timerId)) {}
+
+private:
+	TimerTracker	m_timer;
+	FEProfileScope	m_scope;
+};
+
+#define TRACK_TIME(timerId) TimedScope _trackTimer(GetFEModel(), timerId);
@@ -32,6 +32,7 @@ BEGIN_FECORE_CLASS(FEImageDataMap, FEElemDataGenerator)
 	ADD_PARAMETER(m_r0, "range_min");
 	ADD_PARAMETER(m_r1, "range_max");
 	ADD_PARAMETER(m_blur, "blur");
+	ADD_PARAMETER(m_brickSize, "brick_size");
 	ADD_PROPERTY(m_imgSrc, "image");
 END_FECORE_CLASS();
 
@@ -39,6 +40,7 @@ FEImageDataMap::FEImageDataMap(FEModel* fem) : FEElemDataGenerator(fem), m_map(m
 {
 	m_imgSrc = nullptr;
 	m_blur = 0.0;
+	m_brickSize = 0;
 	m_data = nullptr;
 }
 
@@ -52,6 +54,7 @@ bool FEImageDataMap::Init()
 	}
 	m_im = m_im0;
 	m_map.SetRange(m_r0, m_r1);
+	m_map.SetBrickSize(m_brickSize);
 
 	return FEElemDataGenerator::Init();
 }
@@ -75,16 +78,29 @@ void FEImageDataMap::GenerateData()
 	FEElementSet& set = *GetElementSet();
 	FEMesh& mesh = *set.GetMesh();
 	int N = set.Elements();
+
+	// the image may have changed, so update the bricks
+	m_map.UpdateBricks();
+
+	// collect all the sample points
+	vector<vec3d> r;
+	for (int i = 0; i < N; ++i)
+	{
+		FEElement& el = set.Element(i);
+		int ne = el.Nodes();
+		for (int j = 0; j < ne; ++j) r.push_back(mesh.Node(el.m_node[j]).m_r0);
+	}
+
+	// evaluate the image at all points
+	vector<double> d;
+	m_map.values(r, d);
+
+	int n = 0;
 	for (int i = 0; i < N; ++i)
 	{
 		FEElement& el = set.Element(i);
 		int ne = el.Nodes();
-		for (int j = 0; j < ne; ++j)
-		{
-			vec3d ri = mesh.Node(el.m_node[j]).m_r0;
-			double d = m_map.value(m_map.map(ri));
-			m_data->setValue(i, j, d);
-		}
+		for (int j = 0; j < ne; ++j) m_data->setValue(i, j, d[n++]);
 	}
 }
 
@@ -49,6 +49,7 @@ private:
 	vec3d	m_r0;
 	vec3d	m_r1;
 	double	m_blur;
+	int		m_brickSize;	// brick size for image sampling (0 = no bricking)
 
 	FEImageSource* m_imgSrc;
 
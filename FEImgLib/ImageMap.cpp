@@ -1,11 +1,16 @@
 //#include "stdafx.h"
 #include "ImageMap.h"
 #include "math.h"
+#include <algorithm>
 
 ImageMap::ImageMap(Image& img) : m_img(img)
 {
 	m_r0 = vec3d(0,0,0);
 	m_r1 = vec3d(0,0,0);
+
+	m_bs = 0;
+	m_nbx = m_nby = m_nbz = 0;
+	m_bsx = m_bsy = m_bsz = 0;
 }
 
 ImageMap::~ImageMap(void)
@@ -72,6 +77,154 @@ ImageMap::POINT ImageMap::map(const vec3d& p)
 	return pt;
 }
 
+void ImageMap::SetBrickSize(int n)
+{
+	m_bs = (n > 0 ? n : 0);
+	m_brick.clear();
+	m_nbx = m_nby = m_nbz = 0;
+}
+
+void ImageMap::UpdateBricks()
+{
+	m_brick.clear();
+	m_nbx = m_nby = m_nbz = 0;
+	if (m_bs <= 0) return;
+
+	int nx = m_img.width ();
+	int ny = m_img.height();
+	int nz = m_img.depth ();
+	if ((nx < 2) || (ny < 2) || (nz < 1)) return;
+
+	// Each brick holds the voxels of bs cells in each direction, i.e. bs+1 voxels,
+	// so that the last layer of voxels is shared with the neighboring brick.
+	int B = m_bs;
+	m_nbx = (nx - 2) / B + 1;
+	m_nby = (ny - 2) / B + 1;
+	m_nbz = (nz == 1 ? 1 : (nz - 2) / B + 1);
+	m_bsx = B + 1;
+	m_bsy = B + 1;
+	m_bsz = (nz == 1 ? 1 : B + 1);
+
+	int brickSize = m_bsx*m_bsy*m_bsz;
+	int nbricks = m_nbx*m_nby*m_nbz;
+	m_brick.assign((size_t)nbricks*brickSize, 0.f);
+
+#pragma omp parallel for
+	for (int n = 0; n < nbricks; ++n)
+	{
+		int bi = n % m_nbx;
+		int bj = (n / m_nbx) % m_nby;
+		int bk = n / (m_nbx*m_nby);
+
+		float* pb = &m_brick[(size_t)n*brickSize];
+		for (int k = 0; k < m_bsz; ++k)
+		{
+			int gk = std::min(bk*B + k, nz - 1);
+			for (int j = 0; j < m_bsy; ++j)
+			{
+				int gj = std::min(bj*B + j, ny - 1);
+				for (int i = 0; i < m_bsx; ++i)
+				{
+					int gi = std::min(bi*B + i, nx - 1);
+					pb[(k*m_bsy + j)*m_bsx + i] = m_img.value(gi, gj, gk);
+				}
+			}
+		}
+	}
+}
+
+double ImageMap::brick_value(const POINT& p)
+{
+	int B = m_bs;
+	int bi = p.i / B, li = p.i - bi*B;
+	int bj = p.j / B, lj = p.j - bj*B;
+	int bk = p.k / B, lk = p.k - bk*B;
+
+	const float* pb = &m_brick[(size_t)((bk*m_nby + bj)*m_nbx + bi)*(m_bsx*m_bsy*m_bsz)];
+	const float* p0 = pb + (lk*m_bsy + lj)*m_bsx + li;
+
+	if (m_bsz == 1)
+	{
+		double v[4];
+		v[0] = p0[0];
+		v[1] = p0[1];
+		v[2] = p0[m_bsx + 1];
+		v[3] = p0[m_bsx];
+
+		return (p.h[0]*v[0] + p.h[1]*v[1] + p.h[2]*v[2] + p.h[3]*v[3]);
+	}
+	else
+	{
+		const float* p1 = p0 + m_bsx*m_bsy;
+
+		double v[8];
+		v[0] = p0[0];
+		v[1] = p0[1];
+		v[2] = p0[m_bsx + 1];
+		v[3] = p0[m_bsx];
+		v[4] = p1[0];
+		v[5] = p1[1];
+		v[6] = p1[m_bsx + 1];
+		v[7] = p1[m_bsx];
+
+		return (p.h[0]*v[0] + p.h[1]*v[1] + p.h[2]*v[2] + p.h[3]*v[3] + p.h[4]*v[4] + p.h[5]*v[5] + p.h[6]*v[6] + p.h[7]*v[7]);
+	}
+}
+
+long long ImageMap::sort_key(const POINT& p)
+{
+	int nx = m_img.width ();
+	int ny = m_img.height();
+	int nz = m_img.depth ();
+
+	// points outside the image don't touch the image data
+	if ((p.i < 0) || (p.i >= nx - 1)) return -1;
+	if ((p.j < 0) || (p.j >= ny - 1)) return -1;
+	if ((nz > 1) && ((p.k < 0) || (p.k >= nz - 1))) return -1;
+
+	if (m_brick.empty() == false)
+	{
+		// sort by brick first, and then by position in the brick
+		int B = m_bs;
+		int bi = p.i / B, bj = p.j / B, bk = p.k / B;
+		long long nb = (long long)(bk*m_nby + bj)*m_nbx + bi;
+		long long nl = ((long long)(p.k - bk*B)*m_bsy + (p.j - bj*B))*m_bsx + (p.i - bi*B);
+		return nb*(m_bsx*m_bsy*m_bsz) + nl;
+	}
+	else
+	{
+		// sort by the image memory layout
+		return ((long long)p.k*ny + (ny - p.j - 1))*nx + p.i;
+	}
+}
+
+void ImageMap::values(const std::vector<vec3d>& r, std::vector<double>& v)
+{
+	int N = (int)r.size();
+	v.assign(N, 0.0);
+	if (N == 0) return;
+
+	std::vector<POINT> pt(N);
+	std::vector< std::pair<long long, int> > order(N);
+#pragma omp parallel for
+	for (int n = 0; n < N; ++n)
+	{
+		pt[n] = map(r[n]);
+		order[n] = std::pair<long long, int>(sort_key(pt[n]), n);
+	}
+
+	std::sort(order.begin(), order.end());
+
+	// consecutive points now access the same part of the image, so each thread
+	// gets a contiguous chunk of the sorted list.
+#pragma omp parallel for schedule(static)
+	for (int n = 0; n < N; ++n)
+	{
+		int m = order[n].second;
+		if (order[n].first >= 0) v[m] = value(pt[m]);
+	}
+}
+
 double ImageMap::value(const POINT& p)
 {
 	int nx = m_img.width ();
@@ -83,6 +236,8 @@ double ImageMap::value(const POINT& p)
 		if ((p.i<0) || (p.i >= nx-1)) return 0.0;
 		if ((p.j<0) || (p.j >= ny-1)) return 0.0;
 
+		if (m_brick.empty() == false) return brick_value(p);
+
 		double v[4];
 		v[0] = m_img.value(p.i  , p.j  , 0);
 		v[1] = m_img.value(p.i+1, p.j  , 0);
@@ -97,6 +252,8 @@ double ImageMap::value(const POINT& p)
 		if ((p.j<0) || (p.j >= ny-1)) return 0.0;
 		if ((p.k<0) || (p.k >= nz-1)) return 0.0;
 
+		if (m_brick.empty() == false) return brick_value(p);
+
 		double v[8];
 		v[0] = m_img.value(p.i  , p.j  , p.k  );
 		v[1] = m_img.value(p.i+1, p.j  , p.k  );
@@ -3,6 +3,7 @@
 #include <FECore/vec3d.h>
 #include <FECore/mat3d.h>
 #include "feimglib_api.h"
+#include <vector>
 
 class FEIMGLIB_API ImageMap
 {
@@ -26,6 +27,17 @@ public:
 	double value(const POINT& p);
 	double value(const vec3d& r) { return value(map(r)); }
 
+	// evaluate the image at many points at once. The points are sorted so that
+	// neighboring image samples are visited together and are then evaluated in parallel.
+	void values(const std::vector<vec3d>& r, std::vector<double>& v);
+
+	// Set the brick size (0 = disable bricking). When bricking is enabled, the image
+	// is copied into cubic bricks that overlap by one voxel, so that all eight
+	// voxels needed for interpolating a point are stored in the same small block.
+	// UpdateBricks must be called each time the image data changes.
+	void SetBrickSize(int n);
+	void UpdateBricks();
+
 	// image gradient
 	vec3d gradient(const vec3d& r);
 
@@ -37,6 +49,12 @@ public:
 	double dy() { return (m_r1.y - m_r0.y)/(double) (m_img.height() - 1); }
 	double dz() { int nz = m_img.depth(); if (nz == 1) return 1.0; else return (m_r1.z - m_r0.z)/(double) (m_img.depth () - 1); }
 
+protected:
+	double brick_value(const POINT& p);
+
+	// returns an index that orders points by their memory locality
+	long long sort_key(const POINT& p);
+
 protected:
 	double grad_x(int i, int j, int k);
 	double grad_y(int i, int j, int k);
@@ -53,4 +71,9 @@ protected:
 	Image&	m_img;
 	vec3d	m_r0;
 	vec3d	m_r1;	
+
+	int		m_bs;					// brick size (0 = bricking disabled)
+	int		m_nbx, m_nby, m_nbz;	// number of bricks in each direction
+	int		m_bsx, m_bsy, m_bsz;	// stored voxels per brick in each direction
+	std::vector<float>	m_brick;	// bricked image data
 };
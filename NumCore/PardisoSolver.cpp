@@ -90,6 +90,9 @@ void print_err(int nerror)
 BEGIN_FECORE_CLASS(PardisoSolver, LinearSolver)
 	ADD_PARAMETER(m_print_cn, "print_condition_number");
 	ADD_PARAMETER(m_iparm3  , "precondition");
+	ADD_PARAMETER(m_mixed   , "mixed_precision");
+	ADD_PARAMETER(m_refineTol, FE_RANGE_GREATER(0.0), "refine_tol");
+	ADD_PARAMETER(m_maxRefine, FE_RANGE_GREATER_OR_EQUAL(1), "max_refine");
 END_FECORE_CLASS();
 
 //-----------------------------------------------------------------------------
@@ -99,6 +102,11 @@ PardisoSolver::PardisoSolver(FEModel* fem) : LinearSolver(fem), m_pA(0)
 	m_mtype = -2;
 	m_iparm3 = false;
 	m_isFactored = false;
+
+	m_mixed = false;
+	m_refineTol = 1e-10;
+	m_maxRefine = 10;
+	m_mixedFailed = false;
 }
 
 //-----------------------------------------------------------------------------
@@ -179,6 +187,52 @@ bool PardisoSolver::Factor()
 	// make sure we have work to do
 	if (m_pA->Rows() == 0) return true;
 
+	if (UseMixedPrecision() && (DoFactor(true) == false))
+	{
+		// The single precision factorization failed, so we try again in double precision
+		feLogWarning("Single precision factorization failed. Switching to double precision.");
+		m_mixedFailed = true;
+		Destroy();
+	}
+
+	if (UseMixedPrecision() == false)
+	{
+		if (DoFactor(false) == false) return false;
+	}
+
+	// calculate and print the condition number
+	if (m_print_cn)
+	{
+		double c = ConditionNumber();
+		feLog("\tcondition number (est.) ................... : %lg\n\n", c);
+	}
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// In single precision, PARDISO stores the factor in single precision, which 
+// halves the memory needed for the factor. The matrix values must then also 
+// be passed in single precision.
+bool PardisoSolver::DoFactor(bool singlePrecision)
+{
+	m_iparm[27] = (singlePrecision ? 1 : 0);
+
+	void* pa = m_pA->Values();
+	if (singlePrecision)
+	{
+		double* a = m_pA->Values();
+		m_af.resize(m_nnz);
+#pragma omp parallel for
+		for (int i = 0; i < m_nnz; ++i) m_af[i] = (float)a[i];
+		pa = &m_af[0];
+	}
+	else
+	{
+		m_af.clear();
+		m_af.shrink_to_fit();
+	}
+
 // ------------------------------------------------------------------------------
 // Reordering and Symbolic Factorization.  This step also allocates all memory
 // that is necessary for the factorization.
@@ -187,7 +241,7 @@ bool PardisoSolver::Factor()
 	int phase = 11;
 
 	int error = 0;
-	pardiso(m_pt, &m_maxfct, &m_mnum, &m_mtype, &phase, &m_n, m_pA->Values(), m_pA->Pointers(), m_pA->Indices(),
+	pardiso(m_pt, &m_maxfct, &m_mnum, &m_mtype, &phase, &m_n, pa, m_pA->Pointers(), m_pA->Indices(),
 		 NULL, &m_nrhs, m_iparm, &m_msglvl, NULL, NULL, &error);
 
 	if (error)
@@ -205,25 +259,22 @@ bool PardisoSolver::Factor()
 
 	m_iparm[3] = (m_iparm3 ? 61 : 0);
 	error = 0;
-	pardiso(m_pt, &m_maxfct, &m_mnum, &m_mtype, &phase, &m_n, m_pA->Values(), m_pA->Pointers(), m_pA->Indices(),
+	pardiso(m_pt, &m_maxfct, &m_mnum, &m_mtype, &phase, &m_n, pa, m_pA->Pointers(), m_pA->Indices(),
 		 NULL, &m_nrhs, m_iparm, &m_msglvl, NULL, NULL, &error);
 
+	// we consider this a factorization, so that Destroy releases the memory
+	m_isFactored = true;
+
 	if (error)
 	{
+		// in single precision we'll try again in double precision, so no need to report this
+		if (singlePrecision) return false;
+
 		fprintf(stderr, "\nERROR during factorization: ");
 		print_err(error);
 		return false;
 	}
 
-	m_isFactored = true;
-
-	// calculate and print the condition number
-	if (m_print_cn)
-	{
-		double c = ConditionNumber();
-		feLog("\tcondition number (est.) ................... : %lg\n\n", c);
-	}
-
 	return true;
 }
 
@@ -233,14 +284,18 @@ bool PardisoSolver::BackSolve(double* x, double* b)
 	// make sure we have work to do
 	if (m_pA->Rows() == 0) return true;
 
-	int phase = 33;
-
-	m_iparm[7] = 1;	/* Maximum number of iterative refinement steps */
+	if (UseMixedPrecision())
+	{
+		if (BackSolveMixed(x, b)) return true;
 
-	int error = 0;
-	pardiso(m_pt, &m_maxfct, &m_mnum, &m_mtype, &phase, &m_n, m_pA->Values(), m_pA->Pointers(), m_pA->Indices(),
-		 NULL, &m_nrhs, m_iparm, &m_msglvl, b, x, &error);
+		// The refinement did not converge. We'll refactor in double precision
+		feLogWarning("Mixed precision refinement stalled. Switching to double precision.");
+		m_mixedFailed = true;
+		Destroy();
+		if (Factor() == false) return false;
+	}
 
+	int error = SolveFactored(x, b);
 	if (error)
 	{
 		fprintf(stderr, "\nERROR during solution: ");
@@ -254,11 +309,88 @@ bool PardisoSolver::BackSolve(double* x, double* b)
 	return true;
 }
 
+//-----------------------------------------------------------------------------
+// Do one solve with the current factorization (without any refinement on our side).
+// Returns the PARDISO error code.
+int PardisoSolver::SolveFactored(double* x, double* b)
+{
+	int phase = 33;
+	int error = 0;
+	if (UseMixedPrecision())
+	{
+		m_bf.resize(m_n);
+		m_xf.resize(m_n);
+		for (int i = 0; i < m_n; ++i) m_bf[i] = (float)b[i];
+
+		m_iparm[7] = 0;	/* refinement is done by BackSolveMixed */
+		pardiso(m_pt, &m_maxfct, &m_mnum, &m_mtype, &phase, &m_n, &m_af[0], m_pA->Pointers(), m_pA->Indices(),
+			NULL, &m_nrhs, m_iparm, &m_msglvl, &m_bf[0], &m_xf[0], &error);
+
+		for (int i = 0; i < m_n; ++i) x[i] = m_xf[i];
+	}
+	else
+	{
+		m_iparm[7] = 1;	/* Maximum number of iterative refinement steps */
+		pardiso(m_pt, &m_maxfct, &m_mnum, &m_mtype, &phase, &m_n, m_pA->Values(), m_pA->Pointers(), m_pA->Indices(),
+			NULL, &m_nrhs, m_iparm, &m_msglvl, b, x, &error);
+	}
+	return error;
+}
+
+//-----------------------------------------------------------------------------
+// Solve the system with the single precision factor and improve the solution with
+// iterative refinement, using residuals that are calculated in double precision.
+// Returns false if the refinement stalls or doesn't converge.
+bool PardisoSolver::BackSolveMixed(double* x, double* b)
+{
+	int n = m_n;
+	m_r.assign(b, b + n);
+	m_dx.resize(n);
+	for (int i = 0; i < n; ++i) x[i] = 0.0;
+
+	double normb = 0.0;
+	for (int i = 0; i < n; ++i) normb += b[i] * b[i];
+	normb = sqrt(normb);
+	if (normb == 0.0) return true;
+
+	double normr = normb;
+	for (int k = 0; k < m_maxRefine; ++k)
+	{
+		// solve for the correction in single precision
+		if (SolveFactored(&m_dx[0], &m_r[0]) != 0) return false;
+
+		UpdateStats(1);
+
+		for (int i = 0; i < n; ++i) x[i] += m_dx[i];
+
+		// calculate the new residual r = b - A*x
+		m_pA->mult_vector(x, &m_r[0]);
+		double normr1 = 0.0;
+		for (int i = 0; i < n; ++i)
+		{
+			m_r[i] = b[i] - m_r[i];
+			normr1 += m_r[i] * m_r[i];
+		}
+		normr1 = sqrt(normr1);
+
+		if (normr1 <= m_refineTol*normb) return true;
+
+		// see if we are still making progress
+		if (normr1 > 0.5*normr) return false;
+		normr = normr1;
+	}
+
+	return false;
+}
+
+//-----------------------------------------------------------------------------
 double PardisoSolver::ConditionNumber()
 {
 	if (m_isFactored == false) return 0.0;
 
 	// This assumes that the factorization is already done!
+	// The solves below use the factorization as is, so that the estimate never
+	// triggers the fallback from mixed to double precision.
 	int N = m_pA->Rows();
 
 	// get the norm of the matrix
@@ -286,7 +418,7 @@ double PardisoSolver::ConditionNumber()
 
 		for (int i = 0; i < iters; ++i)
 		{
-			BackSolve(&y[0], &x[0]);
+			SolveFactored(&y[0], &x[0]);
 
 			for (int j = 0; j < N; ++j)
 			{
@@ -296,7 +428,7 @@ double PardisoSolver::ConditionNumber()
 
 			// Solve transpose
 			m_iparm[11] = 2;
-			BackSolve(&z[0], &b[0]);
+			SolveFactored(&z[0], &b[0]);
 			m_iparm[11] = 0;
 
 			double zmax = 0.0;
@@ -346,6 +478,9 @@ void PardisoSolver::Destroy()
 BEGIN_FECORE_CLASS(PardisoSolver, LinearSolver)
 	ADD_PARAMETER(m_print_cn, "print_condition_number");
 	ADD_PARAMETER(m_iparm3, "precondition");
+	ADD_PARAMETER(m_mixed, "mixed_precision");
+	ADD_PARAMETER(m_refineTol, "refine_tol");
+	ADD_PARAMETER(m_maxRefine, "max_refine");
 END_FECORE_CLASS();
 
 PardisoSolver::PardisoSolver(FEModel* fem) : LinearSolver(fem) {}
@@ -359,4 +494,7 @@ bool PardisoSolver::SetSparseMatrix(SparseMatrix* pA) { return false; }
 void PardisoSolver::PrintConditionNumber(bool b) {}
 double PardisoSolver::ConditionNumber() { return 0; }
 void PardisoSolver::UseIterativeFactorization(bool b) {}
+bool PardisoSolver::DoFactor(bool singlePrecision) { return false; }
+bool PardisoSolver::BackSolveMixed(double* x, double* b) { return false; }
+int PardisoSolver::SolveFactored(double* x, double* b) { return 0; }
 #endif
@@ -30,6 +30,7 @@ SOFTWARE.*/
 #include <FECore/LinearSolver.h>
 #include <FECore/CompactUnSymmMatrix.h>
 #include <FECore/CompactSymmMatrix.h>
+#include <vector>
 
 //! The Pardiso solver is included in the Intel Math Kernel Library (MKL).
 //! It can also be installed as a shared object library from
@@ -55,6 +56,19 @@ public:
 
 	void UseIterativeFactorization(bool b);
 
+protected:
+	// do the symbolic and numeric factorization (in single or double precision)
+	bool DoFactor(bool singlePrecision);
+
+	// solve in single precision and refine the solution in double precision
+	bool BackSolveMixed(double* x, double* b);
+
+	// one solve with the current factorization (returns the PARDISO error code)
+	int SolveFactored(double* x, double* b);
+
+	// returns true if the mixed precision mode is used
+	bool UseMixedPrecision() const { return (m_mixed && !m_mixedFailed); }
+
 protected:
 
 	CompactMatrix*	m_pA;
@@ -74,6 +88,15 @@ protected:
 
 	bool	m_isFactored;
 
+	// mixed precision data
+	bool	m_mixed;		// factor in single precision and refine in double precision
+	double	m_refineTol;	// relative residual tolerance for iterative refinement
+	int		m_maxRefine;	// max nr of refinement iterations
+	bool	m_mixedFailed;	// set when the refinement failed (we then switch to double precision)
+	std::vector<float>	m_af;		// single precision matrix values
+	std::vector<float>	m_bf, m_xf;	// single precision right-hand side and solution
+	std::vector<double>	m_r, m_dx;	// residual and correction of refinement
+
 	void* m_pt[64]; // Internal solver memory pointer
 
 	DECLARE_FECORE_CLASS();